@@ -0,0 +1,384 @@
+// Ossim Implementation File Information ///////////////////////////////
+/**
+* @file ossim.c
+*
+* @brief Implementation for libossim
+*
+* @details Implements the stable C API used to embed the simulator
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of ossim
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* sim_run fails if the run state cannot be set up
+*
+* @note Requires ossim.h
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ossim.h"
+#include "processor.h"
+
+// Everything one embedded simulator keeps between calls
+struct SimHandle
+{
+  ConfigData *cfData;
+  MetaNode *workloadNode;
+  SimLogSink logSink;
+  void *logUserData;
+  RunSummary runSummary;
+  Boolean hasRun;
+};
+
+//
+// sim_create Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function creates a simulator handle
+ *
+ * @details This function allocates a handle with no config, no workload and
+ *          no log sink.
+ *
+ * @return a new handle, or NULL if out of memory (SimHandle *)
+ */
+SimHandle *sim_create( void )
+{
+    SimHandle *handle = malloc( sizeof( *handle ) );
+
+    if( handle == NULL )
+    {
+        return NULL;
+    }
+
+    handle->cfData = NULL;
+    handle->workloadNode = NULL;
+    handle->logSink = NULL;
+    handle->logUserData = NULL;
+    handle->hasRun = False;
+
+    return handle;
+}
+//
+// sim_destroy Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees a simulator handle
+ *
+ * @details This function frees the handle with its config and workload.
+ *
+ * @pre handle a pointer to a SimHandle, or NULL
+ *
+ * @post handle is freed at post
+ *
+ * @param[in] handle a pointer to a SimHandle
+ *
+ * @return Nothing to return (void)
+ */
+void sim_destroy( SimHandle *handle )
+{
+    if( handle == NULL )
+    {
+        return;
+    }
+
+    if( handle->cfData != NULL )
+    {
+        freeConfig( handle->cfData );
+    }
+
+    freeList( handle->workloadNode );
+    free( handle );
+}
+//
+// sim_load_config_mem Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function loads a config from memory
+ *
+ * @details This function parses the text of a config file held in memory,
+ *          replacing any config the handle already has.
+ *
+ * @par Algorithm
+ *      The buffer is opened as a read only stream with fmemopen, so the
+ *      same parser as the config file is used. The File Path line is
+ *      still checked but not used, the workload comes from
+ *      sim_load_workload_mem.
+ *
+ * @pre data a pointer to the config text, it does not need to end in a
+ *           null terminal
+ *
+ * @post data remains unchanged at post
+ *
+ * @exception badConfig
+ *            If the text is not a valid config, the handle keeps its old
+ *            config and SIM_ERROR_CONFIG is returned.
+ *
+ * @param[in] handle a pointer to a SimHandle
+ *
+ * @param[in] data a pointer to the config text
+ *
+ * @param[in] length the number of bytes of text
+ *
+ * @return SIM_OK, or a SIM_RESULT_CODES error (int)
+ */
+int sim_load_config_mem( SimHandle *handle, const char *data, size_t length )
+{
+    FILE *filePointer;
+    ConfigData *cfData;
+
+    if( handle == NULL || data == NULL || length == 0 )
+    {
+        return SIM_ERROR_ARGUMENT;
+    }
+
+    filePointer = fmemopen( (void *) data, length, "r" );
+
+    if( filePointer == NULL )
+    {
+        return SIM_ERROR_CONFIG;
+    }
+
+    cfData = readConfig( filePointer );
+    fclose( filePointer );
+
+    if( cfData == NULL )
+    {
+        return SIM_ERROR_CONFIG;
+    }
+
+    if( handle->cfData != NULL )
+    {
+        freeConfig( handle->cfData );
+    }
+
+    handle->cfData = cfData;
+
+    return SIM_OK;
+}
+//
+// sim_load_workload_mem Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function loads a workload from memory
+ *
+ * @details This function parses the text of a metadata file held in memory,
+ *          replacing any workload the handle already has. The workload is
+ *          parsed once here and shared by every later run.
+ *
+ * @pre data a pointer to the metadata text, it does not need to end in a
+ *           null terminal
+ *
+ * @post data remains unchanged at post
+ *
+ * @exception badWorkload
+ *            If the text is not valid metadata, the handle keeps its old
+ *            workload and SIM_ERROR_WORKLOAD is returned.
+ *
+ * @param[in] handle a pointer to a SimHandle
+ *
+ * @param[in] data a pointer to the metadata text
+ *
+ * @param[in] length the number of bytes of text
+ *
+ * @return SIM_OK, or a SIM_RESULT_CODES error (int)
+ */
+int sim_load_workload_mem( SimHandle *handle, const char *data, size_t length )
+{
+    FILE *filePointer;
+    MetaNode *workloadNode;
+
+    if( handle == NULL || data == NULL || length == 0 )
+    {
+        return SIM_ERROR_ARGUMENT;
+    }
+
+    filePointer = fmemopen( (void *) data, length, "r" );
+
+    if( filePointer == NULL )
+    {
+        return SIM_ERROR_WORKLOAD;
+    }
+
+    workloadNode = readMetadata( filePointer );
+    fclose( filePointer );
+
+    if( workloadNode == NULL )
+    {
+        return SIM_ERROR_WORKLOAD;
+    }
+
+    freeList( handle->workloadNode );
+    handle->workloadNode = workloadNode;
+
+    return SIM_OK;
+}
+//
+// sim_set_log_sink Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function sets where the log lines of a run go
+ *
+ * @details This function sets a callback that is given every log line of
+ *          later runs. Without a sink, runs log nothing. The Log To and Log
+ *          File Path settings of the config are not used by the library.
+ *
+ * @pre sink a function pointer, or NULL to stop logging
+ *
+ * @post the handle uses the sink for later runs at post
+ *
+ * @param[in] handle a pointer to a SimHandle
+ *
+ * @param[in] sink a function to call with each log line
+ *
+ * @param[in] userData a pointer given back to each call of sink
+ *
+ * @return SIM_OK, or SIM_ERROR_ARGUMENT (int)
+ */
+int sim_set_log_sink( SimHandle *handle, SimLogSink sink, void *userData )
+{
+    if( handle == NULL )
+    {
+        return SIM_ERROR_ARGUMENT;
+    }
+
+    handle->logSink = sink;
+    handle->logUserData = userData;
+
+    return SIM_OK;
+}
+//
+// sim_run Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function runs the loaded workload under the loaded config
+ *
+ * @details This function runs one simulation in its own SimContext and
+ *          keeps its totals for sim_get_stats. The Simulation Clock setting
+ *          of the config is used, and the Workload Ingestion setting is not
+ *          as the workload is already parsed.
+ *
+ * @pre handle has a config and a workload loaded
+ *
+ * @post handle holds the totals of the run at post
+ *
+ * @exception notReady
+ *            If no config or no workload is loaded, return
+ *            SIM_ERROR_NOT_READY.
+ *
+ * @exception runFailed
+ *            If the run stopped before the system stop, return
+ *            SIM_ERROR_RUN.
+ *
+ * @param[in] handle a pointer to a SimHandle
+ *
+ * @return SIM_OK, or a SIM_RESULT_CODES error (int)
+ */
+int sim_run( SimHandle *handle )
+{
+    ConfigData runConfig;
+    SimContext *context;
+    StringNode *logNode;
+
+    if( handle == NULL )
+    {
+        return SIM_ERROR_ARGUMENT;
+    }
+
+    if( handle->cfData == NULL || handle->workloadNode == NULL )
+    {
+        return SIM_ERROR_NOT_READY;
+    }
+
+    // Lines only go to the sink, never to the monitor or a log file
+    runConfig = *handle->cfData;
+    runConfig.logTo = "None";
+
+    context = createSimContext( &runConfig );
+
+    if( context == NULL )
+    {
+        return SIM_ERROR_RUN;
+    }
+
+    context->logSink = handle->logSink;
+    context->logUserData = handle->logUserData;
+
+    logNode = beginProcessing( context, handle->workloadNode, NULL );
+
+    handle->runSummary = context->runSummary;
+    handle->hasRun = True;
+
+    freeStringList( logNode );
+    freeSimContext( context );
+
+    if( handle->runSummary.processes == 0 )
+    {
+        return SIM_ERROR_RUN;
+    }
+
+    return SIM_OK;
+}
+//
+// sim_get_stats Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the totals of the last run
+ *
+ * @details This function fills in as much of the caller's SimStats as its
+ *          structSize says it has room for.
+ *
+ * @pre stats a pointer to a SimStats with structSize set
+ *
+ * @post stats holds the totals of the last run at post
+ *
+ * @exception notReady
+ *            If the handle has not been run, return SIM_ERROR_NOT_READY.
+ *
+ * @param[in] handle a pointer to a SimHandle
+ *
+ * @param[in,out] stats a pointer to a SimStats struct
+ *
+ * @return SIM_OK, or a SIM_RESULT_CODES error (int)
+ */
+int sim_get_stats( SimHandle *handle, SimStats *stats )
+{
+    SimStats fullStats;
+    size_t copySize = sizeof( fullStats );
+
+    if( handle == NULL || stats == NULL
+     || stats->structSize < sizeof( stats->structSize ) )
+    {
+        return SIM_ERROR_ARGUMENT;
+    }
+
+    if( handle->hasRun == False )
+    {
+        return SIM_ERROR_NOT_READY;
+    }
+
+    if( stats->structSize < copySize )
+    {
+        copySize = stats->structSize;
+    }
+
+    fullStats.structSize = stats->structSize;
+    fullStats.totalTime = handle->runSummary.totalTime;
+    fullStats.processes = handle->runSummary.processes;
+    fullStats.dispatches = handle->runSummary.dispatches;
+    fullStats.ioBlocks = handle->runSummary.ioBlocks;
+    fullStats.segFaults = handle->runSummary.segFaults;
+
+    memcpy( stats, &fullStats, copySize );
+
+    return SIM_OK;
+}
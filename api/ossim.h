@@ -0,0 +1,119 @@
+// Ossim Header Information ////////////////////////////////////////
+/**
+* @file ossim.h
+*
+* @brief Public header file for libossim
+*
+* @details Specifies the stable C API of libossim, used to load configs and
+*          workloads from memory and run simulations inside another program
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of ossim
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* Added OSSIM_API so only the sim_ functions are exported by libossim.so
+*
+* @note This is the only header a program using libossim needs. Nothing in
+*       it depends on the simulator's own headers, so their structs can
+*       change without breaking programs built against an older library.
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides the operations for embedding the simulator. Each
+  SimHandle holds one config and one parsed workload and can be run any
+  number of times. Handles share nothing, so different threads can run
+  different handles at the same time.
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef OSSIM_H
+#define OSSIM_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+
+// Bumped whenever a function or field is added to this header
+#define OSSIM_API_VERSION 1
+
+// Marks the functions libossim.so exports, the library is built with
+// everything else hidden
+#if defined( __GNUC__ ) && __GNUC__ >= 4
+#define OSSIM_API __attribute__(( visibility( "default" ) ))
+#else
+#define OSSIM_API
+#endif
+
+// Return codes of every function that returns an int
+enum SIM_RESULT_CODES
+{
+  SIM_OK = 0,
+  SIM_ERROR_ARGUMENT,
+  SIM_ERROR_CONFIG,
+  SIM_ERROR_WORKLOAD,
+  SIM_ERROR_NOT_READY,
+  SIM_ERROR_RUN
+};
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+
+// Opaque handle to one simulator instance
+typedef struct SimHandle SimHandle;
+
+// Called once for every log line of a run, line ends in a new line
+typedef void (*SimLogSink)( const char *line, void *userData );
+
+// Totals of the last run. Set structSize to sizeof( SimStats ) before
+// calling sim_get_stats, fields past that size are left alone so new
+// fields can be added to the end without breaking older programs
+typedef struct SimStats
+{
+  size_t structSize;
+  double totalTime;
+  int processes;
+  int dispatches;
+  int ioBlocks;
+  int segFaults;
+} SimStats;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+OSSIM_API SimHandle *sim_create( void );
+
+OSSIM_API void sim_destroy( SimHandle *handle );
+
+OSSIM_API int sim_load_config_mem( SimHandle *handle,
+                                   const char *data,
+                                   size_t length );
+
+OSSIM_API int sim_load_workload_mem( SimHandle *handle,
+                                     const char *data,
+                                     size_t length );
+
+OSSIM_API int sim_set_log_sink( SimHandle *handle,
+                                SimLogSink sink,
+                                void *userData );
+
+OSSIM_API int sim_run( SimHandle *handle );
+
+OSSIM_API int sim_get_stats( SimHandle *handle, SimStats *stats );
+
+#ifdef __cplusplus
+}
+#endif
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // OSSIM_H
+//
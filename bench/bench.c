@@ -0,0 +1,898 @@
+// Bench Implementation File Information ///////////////////////////////
+/**
+* @file bench.c
+*
+* @brief Implementation for bench
+*
+* @details Implements the benchmark harness run by make bench
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of bench
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* The SJF and SRTF pick is timed on the aging ready queue
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* The benchmarks stop if a SimContext cannot be set up
+*
+* @note Requires bench.h
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "bench.h"
+
+int main( int argc, char *argv[] )
+{
+    BenchState state;
+    int caseIndex;
+    BenchCase benchCases[] =
+    {
+        { "parse readMetadata", benchParse },
+        { "pcb buildPcbList", benchPcbBuild },
+        { "sched takeAgingProcess", benchShortestSelect },
+        { "sched getNextReadyProcess", benchNextReadySelect },
+        { "mmu allocate", benchMmuAllocate },
+        { "mmu accessMemory", benchMmuAccess },
+        { "interupt queue/resolve", benchInterupts },
+        { "log logLine discarded", benchLogDiscarded },
+        { "log logLine kept", benchLogKept }
+    };
+    int caseCount = sizeof( benchCases ) / sizeof( benchCases[ 0 ] );
+
+    if( parseBenchArgs( argc, argv, &state.options ) != 0 )
+    {
+        printf( "Usage: %s [%s N] [%s N] [%s N] [%s N] [%s name]\n",
+                argv[ 0 ], BENCH_PROCESSES_OPTION, BENCH_OPS_OPTION,
+                BENCH_REPS_OPTION, BENCH_SEED_OPTION, BENCH_ONLY_OPTION );
+        return EXIT_FAILURE;
+    }
+
+    if( setupBench( &state ) == False )
+    {
+        printf( "Unable to set up the benchmark workload\n" );
+        freeBench( &state );
+        return EXIT_FAILURE;
+    }
+
+    printf( "Simulator Benchmarks\n" );
+    printf( "====================\n" );
+    printf( "Workload: %d processes x %d ops, %d repeats, seed %u\n\n",
+            state.options.processes, state.options.opsPerProcess,
+            state.options.reps, state.options.seed );
+    printf( "%-26s %10s %12s %10s %12s %14s\n",
+            "Benchmark", "Ops/Rep", "ns/op", "StdDev", "Min ns/op",
+            "Ops/sec" );
+
+    for( caseIndex = 0; caseIndex < caseCount; caseIndex++ )
+    {
+        if( state.options.only == NULL
+         || cmpExpected( benchCases[ caseIndex ].name,
+                         state.options.only ) == True )
+        {
+            runBenchCase( &state, &benchCases[ caseIndex ] );
+        }
+    }
+
+    freeBench( &state );
+
+    return EXIT_SUCCESS;
+}
+//
+// parseBenchArgs Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function reads the benchmark options
+ *
+ * @details This function fills in the options given on the command line,
+ *          every other option keeps its default.
+ *
+ * @exception badOption
+ *            If an option is unknown or its value is not a positive number,
+ *            print it and return 1.
+ *
+ * @param[in] argc number of command line arguments
+ *
+ * @param[in] argv the command line arguments
+ *
+ * @param[out] options a pointer to a BenchOptions struct
+ *
+ * @return 0 for success, 1 for a bad option (int)
+ */
+int parseBenchArgs( int argc, char *argv[], BenchOptions *options )
+{
+    int iterator, value;
+    char *option;
+
+    options->processes = 500;
+    options->opsPerProcess = 20;
+    options->reps = 5;
+    options->seed = 1;
+    options->only = NULL;
+
+    for( iterator = 1; iterator < argc; iterator += 2 )
+    {
+        option = argv[ iterator ];
+
+        if( iterator + 1 >= argc )
+        {
+            printf( "Missing value for %s\n", option );
+            return 1;
+        }
+
+        if( stringCmp( option, (char *) BENCH_ONLY_OPTION ) == True )
+        {
+            options->only = argv[ iterator + 1 ];
+            continue;
+        }
+
+        if( checkInt( argv[ iterator + 1 ] ) == False
+         || ( value = stringToI( argv[ iterator + 1 ] ) ) < 1 )
+        {
+            printf( "Bad value for %s: %s\n", option, argv[ iterator + 1 ] );
+            return 1;
+        }
+
+        if( stringCmp( option, (char *) BENCH_PROCESSES_OPTION ) == True )
+        {
+            options->processes = value;
+        }
+        else if( stringCmp( option, (char *) BENCH_OPS_OPTION ) == True )
+        {
+            options->opsPerProcess = value;
+        }
+        else if( stringCmp( option, (char *) BENCH_REPS_OPTION ) == True )
+        {
+            options->reps = value;
+        }
+        else if( stringCmp( option, (char *) BENCH_SEED_OPTION ) == True )
+        {
+            options->seed = (unsigned int) value;
+        }
+        else
+        {
+            printf( "Unknown option %s\n", option );
+            return 1;
+        }
+    }
+
+    return 0;
+}
+//
+// setupBench Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function makes the workload every benchmark works on
+ *
+ * @details This function generates the metadata text, parses it once for
+ *          the benchmarks that need a list, and makes the config they run
+ *          under.
+ *
+ * @pre state a pointer to a BenchState with its options set
+ *
+ * @post state holds the workload at post
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean setupBench( BenchState *state )
+{
+    FILE *filePointer;
+
+    state->randomState = state->options.seed;
+    state->workloadNode = NULL;
+    state->cfData = createBenchConfig( "SJF-N", "None" );
+    state->workloadText = generateBenchWorkload( state,
+                                                 &state->workloadLength );
+
+    filePointer = fmemopen( state->workloadText, state->workloadLength, "r" );
+
+    if( filePointer == NULL )
+    {
+        return False;
+    }
+
+    state->workloadNode = readMetadata( filePointer );
+    fclose( filePointer );
+
+    return state->workloadNode != NULL;
+}
+//
+// freeBench Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees the workload of the benchmarks
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @return nothing to return (void)
+ */
+void freeBench( BenchState *state )
+{
+    freeList( state->workloadNode );
+    free( state->workloadText );
+    // The config only holds string literals, so freeConfig is not used
+    free( state->cfData );
+}
+//
+// generateBenchWorkload Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function generates metadata text of the asked for size
+ *
+ * @details This function writes a workload of A(start) blocks, each with a
+ *          random mix of run, I/O and memory ops, in the metadata format.
+ *
+ * @par Algorithm
+ *      Each process allocates one block of memory first, later memory ops
+ *      access inside it. Op kinds and cycle counts come from the seeded
+ *      generator, so the same options always give the same text.
+ *
+ * @pre state a pointer to a BenchState with its options set
+ *
+ * @post state has moved its random state on at post
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[out] length the number of characters of text
+ *
+ * @return the malloc'd metadata text (char *)
+ */
+char *generateBenchWorkload( BenchState *state, size_t *length )
+{
+    char *inputDevices[] = { "hard drive", "keyboard" };
+    char *outputDevices[] = { "hard drive", "printer", "monitor" };
+    int process, op, kind, start;
+    size_t size = (size_t) state->options.processes
+                * ( state->options.opsPerProcess + 3 ) * BENCH_CHARS_PER_OP
+                + 128;
+    char *text = malloc( size );
+    char *writePtr = text;
+
+    writePtr += sprintf( writePtr, "Start Program Meta-Data Code:\nS(start)0;\n" );
+
+    for( process = 0; process < state->options.processes; process++ )
+    {
+        start = getBenchRandom( state, 500 );
+        writePtr += sprintf( writePtr, "A(start)0;\nM(allocate)%d;",
+                             1000000 + start * 1000 + 100 );
+
+        for( op = 0; op < state->options.opsPerProcess; op++ )
+        {
+            kind = getBenchRandom( state, 10 );
+
+            if( kind < 5 )
+            {
+                writePtr += sprintf( writePtr, " P(run)%u;",
+                                     1 + getBenchRandom( state, 20 ) );
+            }
+            else if( kind < 7 )
+            {
+                writePtr += sprintf( writePtr, " I(%s)%u;",
+                                     inputDevices[ getBenchRandom( state, 2 ) ],
+                                     1 + getBenchRandom( state, 50 ) );
+            }
+            else if( kind < 9 )
+            {
+                writePtr += sprintf( writePtr, " O(%s)%u;",
+                                     outputDevices[ getBenchRandom( state, 3 ) ],
+                                     1 + getBenchRandom( state, 50 ) );
+            }
+            else
+            {
+                writePtr += sprintf( writePtr, " M(access)%d;",
+                                     1000000 + start * 1000 + 50 );
+            }
+
+            if( op % 4 == 3 )
+            {
+                writePtr += sprintf( writePtr, "\n" );
+            }
+        }
+
+        writePtr += sprintf( writePtr, "\nA(end)0;\n" );
+    }
+
+    writePtr += sprintf( writePtr, "S(end)0.\nEnd Program Meta-Data Code.\n" );
+
+    *length = writePtr - text;
+
+    return text;
+}
+//
+// createBenchConfig Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function makes a config for the benchmarks
+ *
+ * @details This function fills in a config as if it was read from a file,
+ *          using the virtual clock so no benchmark waits on the timer.
+ *
+ * @pre cpuSchedCode and logTo string literals
+ *
+ * @post cpuSchedCode and logTo are pointed to by the config at post
+ *
+ * @param[in] cpuSchedCode a pointer to the scheduling code
+ *
+ * @param[in] logTo a pointer to the Log To setting
+ *
+ * @return a config to be freed with free, not freeConfig (ConfigData *)
+ */
+ConfigData *createBenchConfig( char *cpuSchedCode, char *logTo )
+{
+    ConfigData *cfData = createConfig();
+
+    cfData->versionPhase = 1;
+    cfData->filePath = "bench";
+    cfData->cpuSchedCode = cpuSchedCode;
+    cfData->quantumTime = 5;
+    cfData->memAvailable = 1000000;
+    cfData->processorCycleTime = 10;
+    cfData->ioCycleTime = 20;
+    cfData->logTo = logTo;
+    cfData->logFilePath = "bench.lgf";
+    cfData->virtualClock = True;
+
+    return cfData;
+}
+//
+// createBenchContext Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function makes a SimContext ready to use without a run
+ *
+ * @details This function sets up the parts of a SimContext that
+ *          beginProcessing would otherwise set up: the log, the workload
+ *          counters and the virtual clock.
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @post cfData remains unchanged at post
+ *
+ * @param[in] cfData a pointer to a ConfigData struct
+ *
+ * @return a SimContext to be freed with freeBenchContext (SimContext *)
+ */
+SimContext *createBenchContext( ConfigData *cfData )
+{
+    char timeString[ 300 ];
+    SimContext *context = createSimContext( cfData );
+
+    if( context == NULL )
+    {
+        printf( "Unable to set up a SimContext\n" );
+        exit( EXIT_FAILURE );
+    }
+
+    context->logNode = malloc( sizeof( *context->logNode ) );
+    context->logNode->string = NULL;
+    context->logNode->nextNode = NULL;
+
+    context->workload.stream = NULL;
+    context->workload.tailProcess = NULL;
+    context->workload.nextProcessNum = 0;
+    context->workload.activeProcesses = 0;
+    context->workload.exitedProcesses = 0;
+    context->workload.nextArrival = INT_MAX;
+    context->workload.streamError = False;
+
+    setVirtualClock( &context->timer, True );
+    accessTimer( &context->timer, ZERO_TIMER, timeString );
+
+    return context;
+}
+//
+// freeBenchContext Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees a SimContext made by createBenchContext
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return nothing to return (void)
+ */
+void freeBenchContext( SimContext *context )
+{
+    freeStringList( context->logNode );
+    freeSimContext( context );
+}
+//
+// getBenchRandom Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the next seeded random number
+ *
+ * @details This function uses a linear congruential generator, so results
+ *          do not depend on the C library and repeat for the same seed.
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[in] range one more than the largest number wanted
+ *
+ * @return a number from 0 to range - 1 (unsigned int)
+ */
+unsigned int getBenchRandom( BenchState *state, unsigned int range )
+{
+    state->randomState = state->randomState * 1103515245u + 12345u;
+
+    return ( state->randomState >> 16 ) % range;
+}
+//
+// runBenchCase Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function runs one benchmark and prints its line
+ *
+ * @details This function runs the benchmark once to warm up, then the
+ *          asked for number of repeats, and prints the mean, standard
+ *          deviation and best of the nsec per op of the repeats.
+ *
+ * @pre state a pointer to a BenchState made by setupBench
+ *
+ * @post the line of results is printed at post
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[in] benchCase a pointer to the BenchCase to run
+ *
+ * @return nothing to return (void)
+ */
+void runBenchCase( BenchState *state, BenchCase *benchCase )
+{
+    int rep, reps = state->options.reps;
+    long long elapsed, ops = 0;
+    double perOp, total = 0, totalSquares = 0, best = -1;
+    double mean, variance;
+
+    benchCase->function( state, &ops );
+
+    for( rep = 0; rep < reps; rep++ )
+    {
+        elapsed = benchCase->function( state, &ops );
+        perOp = ops > 0 ? (double) elapsed / ops : 0;
+
+        total += perOp;
+        totalSquares += perOp * perOp;
+
+        if( best < 0 || perOp < best )
+        {
+            best = perOp;
+        }
+    }
+
+    mean = total / reps;
+    variance = reps > 1 ? ( totalSquares - total * mean ) / ( reps - 1 ) : 0;
+
+    if( variance < 0 )
+    {
+        variance = 0;
+    }
+
+    printf( "%-26s %10lld %12.1lf %10.1lf %12.1lf %14.0lf\n",
+            benchCase->name, ops, mean, sqrt( variance ), best,
+            mean > 0 ? 1000000000.0 / mean : 0 );
+}
+//
+// benchParse Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function times readMetadata on the generated workload
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[out] ops the number of metadata ops parsed
+ *
+ * @return the nsec taken (long long)
+ */
+long long benchParse( BenchState *state, long long *ops )
+{
+    long long startTime, elapsed;
+    MetaNode *workloadNode;
+    FILE *filePointer = fmemopen( state->workloadText,
+                                  state->workloadLength, "r" );
+
+    startTime = getHostNanoSec();
+    workloadNode = readMetadata( filePointer );
+    elapsed = getHostNanoSec() - startTime;
+
+    fclose( filePointer );
+    freeList( workloadNode );
+
+    *ops = (long long) state->options.processes
+         * ( state->options.opsPerProcess + 3 ) + 2;
+
+    return elapsed;
+}
+//
+// benchPcbBuild Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function times buildPcbList on the parsed workload
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[out] ops the number of PCBs built
+ *
+ * @return the nsec taken (long long)
+ */
+long long benchPcbBuild( BenchState *state, long long *ops )
+{
+    long long startTime, elapsed;
+    PCB *headProcess = NULL;
+    SimContext *context = createBenchContext( state->cfData );
+
+    startTime = getHostNanoSec();
+    buildPcbList( context, &headProcess, state->workloadNode );
+    elapsed = getHostNanoSec() - startTime;
+
+    *ops = context->workload.nextProcessNum;
+
+    freePcbList( headProcess );
+    freeBenchContext( context );
+
+    return elapsed;
+}
+//
+// benchShortestSelect Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function times the SJF and SRTF pick of the next process
+ *
+ * @details This function builds a ring of ready PCBs from the workload,
+ *          adds them to an aging ready queue and picks the shortest one once
+ *          per process, adding it back as if it had run a quantum.
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[out] ops the number of picks
+ *
+ * @return the nsec taken (long long)
+ */
+long long benchShortestSelect( BenchState *state, long long *ops )
+{
+    int pick;
+    long long startTime, elapsed;
+    PCB *headProcess = NULL, *shortestProcess;
+    SimContext *context = createBenchContext( state->cfData );
+    AgingQueue *queue = createAgingQueue( state->cfData );
+
+    buildPcbList( context, &headProcess, state->workloadNode );
+    setStateRecursive( headProcess, READY );
+
+    for( shortestProcess = headProcess; shortestProcess != NULL;
+         shortestProcess = shortestProcess->nextProcess )
+    {
+        queueAgingProcess( queue, shortestProcess );
+    }
+
+    startTime = getHostNanoSec();
+
+    for( pick = 0; pick < state->options.processes; pick++ )
+    {
+        shortestProcess = takeAgingProcess( queue );
+        // Pick a different process next time, as if it had run
+        shortestProcess->processTime += 1000;
+        queueAgingProcess( queue, shortestProcess );
+    }
+
+    elapsed = getHostNanoSec() - startTime;
+    *ops = state->options.processes;
+
+    freeAgingQueue( queue );
+    freePcbList( headProcess );
+    freeBenchContext( context );
+
+    return elapsed;
+}
+//
+// benchNextReadySelect Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function times the FCFS and RR pick of the next process
+ *
+ * @details This function builds a ring of PCBs from the workload with only
+ *          the last one ready, so each pick walks the ring as it does when
+ *          most processes are blocked.
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[out] ops the number of picks
+ *
+ * @return the nsec taken (long long)
+ */
+long long benchNextReadySelect( BenchState *state, long long *ops )
+{
+    int pick;
+    long long startTime, elapsed;
+    PCB *headProcess = NULL, *tailProcess;
+    SimContext *context = createBenchContext( state->cfData );
+
+    buildPcbList( context, &headProcess, state->workloadNode );
+    setStateRecursive( headProcess, BLOCKED );
+    tailProcess = getFinalProcess( headProcess );
+    tailProcess->state = READY;
+    tailProcess->nextProcess = headProcess;
+
+    startTime = getHostNanoSec();
+
+    for( pick = 0; pick < state->options.processes; pick++ )
+    {
+        if( getNextReadyProcess( headProcess ) != tailProcess )
+        {
+            break;
+        }
+    }
+
+    elapsed = getHostNanoSec() - startTime;
+    *ops = pick;
+
+    freePcbList( headProcess );
+    freeBenchContext( context );
+
+    return elapsed;
+}
+//
+// benchMmuAllocate Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function times allocate filling the MMU
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[out] ops the number of allocations
+ *
+ * @return the nsec taken (long long)
+ */
+long long benchMmuAllocate( BenchState *state, long long *ops )
+{
+    long long startTime, elapsed;
+    MMU *memoryManagementUnit = createMMU( state->cfData->memAvailable );
+
+    startTime = getHostNanoSec();
+    fillBenchMmu( state, memoryManagementUnit );
+    elapsed = getHostNanoSec() - startTime;
+
+    *ops = BENCH_MMU_TABLE_SIZE;
+
+    deallocate( memoryManagementUnit, 0 );
+    free( memoryManagementUnit );
+
+    return elapsed;
+}
+//
+// benchMmuAccess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function times accessMemory on a full MMU
+ *
+ * @details This function accesses a random allocation once for each op of
+ *          the workload.
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[out] ops the number of accesses
+ *
+ * @return the nsec taken (long long)
+ */
+long long benchMmuAccess( BenchState *state, long long *ops )
+{
+    long long access, accessCount, startTime, elapsed;
+    Memory memory;
+    MMU *memoryManagementUnit = createMMU( state->cfData->memAvailable );
+
+    fillBenchMmu( state, memoryManagementUnit );
+
+    accessCount = (long long) state->options.processes
+                * state->options.opsPerProcess;
+    memory.segment = 0;
+    memory.offset = 1;
+    memory.totalSize = 1;
+    memory.processesId = 0;
+    memory.nextNode = NULL;
+
+    startTime = getHostNanoSec();
+
+    for( access = 0; access < accessCount; access++ )
+    {
+        memory.startPosition = 3 * getBenchRandom( state,
+                                                   BENCH_MMU_TABLE_SIZE );
+        accessMemory( memoryManagementUnit, &memory );
+    }
+
+    elapsed = getHostNanoSec() - startTime;
+    *ops = accessCount;
+
+    deallocate( memoryManagementUnit, 0 );
+    free( memoryManagementUnit );
+
+    return elapsed;
+}
+//
+// fillBenchMmu Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function fills an MMU with non overlapping allocations
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[in,out] memoryManagementUnit a pointer to an empty MMU
+ *
+ * @return nothing to return (void)
+ */
+void fillBenchMmu( BenchState *state, MMU *memoryManagementUnit )
+{
+    int block;
+    Memory *memory;
+
+    for( block = 0; block < BENCH_MMU_TABLE_SIZE; block++ )
+    {
+        memory = malloc( sizeof( *memory ) );
+        memory->segment = 0;
+        memory->startPosition = 3 * block;
+        memory->offset = 1;
+        memory->totalSize = 1;
+        memory->processesId = 0;
+        memory->nextNode = NULL;
+
+        if( allocate( memoryManagementUnit, memory ) != 0 )
+        {
+            free( memory );
+        }
+    }
+}
+//
+// benchInterupts Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function times queueing and resolving I/O interupts
+ *
+ * @details This function queues batches of virtual clock interupts for
+ *          the processes of the workload, then moves the clock past them
+ *          and delivers and resolves the batch, until every op of the
+ *          workload has had one.
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[out] ops the number of interupts
+ *
+ * @return the nsec taken (long long)
+ */
+long long benchInterupts( BenchState *state, long long *ops )
+{
+    int batch, interupt;
+    long long startTime, elapsed, batchCount;
+    PCB *headProcess = NULL, *currentProcess;
+    SimContext *context = createBenchContext( state->cfData );
+
+    buildPcbList( context, &headProcess, state->workloadNode );
+    setStateRecursive( headProcess, BLOCKED );
+    getFinalProcess( headProcess )->nextProcess = headProcess;
+
+    batchCount = (long long) state->options.processes
+               * state->options.opsPerProcess / BENCH_INTERUPT_BATCH + 1;
+    currentProcess = headProcess;
+
+    startTime = getHostNanoSec();
+
+    for( batch = 0; batch < batchCount; batch++ )
+    {
+        for( interupt = 0; interupt < BENCH_INTERUPT_BATCH; interupt++ )
+        {
+            queueInterupt( createInterupt( context, currentProcess,
+                                           1 + getBenchRandom( state, 100 ),
+                                           "hard drive", "input" ) );
+            currentProcess = currentProcess->nextProcess;
+        }
+
+        advanceClock( &context->timer, 1000 );
+        deliverInterupts( context );
+        resolveInterupts( context );
+    }
+
+    elapsed = getHostNanoSec() - startTime;
+    *ops = batchCount * BENCH_INTERUPT_BATCH;
+
+    freePcbList( headProcess );
+    freeBenchContext( context );
+
+    return elapsed;
+}
+//
+// benchLogDiscarded Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function times logLine when the line is thrown away
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[out] ops the number of lines
+ *
+ * @return the nsec taken (long long)
+ */
+long long benchLogDiscarded( BenchState *state, long long *ops )
+{
+    return benchLogLines( state, "None", ops );
+}
+//
+// benchLogKept Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function times logLine when the line is kept for the file
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[out] ops the number of lines
+ *
+ * @return the nsec taken (long long)
+ */
+long long benchLogKept( BenchState *state, long long *ops )
+{
+    return benchLogLines( state, "File", ops );
+}
+//
+// benchLogLines Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function times logLine under a Log To setting
+ *
+ * @details This function logs one typical op line for each op of the
+ *          workload.
+ *
+ * @param[in,out] state a pointer to a BenchState struct
+ *
+ * @param[in] logTo a pointer to the Log To setting to use
+ *
+ * @param[out] ops the number of lines
+ *
+ * @return the nsec taken (long long)
+ */
+long long benchLogLines( BenchState *state, char *logTo, long long *ops )
+{
+    long long line, lineCount, startTime, elapsed;
+    ConfigData *cfData = createBenchConfig( "SJF-N", logTo );
+    SimContext *context = createBenchContext( cfData );
+
+    lineCount = (long long) state->options.processes
+              * state->options.opsPerProcess;
+
+    startTime = getHostNanoSec();
+
+    for( line = 0; line < lineCount; line++ )
+    {
+        logLine( context, "Time:%10.6lf, Process %d, %s %s start\n",
+                 line / 1000.0, (int) ( line % state->options.processes ),
+                 "hard drive", "input" );
+    }
+
+    elapsed = getHostNanoSec() - startTime;
+    *ops = lineCount;
+
+    freeBenchContext( context );
+    free( cfData );
+
+    return elapsed;
+}
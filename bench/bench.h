@@ -0,0 +1,143 @@
+// Bench Header Information ////////////////////////////////////////
+/**
+* @file bench.h
+*
+* @brief Header file for bench
+*
+* @details Specifies constants, simple data structures, included libraries,
+* and function declarations used in benchmarking the simulator
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of bench
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides a harness that times the parts of the simulator that
+  long runs spend their time in, each on its own: parsing metadata,
+  building PCBs, picking the next process, the MMU, the interupt queues and
+  logging. Workloads are generated in memory at the size asked for, each
+  benchmark is repeated, and the spread of the repeats is reported so that
+  regressions show up as numbers
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef BENCH_H
+#define BENCH_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "simIO.h"
+#include "processor.h"
+#include "memory.h"
+#include "histogram.h"
+#include "stringUtils.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+static const char BENCH_PROCESSES_OPTION[] = "--processes";
+static const char BENCH_OPS_OPTION[] = "--ops";
+static const char BENCH_REPS_OPTION[] = "--reps";
+static const char BENCH_SEED_OPTION[] = "--seed";
+static const char BENCH_ONLY_OPTION[] = "--only";
+
+// Allocations kept in the MMU at once. checkOverlap compares start and
+// offset without the segment, so only this many can fit side by side
+#define BENCH_MMU_TABLE_SIZE 300
+
+// Interupts queued before each drain, below INTERUPT_QUEUE_SIZE so the
+// queues never grow while timed
+#define BENCH_INTERUPT_BATCH 400
+
+// Characters of metadata text made for each op, with room to spare
+#define BENCH_CHARS_PER_OP 32
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+
+// Sizes of the generated workload and how often to repeat each benchmark
+typedef struct BenchOptions
+{
+  int processes;
+  int opsPerProcess;
+  int reps;
+  unsigned int seed;
+  // Only benchmarks whose name starts with this are run, NULL for all
+  char *only;
+} BenchOptions;
+
+// What every benchmark works on, made once before any is run
+typedef struct BenchState
+{
+  BenchOptions options;
+  char *workloadText;
+  size_t workloadLength;
+  MetaNode *workloadNode;
+  ConfigData *cfData;
+  unsigned int randomState;
+} BenchState;
+
+// Runs one repeat of a benchmark, returns the nsec taken by the timed part
+// and sets the number of ops it did
+typedef long long (*BenchFunction)( BenchState *state, long long *ops );
+
+typedef struct BenchCase
+{
+  char *name;
+  BenchFunction function;
+} BenchCase;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+int parseBenchArgs( int argc, char *argv[], BenchOptions *options );
+
+Boolean setupBench( BenchState *state );
+
+void freeBench( BenchState *state );
+
+char *generateBenchWorkload( BenchState *state, size_t *length );
+
+ConfigData *createBenchConfig( char *cpuSchedCode, char *logTo );
+
+SimContext *createBenchContext( ConfigData *cfData );
+
+void freeBenchContext( SimContext *context );
+
+unsigned int getBenchRandom( BenchState *state, unsigned int range );
+
+void runBenchCase( BenchState *state, BenchCase *benchCase );
+
+long long benchParse( BenchState *state, long long *ops );
+
+long long benchPcbBuild( BenchState *state, long long *ops );
+
+long long benchShortestSelect( BenchState *state, long long *ops );
+
+long long benchNextReadySelect( BenchState *state, long long *ops );
+
+long long benchMmuAllocate( BenchState *state, long long *ops );
+
+long long benchMmuAccess( BenchState *state, long long *ops );
+
+long long benchInterupts( BenchState *state, long long *ops );
+
+long long benchLogDiscarded( BenchState *state, long long *ops );
+
+long long benchLogKept( BenchState *state, long long *ops );
+
+long long benchLogLines( BenchState *state, char *logTo, long long *ops );
+
+void fillBenchMmu( BenchState *state, MMU *memoryManagementUnit );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // BENCH_H
+//
@@ -0,0 +1,864 @@
+// Generator Implementation File Information ///////////////////////////////
+/**
+* @file generator.c
+*
+* @brief Implementation for generator
+*
+* @details Implements the synthetic metadata generator built as simgen
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of generator
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* Each process allocates in its own slot of the address space, so only the
+* asked for fault percent of memory ops fail
+*
+* @note Requires generator.h
+*/
+
+#include "generator.h"
+
+int main( int argc, char *argv[] )
+{
+    FILE *filePointer = stdout;
+    GeneratorOptions options;
+    GeneratorTotals totals = { { 0 }, 0, 0, 0 };
+    unsigned long long randomState;
+
+    if( parseGeneratorArgs( argc, argv, &options ) != 0 )
+    {
+        fprintf( stderr,
+                 "Usage: %s [%s N] [%s N] [%s N] [%s R,I,O,M] [%s HD,KB]\n" \
+                 "       [%s HD,PR,MO] [%s DIST] [%s DIST] [%s DIST]\n" \
+                 "       [%s none|local|scattered] [%s PERCENT] [%s FILE]\n" \
+                 "DIST is fixed:N, exp:MEAN, pareto:MIN:ALPHA or " \
+                 "bimodal:SHORT:LONG:PERCENT_LONG\n",
+                 argv[ 0 ], GENERATOR_PROCESSES_OPTION, GENERATOR_OPS_OPTION,
+                 GENERATOR_SEED_OPTION, GENERATOR_MIX_OPTION,
+                 GENERATOR_INPUTS_OPTION, GENERATOR_OUTPUTS_OPTION,
+                 GENERATOR_CPU_BURST_OPTION, GENERATOR_IO_BURST_OPTION,
+                 GENERATOR_ARRIVAL_OPTION, GENERATOR_MEMORY_OPTION,
+                 GENERATOR_FAULTS_OPTION, GENERATOR_OUT_OPTION );
+        return EXIT_FAILURE;
+    }
+
+    if( options.outPath != NULL )
+    {
+        filePointer = fopen( options.outPath, "w" );
+
+        if( filePointer == NULL )
+        {
+            fprintf( stderr, "Unable to open %s\n", options.outPath );
+            return EXIT_FAILURE;
+        }
+    }
+
+    randomState = options.seed;
+    writeWorkload( filePointer, &options, &totals, &randomState );
+
+    if( filePointer != stdout )
+    {
+        fclose( filePointer );
+    }
+    else
+    {
+        fflush( filePointer );
+    }
+
+    fprintf( stderr,
+             "Generated %d processes: %lld run, %lld input, %lld output, " \
+             "%lld memory ops\n" \
+             "CPU cycles %lld, I/O cycles %lld, last arrival %lld msec\n",
+             options.processes, totals.ops[ RUN_OP ], totals.ops[ INPUT_OP ],
+             totals.ops[ OUTPUT_OP ], totals.ops[ MEMORY_OP ],
+             totals.cpuCycles, totals.ioCycles, totals.lastArrival );
+
+    return EXIT_SUCCESS;
+}
+//
+// parseGeneratorArgs Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function reads the generator options
+ *
+ * @details This function fills in the options given on the command line,
+ *          every other option keeps its default.
+ *
+ * @exception badOption
+ *            If an option is unknown or its value cannot be read, print it
+ *            and return 1.
+ *
+ * @param[in] argc number of command line arguments
+ *
+ * @param[in] argv the command line arguments
+ *
+ * @param[out] options a pointer to a GeneratorOptions struct
+ *
+ * @return 0 for success, 1 for a bad option (int)
+ */
+int parseGeneratorArgs( int argc, char *argv[], GeneratorOptions *options )
+{
+    int iterator;
+    char *option, *value;
+    Boolean valid;
+
+    options->processes = 100;
+    options->opsPerProcess = 20;
+    options->seed = 1;
+    parseWeights( "50,20,20,10", options->opWeights, OP_KIND_COUNT );
+    parseWeights( "3,1", options->inputWeights, INPUT_DEVICE_COUNT );
+    parseWeights( "2,1,1", options->outputWeights, OUTPUT_DEVICE_COUNT );
+    parseBurstDistribution( "exp:10", &options->cpuBurst );
+    parseBurstDistribution( "exp:40", &options->ioBurst );
+    options->staggerArrivals = False;
+    options->memoryPattern = LOCAL_MEMORY;
+    options->faultPercent = 0;
+    options->outPath = NULL;
+
+    for( iterator = 1; iterator < argc; iterator += 2 )
+    {
+        option = argv[ iterator ];
+
+        if( iterator + 1 >= argc )
+        {
+            fprintf( stderr, "Missing value for %s\n", option );
+            return 1;
+        }
+
+        value = argv[ iterator + 1 ];
+        valid = True;
+
+        if( stringCmp( option, (char *) GENERATOR_PROCESSES_OPTION ) == True )
+        {
+            options->processes = stringToI( value );
+            valid = checkInt( value ) && options->processes > 0;
+        }
+        else if( stringCmp( option, (char *) GENERATOR_OPS_OPTION ) == True )
+        {
+            options->opsPerProcess = stringToI( value );
+            valid = checkInt( value ) && options->opsPerProcess > 0;
+        }
+        else if( stringCmp( option, (char *) GENERATOR_SEED_OPTION ) == True )
+        {
+            options->seed = strtoull( value, NULL, 10 );
+            valid = checkInt( value );
+        }
+        else if( stringCmp( option, (char *) GENERATOR_MIX_OPTION ) == True )
+        {
+            valid = parseWeights( value, options->opWeights, OP_KIND_COUNT );
+        }
+        else if( stringCmp( option, (char *) GENERATOR_INPUTS_OPTION ) == True )
+        {
+            valid = parseWeights( value, options->inputWeights,
+                                  INPUT_DEVICE_COUNT );
+        }
+        else if( stringCmp( option, (char *) GENERATOR_OUTPUTS_OPTION ) == True )
+        {
+            valid = parseWeights( value, options->outputWeights,
+                                  OUTPUT_DEVICE_COUNT );
+        }
+        else if( stringCmp( option,
+                            (char *) GENERATOR_CPU_BURST_OPTION ) == True )
+        {
+            valid = parseBurstDistribution( value, &options->cpuBurst );
+        }
+        else if( stringCmp( option,
+                            (char *) GENERATOR_IO_BURST_OPTION ) == True )
+        {
+            valid = parseBurstDistribution( value, &options->ioBurst );
+        }
+        else if( stringCmp( option,
+                            (char *) GENERATOR_ARRIVAL_OPTION ) == True )
+        {
+            valid = parseBurstDistribution( value, &options->arrivalGap );
+            options->staggerArrivals = True;
+        }
+        else if( stringCmp( option, (char *) GENERATOR_MEMORY_OPTION ) == True )
+        {
+            if( stringCmp( value, (char *) "none" ) == True )
+            {
+                options->memoryPattern = NO_MEMORY;
+            }
+            else if( stringCmp( value, (char *) "local" ) == True )
+            {
+                options->memoryPattern = LOCAL_MEMORY;
+            }
+            else if( stringCmp( value, (char *) "scattered" ) == True )
+            {
+                options->memoryPattern = SCATTERED_MEMORY;
+            }
+            else
+            {
+                valid = False;
+            }
+        }
+        else if( stringCmp( option, (char *) GENERATOR_FAULTS_OPTION ) == True )
+        {
+            options->faultPercent = stringToI( value );
+            valid = checkInt( value ) && options->faultPercent <= 100;
+        }
+        else if( stringCmp( option, (char *) GENERATOR_OUT_OPTION ) == True )
+        {
+            options->outPath = value;
+        }
+        else
+        {
+            fprintf( stderr, "Unknown option %s\n", option );
+            return 1;
+        }
+
+        if( valid == False )
+        {
+            fprintf( stderr, "Bad value for %s: %s\n", option, value );
+            return 1;
+        }
+    }
+
+    if( options->memoryPattern == NO_MEMORY )
+    {
+        options->opWeights[ MEMORY_OP ] = 0;
+    }
+
+    if( options->opWeights[ RUN_OP ] + options->opWeights[ INPUT_OP ]
+      + options->opWeights[ OUTPUT_OP ] + options->opWeights[ MEMORY_OP ] == 0 )
+    {
+        fprintf( stderr, "The op mix has no ops left to pick\n" );
+        return 1;
+    }
+
+    return 0;
+}
+//
+// parseBurstDistribution Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function reads a burst length distribution
+ *
+ * @details This function reads fixed:N, exp:MEAN, pareto:MIN:ALPHA or
+ *          bimodal:SHORT:LONG:PERCENT_LONG.
+ *
+ * @exception badDistribution
+ *            If the text is none of these, or a value is out of range,
+ *            return False and leave dist unchanged.
+ *
+ * @param[in] distStr a pointer to the text of the distribution
+ *
+ * @param[out] dist a pointer to a BurstDistribution struct
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean parseBurstDistribution( char *distStr, BurstDistribution *dist )
+{
+    BurstDistribution read = { FIXED_BURST, 0, 0, 0 };
+    char extra;
+
+    if( sscanf( distStr, "fixed:%lf%c", &read.first, &extra ) == 1 )
+    {
+        read.type = FIXED_BURST;
+    }
+    else if( sscanf( distStr, "exp:%lf%c", &read.first, &extra ) == 1 )
+    {
+        read.type = EXPONENTIAL_BURST;
+    }
+    else if( sscanf( distStr, "pareto:%lf:%lf%c",
+                     &read.first, &read.second, &extra ) == 2
+          && read.second > 0 )
+    {
+        read.type = PARETO_BURST;
+    }
+    else if( sscanf( distStr, "bimodal:%lf:%lf:%lf%c",
+                     &read.first, &read.second, &read.third, &extra ) == 3
+          && read.second > 0 && 0 <= read.third && read.third <= 100 )
+    {
+        read.type = BIMODAL_BURST;
+    }
+    else
+    {
+        return False;
+    }
+
+    if( read.first < 0 )
+    {
+        return False;
+    }
+
+    *dist = read;
+
+    return True;
+}
+//
+// parseWeights Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function reads a comma separated list of weights
+ *
+ * @exception badWeights
+ *            If there are not exactly weightCount whole numbers, or they
+ *            are all 0, return False.
+ *
+ * @param[in] weightStr a pointer to the text of the weights
+ *
+ * @param[out] weights a pointer to weightCount ints
+ *
+ * @param[in] weightCount the number of weights expected
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean parseWeights( char *weightStr, int *weights, int weightCount )
+{
+    int iterator = 0, weight = 0, total = 0;
+    Boolean hasDigit = False;
+
+    do
+    {
+        if( '0' <= *weightStr && *weightStr <= '9' )
+        {
+            weight = weight * 10 + ( *weightStr - '0' );
+            hasDigit = True;
+
+            if( weight > 1000000 )
+            {
+                return False;
+            }
+        }
+        else if( ( *weightStr == ',' || *weightStr == NULL_TERMINAL )
+              && hasDigit == True && iterator < weightCount )
+        {
+            weights[ iterator ] = weight;
+            total += weight;
+            iterator++;
+            weight = 0;
+            hasDigit = False;
+        }
+        else
+        {
+            return False;
+        }
+    }
+    while( *weightStr++ != NULL_TERMINAL );
+
+    return iterator == weightCount && total > 0;
+}
+//
+// writeWorkload Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes a whole metadata file
+ *
+ * @pre filePointer a pointer to a file open for writing
+ *
+ * @post the metadata is written at post
+ *
+ * @param[in] filePointer a pointer to a file
+ *
+ * @param[in] options a pointer to a GeneratorOptions struct
+ *
+ * @param[in,out] totals a pointer to a GeneratorTotals struct
+ *
+ * @param[in,out] randomState a pointer to the state of the generator
+ *
+ * @return nothing to return (void)
+ */
+void writeWorkload( FILE *filePointer,
+                    GeneratorOptions *options,
+                    GeneratorTotals *totals,
+                    unsigned long long *randomState )
+{
+    int process;
+
+    fprintf( filePointer, "Start Program Meta-Data Code:\nS(start)0;\n\n" );
+
+    for( process = 0; process < options->processes; process++ )
+    {
+        writeProcess( filePointer, options, totals, process, randomState );
+    }
+
+    fprintf( filePointer, "S(end)0.\nEnd Program Meta-Data Code.\n" );
+}
+//
+// writeProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes one A(start) block
+ *
+ * @details This function writes the start of the process, with its arrival
+ *          time if arrivals are staggered, then its ops in the mix asked
+ *          for and its end.
+ *
+ * @par Algorithm
+ *      Arrivals are the sum of the gaps so far, so they are in order as
+ *      streamed workloads need. With a memory pattern the first op
+ *      allocates a block in the slot of the process, so accesses have
+ *      something to hit.
+ *
+ * @pre filePointer a pointer to a file open for writing
+ *
+ * @post the process is written at post
+ *
+ * @param[in] filePointer a pointer to a file
+ *
+ * @param[in] options a pointer to a GeneratorOptions struct
+ *
+ * @param[in,out] totals a pointer to a GeneratorTotals struct
+ *
+ * @param[in] process the number of the process, from 0
+ *
+ * @param[in,out] randomState a pointer to the state of the generator
+ *
+ * @return nothing to return (void)
+ */
+void writeProcess( FILE *filePointer,
+                   GeneratorOptions *options,
+                   GeneratorTotals *totals,
+                   int process,
+                   unsigned long long *randomState )
+{
+    char *inputDevices[ INPUT_DEVICE_COUNT ] = { "hard drive", "keyboard" };
+    char *outputDevices[ OUTPUT_DEVICE_COUNT ]
+                                  = { "hard drive", "printer", "monitor" };
+    char opStr[ 64 ];
+    int op, kind, cycles, blockCount = 0;
+    GeneratorBlock blocks[ GENERATOR_MAX_BLOCKS ];
+    GeneratorSlot slot = getProcessSlot( options, process );
+
+    if( options->staggerArrivals == True )
+    {
+        totals->lastArrival += sampleBurst( &options->arrivalGap,
+                                            randomState );
+        fprintf( filePointer, "A(start)@%lld;\n", totals->lastArrival );
+    }
+    else
+    {
+        fprintf( filePointer, "A(start)0;\n" );
+    }
+
+    for( op = 0; op < options->opsPerProcess; op++ )
+    {
+        kind = pickWeighted( options->opWeights, OP_KIND_COUNT, randomState );
+
+        if( op == 0 && options->memoryPattern != NO_MEMORY )
+        {
+            kind = MEMORY_OP;
+        }
+
+        if( kind == RUN_OP )
+        {
+            cycles = sampleBurst( &options->cpuBurst, randomState );
+            sprintf( opStr, "P(run)%d;", cycles );
+            totals->cpuCycles += cycles;
+        }
+        else if( kind == INPUT_OP || kind == OUTPUT_OP )
+        {
+            cycles = sampleBurst( &options->ioBurst, randomState );
+            totals->ioCycles += cycles;
+
+            if( kind == INPUT_OP )
+            {
+                sprintf( opStr, "I(%s)%d;",
+                         inputDevices[ pickWeighted( options->inputWeights,
+                                                     INPUT_DEVICE_COUNT,
+                                                     randomState ) ],
+                         cycles );
+            }
+            else
+            {
+                sprintf( opStr, "O(%s)%d;",
+                         outputDevices[ pickWeighted( options->outputWeights,
+                                                      OUTPUT_DEVICE_COUNT,
+                                                      randomState ) ],
+                         cycles );
+            }
+        }
+        else
+        {
+            writeMemoryOp( opStr, options, &slot, blocks, &blockCount,
+                           randomState );
+        }
+
+        totals->ops[ kind ]++;
+
+        fprintf( filePointer, "%s%s", op % GENERATOR_OPS_PER_LINE == 0
+                                      ? "" : " ", opStr );
+
+        if( op % GENERATOR_OPS_PER_LINE == GENERATOR_OPS_PER_LINE - 1
+         || op == options->opsPerProcess - 1 )
+        {
+            fprintf( filePointer, "\n" );
+        }
+    }
+
+    fprintf( filePointer, "A(end)0;\n\n" );
+}
+//
+// getProcessSlot Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function finds the slot of the address space a process
+ *        allocates in
+ *
+ * @details The start positions are split evenly between the processes, at
+ *          least one each, and the process gets a segment from its number.
+ *
+ * @par Algorithm
+ *      With more processes than start positions the slots are reused in
+ *      turn, so only processes GENERATOR_ADDRESS_RANGE apart share one and
+ *      can collide if both are live.
+ *
+ * @param[in] options a pointer to a GeneratorOptions struct
+ *
+ * @param[in] process the number of the process, from 0
+ *
+ * @return the slot of the process (GeneratorSlot)
+ */
+GeneratorSlot getProcessSlot( GeneratorOptions *options, int process )
+{
+    GeneratorSlot slot;
+    int width = GENERATOR_ADDRESS_RANGE / options->processes;
+
+    if( width < 1 )
+    {
+        width = 1;
+    }
+
+    slot.segment = process % GENERATOR_SEGMENT_COUNT;
+    slot.nextStart = process % ( GENERATOR_ADDRESS_RANGE / width ) * width;
+    slot.last = slot.nextStart + width - 1;
+
+    return slot;
+}
+//
+// writeMemoryOp Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function makes the text of one memory op
+ *
+ * @details This function allocates the first block of a process, then
+ *          makes accesses inside the blocks the process owns. The scattered
+ *          pattern also allocates more blocks as it goes, while its slot
+ *          has room.
+ *
+ * @par Algorithm
+ *      Accesses pick a block and an address range inside it. The asked for
+ *      percent of accesses instead go to a random address in another
+ *      segment, which the MMU always faults on.
+ *
+ * @pre opStr a pointer to at least 32 chars
+ *
+ * @post blocks holds any new block at post
+ *
+ * @param[out] opStr a pointer to the op text
+ *
+ * @param[in] options a pointer to a GeneratorOptions struct
+ *
+ * @param[in,out] slot a pointer to the slot of the process
+ *
+ * @param[in,out] blocks a pointer to the blocks of the process
+ *
+ * @param[in,out] blockCount a pointer to the number of blocks
+ *
+ * @param[in,out] randomState a pointer to the state of the generator
+ *
+ * @return the encoded address of the op (int)
+ */
+int writeMemoryOp( char *opStr,
+                   GeneratorOptions *options,
+                   GeneratorSlot *slot,
+                   GeneratorBlock *blocks,
+                   int *blockCount,
+                   unsigned long long *randomState )
+{
+    int address, start, offset;
+    GeneratorBlock *block = &blocks[ *blockCount ];
+
+    if( ( *blockCount == 0
+       || ( options->memoryPattern == SCATTERED_MEMORY
+         && *blockCount < GENERATOR_MAX_BLOCKS
+         && getRandomInt( randomState, 100 ) < 30 ) )
+     && makeBlock( options, slot, block, randomState ) == True )
+    {
+        ( *blockCount )++;
+
+        address = encodeAddress( block->segment, block->start, block->size );
+        sprintf( opStr, "M(allocate)%d;", address );
+
+        return address;
+    }
+
+    if( getRandomInt( randomState, 100 ) < options->faultPercent )
+    {
+        address = encodeAddress( ( slot->segment + 1
+                                   + getRandomInt( randomState,
+                                                   GENERATOR_SEGMENT_COUNT - 1 ) )
+                                 % GENERATOR_SEGMENT_COUNT,
+                                 getRandomInt( randomState,
+                                               GENERATOR_ADDRESS_RANGE ),
+                                 getRandomInt( randomState,
+                                               GENERATOR_ADDRESS_RANGE ) );
+    }
+    else
+    {
+        block = &blocks[ getRandomInt( randomState, *blockCount ) ];
+        start = block->start + getRandomInt( randomState, block->size + 1 );
+        offset = getRandomInt( randomState,
+                               block->start + block->size - start + 1 );
+        address = encodeAddress( block->segment, start, offset );
+    }
+
+    sprintf( opStr, "M(access)%d;", address );
+
+    return address;
+}
+//
+// makeBlock Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function picks where a new block of memory goes
+ *
+ * @details The block is 10 to 99 positions, less if the slot of the
+ *          process has less room, and starts after every block the process
+ *          already has.
+ *
+ * @par Algorithm
+ *      A block covers its start through start plus size, and the MMU counts
+ *      touching ends as an overlap, so the next block starts one past its
+ *      end. The scattered pattern keeps at least half of the room left for
+ *      the blocks after it.
+ *
+ * @post slot holds the start positions left at post
+ *
+ * @param[in] options a pointer to a GeneratorOptions struct
+ *
+ * @param[in,out] slot a pointer to the slot of the process
+ *
+ * @param[out] block a pointer to the new block
+ *
+ * @param[in,out] randomState a pointer to the state of the generator
+ *
+ * @return False if the slot is full, True otherwise (Boolean)
+ */
+Boolean makeBlock( GeneratorOptions *options,
+                   GeneratorSlot *slot,
+                   GeneratorBlock *block,
+                   unsigned long long *randomState )
+{
+    int room = slot->last - slot->nextStart + 1, largest = room - 1;
+
+    if( room < 1 )
+    {
+        return False;
+    }
+
+    if( options->memoryPattern == SCATTERED_MEMORY )
+    {
+        largest = ( room - 1 ) / 2;
+    }
+
+    block->segment = slot->segment;
+    block->size = 10 + getRandomInt( randomState, 90 );
+
+    if( block->size > largest )
+    {
+        block->size = largest;
+    }
+
+    if( options->memoryPattern == SCATTERED_MEMORY )
+    {
+        block->start = slot->nextStart
+                     + getRandomInt( randomState,
+                                     ( room - block->size ) / 2 + 1 );
+    }
+    else
+    {
+        block->start = slot->nextStart
+                     + getRandomInt( randomState, room - block->size );
+    }
+
+    slot->nextStart = block->start + block->size + 1;
+
+    return True;
+}
+//
+// encodeAddress Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function encodes a memory op value as the MMU reads it
+ *
+ * @param[in] segment the segment, 0 to 999
+ *
+ * @param[in] start the start position, 0 to 999
+ *
+ * @param[in] offset the offset, 0 to 999
+ *
+ * @return the cycle time of the memory op (int)
+ */
+int encodeAddress( int segment, int start, int offset )
+{
+    return segment * 1000000 + start * 1000 + offset;
+}
+//
+// sampleBurst Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function draws a burst length from a distribution
+ *
+ * @details This function draws a length and rounds it to a whole number of
+ *          cycles from 1 to GENERATOR_MAX_CYCLES.
+ *
+ * @par Algorithm
+ *      Exponential and Pareto lengths are drawn by inverting their CDF at a
+ *      uniform number. Bimodal lengths are exponential around the long
+ *      mean the given percent of the time, around the short mean otherwise.
+ *
+ * @param[in] dist a pointer to a BurstDistribution struct
+ *
+ * @param[in,out] randomState a pointer to the state of the generator
+ *
+ * @return the burst length in cycles (int)
+ */
+int sampleBurst( BurstDistribution *dist, unsigned long long *randomState )
+{
+    double length, unit = getRandomUnit( randomState );
+
+    switch( dist->type )
+    {
+        case EXPONENTIAL_BURST:
+            length = -dist->first * log( unit );
+            break;
+
+        case PARETO_BURST:
+            length = dist->first / pow( unit, 1.0 / dist->second );
+            break;
+
+        case BIMODAL_BURST:
+            length = getRandomUnit( randomState ) * 100 <= dist->third
+                   ? -dist->second * log( unit )
+                   : -dist->first * log( unit );
+            break;
+
+        default:
+            length = dist->first;
+            break;
+    }
+
+    if( length < 1 )
+    {
+        return 1;
+    }
+
+    if( length > GENERATOR_MAX_CYCLES )
+    {
+        return GENERATOR_MAX_CYCLES;
+    }
+
+    return (int) ( length + 0.5 );
+}
+//
+// pickWeighted Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function picks an index with chance in proportion to weight
+ *
+ * @pre weights holds at least one weight above 0
+ *
+ * @param[in] weights a pointer to weightCount ints
+ *
+ * @param[in] weightCount the number of weights
+ *
+ * @param[in,out] randomState a pointer to the state of the generator
+ *
+ * @return the index picked (int)
+ */
+int pickWeighted( int *weights, int weightCount,
+                  unsigned long long *randomState )
+{
+    int index, total = 0, pick;
+
+    for( index = 0; index < weightCount; index++ )
+    {
+        total += weights[ index ];
+    }
+
+    pick = getRandomInt( randomState, total );
+
+    for( index = 0; index < weightCount - 1; index++ )
+    {
+        if( pick < weights[ index ] )
+        {
+            break;
+        }
+
+        pick -= weights[ index ];
+    }
+
+    return index;
+}
+//
+// getRandom Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the next seeded random number
+ *
+ * @details This function uses splitmix64, so files do not depend on the C
+ *          library and are the same for the same seed on every host.
+ *
+ * @param[in,out] randomState a pointer to the state of the generator
+ *
+ * @return 64 random bits (unsigned long long)
+ */
+unsigned long long getRandom( unsigned long long *randomState )
+{
+    unsigned long long value;
+
+    *randomState += 0x9E3779B97F4A7C15ULL;
+    value = *randomState;
+    value = ( value ^ ( value >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    value = ( value ^ ( value >> 27 ) ) * 0x94D049BB133111EBULL;
+
+    return value ^ ( value >> 31 );
+}
+//
+// getRandomUnit Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets a seeded random number above 0, up to 1
+ *
+ * @param[in,out] randomState a pointer to the state of the generator
+ *
+ * @return a number in (0, 1] (double)
+ */
+double getRandomUnit( unsigned long long *randomState )
+{
+    return ( ( getRandom( randomState ) >> 11 ) + 1.0 ) / 9007199254740992.0;
+}
+//
+// getRandomInt Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets a seeded random whole number
+ *
+ * @param[in,out] randomState a pointer to the state of the generator
+ *
+ * @param[in] range one more than the largest number wanted
+ *
+ * @return a number from 0 to range - 1 (int)
+ */
+int getRandomInt( unsigned long long *randomState, int range )
+{
+    return (int) ( getRandom( randomState ) % (unsigned long long) range );
+}
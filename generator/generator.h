@@ -0,0 +1,193 @@
+// Generator Header Information ////////////////////////////////////////
+/**
+* @file generator.h
+*
+* @brief Header file for generator
+*
+* @details Specifies constants, simple data structures, included libraries,
+* and function declarations used in generating metadata files
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of generator
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* Each process allocates in its own slot of the address space, so only the
+* asked for fault percent of memory ops fail
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides a tool that writes synthetic metadata files of any
+  size. The mix of ops, the I/O devices used, the lengths of CPU and I/O
+  bursts, how processes use memory and when they arrive are all set on the
+  command line, and a seed makes every file repeatable. The file is written
+  as it is generated, so workloads with millions of ops need no memory
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef GENERATOR_H
+#define GENERATOR_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "stringUtils.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+static const char GENERATOR_PROCESSES_OPTION[] = "--processes";
+static const char GENERATOR_OPS_OPTION[] = "--ops";
+static const char GENERATOR_SEED_OPTION[] = "--seed";
+static const char GENERATOR_MIX_OPTION[] = "--mix";
+static const char GENERATOR_INPUTS_OPTION[] = "--inputs";
+static const char GENERATOR_OUTPUTS_OPTION[] = "--outputs";
+static const char GENERATOR_CPU_BURST_OPTION[] = "--cpu-burst";
+static const char GENERATOR_IO_BURST_OPTION[] = "--io-burst";
+static const char GENERATOR_ARRIVAL_OPTION[] = "--arrival";
+static const char GENERATOR_MEMORY_OPTION[] = "--memory";
+static const char GENERATOR_FAULTS_OPTION[] = "--faults";
+static const char GENERATOR_OUT_OPTION[] = "--out";
+
+// Bursts are clamped to 1 up to this many cycles
+#define GENERATOR_MAX_CYCLES 100000
+
+// Memory addresses are encoded as segment, start and offset, each 0 to 999
+#define GENERATOR_ADDRESS_RANGE 1000
+
+// Segments a process can be given, accesses in another segment always fault
+#define GENERATOR_SEGMENT_COUNT 100
+
+// Blocks a process keeps track of for the scattered memory pattern
+#define GENERATOR_MAX_BLOCKS 16
+
+// Ops written on each line of the file
+#define GENERATOR_OPS_PER_LINE 4
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+typedef enum { FIXED_BURST, EXPONENTIAL_BURST, PARETO_BURST,
+               BIMODAL_BURST } BURST_TYPES;
+
+// fixed:N, exp:MEAN, pareto:MIN:ALPHA or bimodal:SHORT:LONG:PERCENT_LONG
+typedef struct BurstDistribution
+{
+  BURST_TYPES type;
+  double first;
+  double second;
+  double third;
+} BurstDistribution;
+
+typedef enum { NO_MEMORY, LOCAL_MEMORY, SCATTERED_MEMORY } MEMORY_PATTERNS;
+
+// Op kinds in the order of the --mix weights
+typedef enum { RUN_OP, INPUT_OP, OUTPUT_OP, MEMORY_OP,
+               OP_KIND_COUNT } OP_KINDS;
+
+#define INPUT_DEVICE_COUNT 2
+#define OUTPUT_DEVICE_COUNT 3
+
+typedef struct GeneratorOptions
+{
+  int processes;
+  int opsPerProcess;
+  unsigned long long seed;
+  int opWeights[ OP_KIND_COUNT ];
+  int inputWeights[ INPUT_DEVICE_COUNT ];
+  int outputWeights[ OUTPUT_DEVICE_COUNT ];
+  BurstDistribution cpuBurst;
+  BurstDistribution ioBurst;
+  // Gaps between arrivals in msec, all processes arrive at 0 if not set
+  Boolean staggerArrivals;
+  BurstDistribution arrivalGap;
+  MEMORY_PATTERNS memoryPattern;
+  // Percent of accesses made outside of every block the process owns
+  int faultPercent;
+  char *outPath;
+} GeneratorOptions;
+
+// A block of memory a generated process has allocated
+typedef struct GeneratorBlock
+{
+  int segment;
+  int start;
+  int size;
+} GeneratorBlock;
+
+// The start positions a generated process allocates its blocks in. The MMU
+// checks the blocks of every live process against each other whatever
+// their segment, so each process gets positions no other one uses
+typedef struct GeneratorSlot
+{
+  int segment;
+  // Lowest start position a new block can use, and the last position
+  int nextStart;
+  int last;
+} GeneratorSlot;
+
+// Counts of what was written, printed once the file is done
+typedef struct GeneratorTotals
+{
+  long long ops[ OP_KIND_COUNT ];
+  long long cpuCycles;
+  long long ioCycles;
+  long long lastArrival;
+} GeneratorTotals;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+int parseGeneratorArgs( int argc, char *argv[], GeneratorOptions *options );
+
+Boolean parseBurstDistribution( char *distStr, BurstDistribution *dist );
+
+Boolean parseWeights( char *weightStr, int *weights, int weightCount );
+
+void writeWorkload( FILE *filePointer,
+                    GeneratorOptions *options,
+                    GeneratorTotals *totals,
+                    unsigned long long *randomState );
+
+void writeProcess( FILE *filePointer,
+                   GeneratorOptions *options,
+                   GeneratorTotals *totals,
+                   int process,
+                   unsigned long long *randomState );
+
+GeneratorSlot getProcessSlot( GeneratorOptions *options, int process );
+
+int writeMemoryOp( char *opStr,
+                   GeneratorOptions *options,
+                   GeneratorSlot *slot,
+                   GeneratorBlock *blocks,
+                   int *blockCount,
+                   unsigned long long *randomState );
+
+Boolean makeBlock( GeneratorOptions *options,
+                   GeneratorSlot *slot,
+                   GeneratorBlock *block,
+                   unsigned long long *randomState );
+
+int encodeAddress( int segment, int start, int offset );
+
+int sampleBurst( BurstDistribution *dist, unsigned long long *randomState );
+
+int pickWeighted( int *weights, int weightCount,
+                  unsigned long long *randomState );
+
+unsigned long long getRandom( unsigned long long *randomState );
+
+double getRandomUnit( unsigned long long *randomState );
+
+int getRandomInt( unsigned long long *randomState, int range );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // GENERATOR_H
+//
@@ -4,7 +4,11 @@ int main( int argc, char *argv[] )
 {
     ConfigData *cfData = NULL;
     MetaNode *currentNode = NULL;
+    MetaStream *stream = NULL;
     StringNode *startNode = NULL;
+    SimContext *context = NULL;
+    Boolean sweepRun;
+    int exitCode;
 
     if( argc < 2 )
     {
@@ -14,24 +18,53 @@ int main( int argc, char *argv[] )
 
     cfData = getConfig( argv[argc - 1] );
 
-    if( cfData != NULL )
+    if( cfData == NULL )
     {
-        currentNode = getMetadata( cfData );
+        printf( "Bad config file: %s\n", argv[argc - 1] );
+        return EXIT_FAILURE;
+    }
+
+    sweepRun = checkSweepArgs( argc, argv );
+
+    if( cfData->streamWorkload == True && sweepRun == False )
+    {
+        stream = getMetadataStream( cfData );
     }
     else
     {
-        printf( "Bad config file: %s\n", argv[argc - 1] );
-        return EXIT_FAILURE;
+        currentNode = getMetadata( cfData );
     }
 
-    if( currentNode == NULL )
+    if( currentNode == NULL && stream == NULL )
     {
         printf( "Bad metadata file: %s\n", cfData->filePath );
         freeConfig( cfData );
         return EXIT_FAILURE;
     }
 
-    startNode = beginProcessing(currentNode, cfData);
+    if( sweepRun == True )
+    {
+        exitCode = runSweep( argc, argv, cfData, currentNode );
+        freeList( currentNode );
+        freeConfig( cfData );
+        return exitCode;
+    }
+
+    // kill -USR1 writes the runtime counters of the run to stderr
+    installCounterSignal();
+
+    context = createSimContext( cfData );
+
+    if( context == NULL )
+    {
+        printf( "Unable to set up the run\n" );
+        closeMetaStream( stream );
+        freeList( currentNode );
+        freeConfig( cfData );
+        return EXIT_FAILURE;
+    }
+
+    startNode = beginProcessing(context, currentNode, stream);
 
     if( stringCmp(cfData->logTo, "File") == True
      || stringCmp(cfData->logTo, "Both") == True )
@@ -40,6 +73,8 @@ int main( int argc, char *argv[] )
     }
 
     freeStringList( startNode );
+    freeSimContext( context );
+    closeMetaStream( stream );
     freeList( currentNode );
     freeConfig( cfData );
 
@@ -5,5 +5,6 @@
 #include <stdlib.h>
 #include "simIO.h"
 #include "processor.h"
+#include "sweep.h"
 
 #endif
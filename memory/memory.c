@@ -11,6 +11,10 @@
 * C.S student (26 March 2018)
 * Initial creation of memory
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Renamed access to accessMemory so it does not clash with POSIX access
+*
 * @note Requires memory.h
 */
 
@@ -87,7 +91,7 @@ void createMemory( MetaNode *memoryNode, Memory *memory, int processesId )
     memory->nextNode = NULL;
 }
 //
-// access Function Implementation ///////////////////////////////////
+// accessMemory Function Implementation ///////////////////////////////////
 //
 /**
  * @brief This function accesses a given position in memory
@@ -108,7 +112,7 @@ void createMemory( MetaNode *memoryNode, Memory *memory, int processesId )
  *
  * @return Code for accessing status (int)
  */
-int access( MMU *memoryManagementUnit, Memory *memoryNode )
+int accessMemory( MMU *memoryManagementUnit, Memory *memoryNode )
 {
   Memory *headMemory = memoryManagementUnit->headMemory;
   int headLow, headHigh, nodeLow, nodeHigh;
@@ -11,6 +11,10 @@
 * C.S student (26 March 2018)
 * Initial creation of memory
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Renamed access to accessMemory so it does not clash with POSIX access
+*
 * @note None
 */
 
@@ -63,7 +67,7 @@ MMU *createMMU( int memSize );
 
 void createMemory( MetaNode *memoryNode, Memory *memory, int processesId );
 
-int access( MMU *memoryManagementUnit, Memory *memoryNode );
+int accessMemory( MMU *memoryManagementUnit, Memory *memoryNode );
 
 int allocate( MMU *memoryManagementUnit, Memory *memoryNode );
 
@@ -0,0 +1,337 @@
+// Aging Implementation File Information ///////////////////////////////
+/**
+* @file aging.c
+*
+* @brief Implementation for aging
+*
+* @details Implements all functions for the SJF-N and SRTF-P ready queue
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of aging
+*
+* @note Requires aging.h
+*/
+
+#include "aging.h"
+
+//
+// createAgingQueue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function creates an empty SJF-N or SRTF-P ready queue
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @post cfData remains unchanged at post
+ *
+ * @param[in] cfData a pointer to a ConfigData struct
+ *
+ * @return a pointer to the new ready queue (AgingQueue *)
+ */
+AgingQueue *createAgingQueue( ConfigData *cfData )
+{
+    AgingQueue *queue = malloc( sizeof( *queue ) );
+
+    queue->bucketCount = AGING_START_BUCKETS;
+    queue->buckets = calloc( queue->bucketCount, sizeof( PCB * ) );
+    queue->bucketWidth = (long long) cfData->processorCycleTime
+                       * AGING_BUCKET_CYCLES * AGING_KEY_SCALE;
+    queue->lowestKey = 0;
+    queue->readyCount = 0;
+    queue->agingRate = cfData->agingRate;
+    queue->predicted = cfData->burstPrediction;
+
+    if( queue->bucketWidth <= 0 )
+    {
+        queue->bucketWidth = AGING_KEY_SCALE;
+    }
+
+    return queue;
+}
+//
+// freeAgingQueue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees a ready queue, the PCBs in it are not freed
+ *
+ * @param[in] queue a pointer to an AgingQueue struct
+ *
+ * @return nothing to return (void)
+ */
+void freeAgingQueue( AgingQueue *queue )
+{
+    free( queue->buckets );
+    free( queue );
+}
+//
+// getAgingKey Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the key of a process becoming ready
+ *
+ * @details The aged time of a ready process at time t is its time less
+ *          rate * ( t - readyTime ), which is this key less rate * t, so
+ *          the key orders ready processes the same way at any time.
+ *
+ * @pre process a pointer to a PCB whose metrics hold the time it became
+ *      ready
+ *
+ * @param[in] queue a pointer to an AgingQueue struct
+ *
+ * @param[in] process a pointer to a PCB struct
+ *
+ * @return the time plus the aging rate times the ready time, in usec
+ *         (long long)
+ */
+long long getAgingKey( AgingQueue *queue, PCB *process )
+{
+    double baseTime = process->processTime;
+
+    if( queue->predicted == True )
+    {
+        baseTime = getPredictedTime( process );
+    }
+
+    return (long long) ( ( baseTime + queue->agingRate / 100.0
+                                    * process->metrics.stateTime )
+                       * AGING_KEY_SCALE );
+}
+//
+// queueAgingProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds a ready process to the ready queue
+ *
+ * @pre process a pointer to a PCB that is not in the ready queue
+ *
+ * @param[in,out] queue a pointer to an AgingQueue struct
+ *
+ * @param[in,out] process a pointer to a PCB struct
+ *
+ * @return nothing to return (void)
+ */
+void queueAgingProcess( AgingQueue *queue, PCB *process )
+{
+    process->agingKey = getAgingKey( queue, process );
+
+    if( queue->readyCount == 0 || process->agingKey < queue->lowestKey )
+    {
+        queue->lowestKey = process->agingKey;
+    }
+
+    insertAgingBucket( queue, process );
+    queue->readyCount++;
+
+    if( queue->readyCount > queue->bucketCount * AGING_BUCKET_LOAD )
+    {
+        growAgingQueue( queue );
+    }
+}
+//
+// takeAgingProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function takes the process with the least key from the queue
+ *
+ * @details Processes with the same key are taken by process number, as the
+ *          first one listed was taken before the queue was kept.
+ *
+ * @par Algorithm
+ *      Starting at the bucket of the lowest key, each bucket is checked for
+ *      a first key inside the range the bucket holds on this lap of the
+ *      ring. The first one found is the least, as no key is lower than the
+ *      lowest key. If a whole lap finds none, the keys are spread out and
+ *      the first of every bucket is compared instead.
+ *
+ * @param[in,out] queue a pointer to an AgingQueue struct
+ *
+ * @return the process, or NULL if no process is ready (PCB *)
+ */
+PCB *takeAgingProcess( AgingQueue *queue )
+{
+    long long slot = getAgingSlot( queue, queue->lowestKey );
+    int lap, index, bestIndex = -1;
+    PCB *process;
+
+    if( queue->readyCount == 0 )
+    {
+        return NULL;
+    }
+
+    for( lap = 0; lap < queue->bucketCount && bestIndex == -1; lap++ )
+    {
+        index = getAgingBucket( queue, slot + lap );
+        process = queue->buckets[ index ];
+
+        if( process != NULL
+         && process->agingKey < ( slot + lap + 1 ) * queue->bucketWidth )
+        {
+            bestIndex = index;
+        }
+    }
+
+    // A whole lap found none, so compare the first of every bucket
+    if( bestIndex == -1 )
+    {
+        for( index = 0; index < queue->bucketCount; index++ )
+        {
+            if( queue->buckets[ index ] != NULL
+             && ( bestIndex == -1
+               || checkAgingBefore( queue->buckets[ index ],
+                                    queue->buckets[ bestIndex ] ) == True ) )
+            {
+                bestIndex = index;
+            }
+        }
+    }
+
+    process = queue->buckets[ bestIndex ];
+    queue->buckets[ bestIndex ] = process->nextQueued;
+    process->nextQueued = NULL;
+    queue->lowestKey = process->agingKey;
+    queue->readyCount--;
+
+    return process;
+}
+//
+// getAgingSlot Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the range of keys a key falls in
+ *
+ * @param[in] queue a pointer to an AgingQueue struct
+ *
+ * @param[in] key a key in usec
+ *
+ * @return the key over the bucket width rounded down, its bucket is this
+ *         modulo the bucket count (long long)
+ */
+long long getAgingSlot( AgingQueue *queue, long long key )
+{
+    long long slot = key / queue->bucketWidth;
+
+    if( key % queue->bucketWidth < 0 )
+    {
+        slot--;
+    }
+
+    return slot;
+}
+//
+// getAgingBucket Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the bucket of a range of keys
+ *
+ * @param[in] queue a pointer to an AgingQueue struct
+ *
+ * @param[in] slot a range of keys from getAgingSlot
+ *
+ * @return the index of the bucket in the ring (int)
+ */
+int getAgingBucket( AgingQueue *queue, long long slot )
+{
+    int index = (int) ( slot % queue->bucketCount );
+
+    if( index < 0 )
+    {
+        index += queue->bucketCount;
+    }
+
+    return index;
+}
+//
+// checkAgingBefore Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if one process comes before another in the
+ *        ready queue
+ *
+ * @param[in] first a pointer to a PCB struct
+ *
+ * @param[in] second a pointer to a PCB struct
+ *
+ * @return True if first comes before second, False otherwise (Boolean)
+ */
+Boolean checkAgingBefore( PCB *first, PCB *second )
+{
+    if( first->agingKey < second->agingKey
+     || ( first->agingKey == second->agingKey
+       && first->processNum < second->processNum ) )
+    {
+        return True;
+    }
+
+    return False;
+}
+//
+// insertAgingBucket Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds a process to its bucket in key order
+ *
+ * @param[in,out] queue a pointer to an AgingQueue struct
+ *
+ * @param[in,out] process a pointer to a PCB struct with its key set
+ *
+ * @return nothing to return (void)
+ */
+void insertAgingBucket( AgingQueue *queue, PCB *process )
+{
+    PCB **link = &queue->buckets[ getAgingBucket( queue,
+                                      getAgingSlot( queue,
+                                                    process->agingKey ) ) ];
+
+    while( *link != NULL && checkAgingBefore( *link, process ) == True )
+    {
+        link = &( *link )->nextQueued;
+    }
+
+    process->nextQueued = *link;
+    *link = process;
+}
+//
+// growAgingQueue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function doubles the buckets of the ring
+ *
+ * @details Every ready process is moved to its bucket in the new ring, so
+ *          growing is O(n) and happens O(log n) times in a run.
+ *
+ * @param[in,out] queue a pointer to an AgingQueue struct
+ *
+ * @return nothing to return (void)
+ */
+void growAgingQueue( AgingQueue *queue )
+{
+    PCB **oldBuckets = queue->buckets;
+    PCB *process, *nextProcess;
+    int oldCount = queue->bucketCount, index;
+
+    queue->bucketCount *= 2;
+    queue->buckets = calloc( queue->bucketCount, sizeof( PCB * ) );
+
+    for( index = 0; index < oldCount; index++ )
+    {
+        for( process = oldBuckets[ index ]; process != NULL;
+             process = nextProcess )
+        {
+            nextProcess = process->nextQueued;
+            insertAgingBucket( queue, process );
+        }
+    }
+
+    free( oldBuckets );
+}
@@ -0,0 +1,101 @@
+// Aging Header Information ////////////////////////////////////////
+/**
+* @file aging.h
+*
+* @brief Header file for aging
+*
+* @details Specifies constants, simple data structures, included libraries,
+*          and function declarations used in the SJF-N and SRTF-P ready
+*          queue
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of aging
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides the ready queue of the shortest job schedulers. A
+  process is picked by its time, the process time or the predicted CPU
+  burst, less the Aging Rate percent of the msec it has waited in the Ready
+  state, so a long job that keeps losing to short ones is picked in the end.
+
+  The aged time changes as the clock moves, but by the same amount for
+  every ready process, so the order only depends on the time plus the rate
+  times the moment the process became ready. That key is fixed while the
+  process waits, and is kept in a calendar queue: a ring of buckets each
+  holding a range of keys in order. Keys only move forward in small steps,
+  so taking the next process looks at a few buckets from the last key taken
+  and adding one is O(1) on average, instead of walking every PCB
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef AGING_H
+#define AGING_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include "processor.h"
+#include "configParser.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+
+// Buckets of the ring before it grows, and the ready processes per bucket
+// that make it grow
+#define AGING_START_BUCKETS 64
+#define AGING_BUCKET_LOAD 2
+
+// Keys are kept in usec so fractions of a msec still order processes
+#define AGING_KEY_SCALE 1000
+
+// Processor cycles of key each bucket holds
+#define AGING_BUCKET_CYCLES 10
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+typedef struct AgingQueue
+{
+  // Ring of buckets, each a list of ready PCBs by key, least first
+  struct PCB **buckets;
+  int bucketCount;
+  long long bucketWidth;
+  // No ready process has a lesser key, where the next search starts
+  long long lowestKey;
+  int readyCount;
+  int agingRate;
+  // True if processes are picked by predicted CPU burst
+  Boolean predicted;
+} AgingQueue;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+AgingQueue *createAgingQueue( ConfigData *cfData );
+
+void freeAgingQueue( AgingQueue *queue );
+
+long long getAgingKey( AgingQueue *queue, struct PCB *process );
+
+void queueAgingProcess( AgingQueue *queue, struct PCB *process );
+
+struct PCB *takeAgingProcess( AgingQueue *queue );
+
+long long getAgingSlot( AgingQueue *queue, long long key );
+
+int getAgingBucket( AgingQueue *queue, long long slot );
+
+Boolean checkAgingBefore( struct PCB *first, struct PCB *second );
+
+void insertAgingBucket( AgingQueue *queue, struct PCB *process );
+
+void growAgingQueue( AgingQueue *queue );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // AGING_H
+//
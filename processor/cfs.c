@@ -0,0 +1,687 @@
+// Cfs Implementation File Information ///////////////////////////////
+/**
+* @file cfs.c
+*
+* @brief Implementation for cfs
+*
+* @details Implements all functions for the CFS-P ready tree
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of cfs
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* The slice left is kept and charged by the processor like any other
+* quantum
+*
+* @note Requires cfs.h
+*/
+
+#include "cfs.h"
+
+// Weight of each nice value from MIN_NICE to MAX_NICE, as used by Linux.
+// Each step is about 1.25 times the next, so one nice level is about 10%
+// of the CPU
+static const int niceWeights[ MAX_NICE - MIN_NICE + 1 ] =
+{
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+     9548,  7620,  6100,  4904,  3906,
+     3121,  2501,  1991,  1586,  1277,
+     1024,   820,   655,   526,   423,
+      335,   272,   215,   172,   137,
+      110,    87,    70,    56,    45,
+       36,    29,    23,    18,    15
+};
+
+//
+// createCfsQueue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function creates an empty CFS-P ready tree
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @post cfData remains unchanged at post
+ *
+ * @param[in] cfData a pointer to a ConfigData struct
+ *
+ * @return a pointer to the new tree (CfsQueue *)
+ */
+CfsQueue *createCfsQueue( ConfigData *cfData )
+{
+    CfsQueue *cfs = malloc( sizeof( *cfs ) );
+
+    cfs->rootProcess = NULL;
+    cfs->leftmostProcess = NULL;
+    cfs->readyCount = 0;
+    cfs->readyWeight = 0;
+    cfs->minVruntime = 0;
+    cfs->targetLatency = cfData->cfsTargetLatency;
+    cfs->minGranularity = cfData->cfsMinGranularity;
+    cfs->cycleTime = cfData->processorCycleTime;
+
+    return cfs;
+}
+//
+// getNiceWeight Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the weight of a nice value
+ *
+ * @param[in] nice a nice value from MIN_NICE to MAX_NICE
+ *
+ * @return the weight, CFS_NICE_0_WEIGHT for nice 0 (int)
+ */
+int getNiceWeight( int nice )
+{
+    return niceWeights[ nice - MIN_NICE ];
+}
+//
+// queueCfsProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds a ready process to the tree
+ *
+ * @details This function adds a process that was preempted as it is. A
+ *          process that is new or whose I/O ended is first moved up to half
+ *          a target latency behind the least vruntime, so time spent
+ *          blocked earns it a little CPU but not a long run.
+ *
+ * @pre process a pointer to a PCB that is not in the tree
+ *
+ * @param[in,out] cfs a pointer to a CfsQueue struct
+ *
+ * @param[in,out] process a pointer to a PCB struct
+ *
+ * @param[in] waking True if the process was not running before
+ *
+ * @return nothing to return (void)
+ */
+void queueCfsProcess( CfsQueue *cfs, PCB *process, Boolean waking )
+{
+    long long leastVruntime;
+
+    if( waking == True )
+    {
+        leastVruntime = cfs->minVruntime
+                      - (long long) cfs->targetLatency * 1000 / 2;
+
+        if( process->vruntime < leastVruntime )
+        {
+            process->vruntime = leastVruntime;
+        }
+    }
+
+    insertCfsProcess( cfs, process );
+
+    cfs->readyCount++;
+    cfs->readyWeight += getNiceWeight( process->nice );
+}
+//
+// takeCfsProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function takes the process with the least vruntime
+ *
+ * @param[in,out] cfs a pointer to a CfsQueue struct
+ *
+ * @return the process, or NULL if no process is ready (PCB *)
+ */
+PCB *takeCfsProcess( CfsQueue *cfs )
+{
+    PCB *process = cfs->leftmostProcess;
+
+    if( process == NULL )
+    {
+        return NULL;
+    }
+
+    eraseCfsProcess( cfs, process );
+
+    cfs->readyCount--;
+    cfs->readyWeight -= getNiceWeight( process->nice );
+
+    return process;
+}
+//
+// getCfsSlice Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the slice of a process that was just taken
+ *
+ * @details This function splits the target latency between the process and
+ *          the ready processes by weight. When the processes would get less
+ *          than the min granularity each, the latency is stretched to give
+ *          each at least that.
+ *
+ * @param[in] cfs a pointer to a CfsQueue struct
+ *
+ * @param[in] process a pointer to the PCB about to run
+ *
+ * @return the slice in cycles, at least one (int)
+ */
+int getCfsSlice( CfsQueue *cfs, PCB *process )
+{
+    long long weight = getNiceWeight( process->nice );
+    long long period = cfs->targetLatency;
+    long long slice;
+
+    if( ( cfs->readyCount + 1 ) * (long long) cfs->minGranularity > period )
+    {
+        period = ( cfs->readyCount + 1 ) * (long long) cfs->minGranularity;
+    }
+
+    slice = period * weight / ( cfs->readyWeight + weight );
+
+    if( slice < cfs->minGranularity )
+    {
+        slice = cfs->minGranularity;
+    }
+
+    if( cfs->cycleTime <= 0 )
+    {
+        return 1;
+    }
+
+    slice = ( slice + cfs->cycleTime - 1 ) / cfs->cycleTime;
+
+    return slice > 0 ? (int) slice : 1;
+}
+//
+// chargeCfsProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function charges a running process for the cycles it ran
+ *
+ * @details This function adds the run time scaled by the weight of the
+ *          process to its vruntime and moves the least vruntime forward.
+ *
+ * @param[in,out] cfs a pointer to a CfsQueue struct
+ *
+ * @param[in,out] process a pointer to the running PCB
+ *
+ * @param[in] cycles the cycles it ran
+ *
+ * @return nothing to return (void)
+ */
+void chargeCfsProcess( CfsQueue *cfs, PCB *process, int cycles )
+{
+    long long leastVruntime;
+
+    process->vruntime += (long long) cycles * cfs->cycleTime * 1000
+                       * CFS_NICE_0_WEIGHT / getNiceWeight( process->nice );
+
+    leastVruntime = process->vruntime;
+
+    if( cfs->leftmostProcess != NULL
+     && cfs->leftmostProcess->vruntime < leastVruntime )
+    {
+        leastVruntime = cfs->leftmostProcess->vruntime;
+    }
+
+    if( leastVruntime > cfs->minVruntime )
+    {
+        cfs->minVruntime = leastVruntime;
+    }
+}
+//
+// checkCfsBefore Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if one process comes before another in the
+ *        tree
+ *
+ * @details Processes with the same vruntime are ordered by process number
+ *          so runs are repeatable.
+ *
+ * @param[in] first a pointer to a PCB struct
+ *
+ * @param[in] second a pointer to a PCB struct
+ *
+ * @return True if first comes before second, False otherwise (Boolean)
+ */
+Boolean checkCfsBefore( PCB *first, PCB *second )
+{
+    if( first->vruntime < second->vruntime
+     || ( first->vruntime == second->vruntime
+       && first->processNum < second->processNum ) )
+    {
+        return True;
+    }
+
+    return False;
+}
+//
+// insertCfsProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function inserts a process into the red-black tree
+ *
+ * @param[in,out] cfs a pointer to a CfsQueue struct
+ *
+ * @param[in,out] process a pointer to a PCB that is not in the tree
+ *
+ * @return nothing to return (void)
+ */
+void insertCfsProcess( CfsQueue *cfs, PCB *process )
+{
+    PCB *parent = NULL, *node = cfs->rootProcess;
+    Boolean leftmost = True;
+
+    while( node != NULL )
+    {
+        parent = node;
+
+        if( checkCfsBefore( process, node ) == True )
+        {
+            node = node->treeLeft;
+        }
+        else
+        {
+            node = node->treeRight;
+            leftmost = False;
+        }
+    }
+
+    process->treeParent = parent;
+    process->treeLeft = NULL;
+    process->treeRight = NULL;
+    process->treeRed = True;
+
+    if( parent == NULL )
+    {
+        cfs->rootProcess = process;
+    }
+    else if( checkCfsBefore( process, parent ) == True )
+    {
+        parent->treeLeft = process;
+    }
+    else
+    {
+        parent->treeRight = process;
+    }
+
+    if( leftmost == True )
+    {
+        cfs->leftmostProcess = process;
+    }
+
+    fixCfsInsert( cfs, process );
+}
+//
+// eraseCfsProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function removes a process from the red-black tree
+ *
+ * @param[in,out] cfs a pointer to a CfsQueue struct
+ *
+ * @param[in,out] process a pointer to a PCB in the tree
+ *
+ * @return nothing to return (void)
+ */
+void eraseCfsProcess( CfsQueue *cfs, PCB *process )
+{
+    PCB *child, *parent, *successor;
+    Boolean removedRed = process->treeRed;
+
+    if( cfs->leftmostProcess == process )
+    {
+        successor = process->treeRight;
+
+        if( successor == NULL )
+        {
+            successor = process->treeParent;
+        }
+        else
+        {
+            while( successor->treeLeft != NULL )
+            {
+                successor = successor->treeLeft;
+            }
+        }
+
+        cfs->leftmostProcess = successor;
+    }
+
+    if( process->treeLeft == NULL )
+    {
+        child = process->treeRight;
+        parent = process->treeParent;
+        replaceCfsProcess( cfs, process, child );
+    }
+    else if( process->treeRight == NULL )
+    {
+        child = process->treeLeft;
+        parent = process->treeParent;
+        replaceCfsProcess( cfs, process, child );
+    }
+    else
+    {
+        successor = process->treeRight;
+
+        while( successor->treeLeft != NULL )
+        {
+            successor = successor->treeLeft;
+        }
+
+        removedRed = successor->treeRed;
+        child = successor->treeRight;
+
+        if( successor->treeParent == process )
+        {
+            parent = successor;
+        }
+        else
+        {
+            parent = successor->treeParent;
+            replaceCfsProcess( cfs, successor, child );
+            successor->treeRight = process->treeRight;
+            successor->treeRight->treeParent = successor;
+        }
+
+        replaceCfsProcess( cfs, process, successor );
+        successor->treeLeft = process->treeLeft;
+        successor->treeLeft->treeParent = successor;
+        successor->treeRed = process->treeRed;
+    }
+
+    if( removedRed == False )
+    {
+        fixCfsErase( cfs, child, parent );
+    }
+
+    process->treeParent = NULL;
+    process->treeLeft = NULL;
+    process->treeRight = NULL;
+}
+//
+// rotateCfsLeft Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function rotates the tree left about a process
+ *
+ * @param[in,out] cfs a pointer to a CfsQueue struct
+ *
+ * @param[in,out] process a pointer to a PCB with a right child
+ *
+ * @return nothing to return (void)
+ */
+void rotateCfsLeft( CfsQueue *cfs, PCB *process )
+{
+    PCB *child = process->treeRight;
+
+    process->treeRight = child->treeLeft;
+
+    if( child->treeLeft != NULL )
+    {
+        child->treeLeft->treeParent = process;
+    }
+
+    replaceCfsProcess( cfs, process, child );
+    child->treeLeft = process;
+    process->treeParent = child;
+}
+//
+// rotateCfsRight Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function rotates the tree right about a process
+ *
+ * @param[in,out] cfs a pointer to a CfsQueue struct
+ *
+ * @param[in,out] process a pointer to a PCB with a left child
+ *
+ * @return nothing to return (void)
+ */
+void rotateCfsRight( CfsQueue *cfs, PCB *process )
+{
+    PCB *child = process->treeLeft;
+
+    process->treeLeft = child->treeRight;
+
+    if( child->treeRight != NULL )
+    {
+        child->treeRight->treeParent = process;
+    }
+
+    replaceCfsProcess( cfs, process, child );
+    child->treeRight = process;
+    process->treeParent = child;
+}
+//
+// replaceCfsProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function puts a subtree where another one was
+ *
+ * @details This function points the parent of oldProcess at newProcess
+ *          instead, the children of either are not changed.
+ *
+ * @param[in,out] cfs a pointer to a CfsQueue struct
+ *
+ * @param[in] oldProcess a pointer to a PCB in the tree
+ *
+ * @param[in,out] newProcess a pointer to a PCB, or NULL
+ *
+ * @return nothing to return (void)
+ */
+void replaceCfsProcess( CfsQueue *cfs, PCB *oldProcess, PCB *newProcess )
+{
+    PCB *parent = oldProcess->treeParent;
+
+    if( parent == NULL )
+    {
+        cfs->rootProcess = newProcess;
+    }
+    else if( parent->treeLeft == oldProcess )
+    {
+        parent->treeLeft = newProcess;
+    }
+    else
+    {
+        parent->treeRight = newProcess;
+    }
+
+    if( newProcess != NULL )
+    {
+        newProcess->treeParent = parent;
+    }
+}
+//
+// fixCfsInsert Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function restores the red-black rules after an insert
+ *
+ * @param[in,out] cfs a pointer to a CfsQueue struct
+ *
+ * @param[in,out] process a pointer to the red PCB just inserted
+ *
+ * @return nothing to return (void)
+ */
+void fixCfsInsert( CfsQueue *cfs, PCB *process )
+{
+    PCB *parent, *grandparent, *uncle;
+
+    while( ( parent = process->treeParent ) != NULL
+        && parent->treeRed == True )
+    {
+        grandparent = parent->treeParent;
+
+        if( parent == grandparent->treeLeft )
+        {
+            uncle = grandparent->treeRight;
+
+            if( uncle != NULL && uncle->treeRed == True )
+            {
+                parent->treeRed = False;
+                uncle->treeRed = False;
+                grandparent->treeRed = True;
+                process = grandparent;
+                continue;
+            }
+
+            if( process == parent->treeRight )
+            {
+                rotateCfsLeft( cfs, parent );
+                process = parent;
+                parent = process->treeParent;
+            }
+
+            parent->treeRed = False;
+            grandparent->treeRed = True;
+            rotateCfsRight( cfs, grandparent );
+        }
+        else
+        {
+            uncle = grandparent->treeLeft;
+
+            if( uncle != NULL && uncle->treeRed == True )
+            {
+                parent->treeRed = False;
+                uncle->treeRed = False;
+                grandparent->treeRed = True;
+                process = grandparent;
+                continue;
+            }
+
+            if( process == parent->treeLeft )
+            {
+                rotateCfsRight( cfs, parent );
+                process = parent;
+                parent = process->treeParent;
+            }
+
+            parent->treeRed = False;
+            grandparent->treeRed = True;
+            rotateCfsLeft( cfs, grandparent );
+        }
+    }
+
+    cfs->rootProcess->treeRed = False;
+}
+//
+// fixCfsErase Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function restores the red-black rules after an erase
+ *
+ * @details A black PCB was removed from above process, so its side of the
+ *          tree is one black short. process may be NULL, which is why its
+ *          parent is given.
+ *
+ * @param[in,out] cfs a pointer to a CfsQueue struct
+ *
+ * @param[in,out] process a pointer to the PCB that took its place, or NULL
+ *
+ * @param[in,out] parent a pointer to the parent of process
+ *
+ * @return nothing to return (void)
+ */
+void fixCfsErase( CfsQueue *cfs, PCB *process, PCB *parent )
+{
+    PCB *sibling;
+
+    while( process != cfs->rootProcess
+        && ( process == NULL || process->treeRed == False ) )
+    {
+        if( process == parent->treeLeft )
+        {
+            sibling = parent->treeRight;
+
+            if( sibling->treeRed == True )
+            {
+                sibling->treeRed = False;
+                parent->treeRed = True;
+                rotateCfsLeft( cfs, parent );
+                sibling = parent->treeRight;
+            }
+
+            if( ( sibling->treeLeft == NULL
+               || sibling->treeLeft->treeRed == False )
+             && ( sibling->treeRight == NULL
+               || sibling->treeRight->treeRed == False ) )
+            {
+                sibling->treeRed = True;
+                process = parent;
+                parent = process->treeParent;
+                continue;
+            }
+
+            if( sibling->treeRight == NULL
+             || sibling->treeRight->treeRed == False )
+            {
+                sibling->treeLeft->treeRed = False;
+                sibling->treeRed = True;
+                rotateCfsRight( cfs, sibling );
+                sibling = parent->treeRight;
+            }
+
+            sibling->treeRed = parent->treeRed;
+            parent->treeRed = False;
+            sibling->treeRight->treeRed = False;
+            rotateCfsLeft( cfs, parent );
+        }
+        else
+        {
+            sibling = parent->treeLeft;
+
+            if( sibling->treeRed == True )
+            {
+                sibling->treeRed = False;
+                parent->treeRed = True;
+                rotateCfsRight( cfs, parent );
+                sibling = parent->treeLeft;
+            }
+
+            if( ( sibling->treeLeft == NULL
+               || sibling->treeLeft->treeRed == False )
+             && ( sibling->treeRight == NULL
+               || sibling->treeRight->treeRed == False ) )
+            {
+                sibling->treeRed = True;
+                process = parent;
+                parent = process->treeParent;
+                continue;
+            }
+
+            if( sibling->treeLeft == NULL
+             || sibling->treeLeft->treeRed == False )
+            {
+                sibling->treeRight->treeRed = False;
+                sibling->treeRed = True;
+                rotateCfsLeft( cfs, sibling );
+                sibling = parent->treeLeft;
+            }
+
+            sibling->treeRed = parent->treeRed;
+            parent->treeRed = False;
+            sibling->treeLeft->treeRed = False;
+            rotateCfsRight( cfs, parent );
+        }
+
+        process = cfs->rootProcess;
+    }
+
+    if( process != NULL )
+    {
+        process->treeRed = False;
+    }
+}
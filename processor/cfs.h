@@ -0,0 +1,97 @@
+// Cfs Header Information ////////////////////////////////////////
+/**
+* @file cfs.h
+*
+* @brief Header file for cfs
+*
+* @details Specifies constants, simple data structures, included libraries,
+*          and function declarations used in the CFS-P ready tree
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of cfs
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides the ready set of the completely fair scheduler. Ready
+  PCBs are kept in a red-black tree ordered by their virtual runtime, the
+  time they have run scaled down by the weight of their nice value. The tree
+  is linked through the PCBs themselves and its leftmost PCB is cached, so
+  picking the next process is O(1) and adding or taking one is O(log n)
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef CFS_H
+#define CFS_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include "processor.h"
+#include "configParser.h"
+#include "metaLinkedList.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+
+// Weight of nice 0, one msec of its run time is 1000 usec of vruntime
+#define CFS_NICE_0_WEIGHT 1024
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+typedef struct CfsQueue
+{
+  struct PCB *rootProcess;
+  // Process with the least vruntime, the next one picked
+  struct PCB *leftmostProcess;
+  int readyCount;
+  long long readyWeight;
+  // Least vruntime seen, it never goes backwards. Woken processes are
+  // placed no further than half a target latency behind it
+  long long minVruntime;
+  int targetLatency;
+  int minGranularity;
+  int cycleTime;
+} CfsQueue;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+CfsQueue *createCfsQueue( ConfigData *cfData );
+
+int getNiceWeight( int nice );
+
+void queueCfsProcess( CfsQueue *cfs, struct PCB *process, Boolean waking );
+
+struct PCB *takeCfsProcess( CfsQueue *cfs );
+
+int getCfsSlice( CfsQueue *cfs, struct PCB *process );
+
+void chargeCfsProcess( CfsQueue *cfs, struct PCB *process, int cycles );
+
+Boolean checkCfsBefore( struct PCB *first, struct PCB *second );
+
+void insertCfsProcess( CfsQueue *cfs, struct PCB *process );
+
+void eraseCfsProcess( CfsQueue *cfs, struct PCB *process );
+
+void rotateCfsLeft( CfsQueue *cfs, struct PCB *process );
+
+void rotateCfsRight( CfsQueue *cfs, struct PCB *process );
+
+void replaceCfsProcess( CfsQueue *cfs,
+                        struct PCB *oldProcess,
+                        struct PCB *newProcess );
+
+void fixCfsInsert( CfsQueue *cfs, struct PCB *process );
+
+void fixCfsErase( CfsQueue *cfs, struct PCB *process, struct PCB *parent );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // CFS_H
+//
@@ -0,0 +1,503 @@
+// Counters Implementation File Information ///////////////////////////////
+/**
+* @file counters.c
+*
+* @brief Implementation for counters
+*
+* @details Implements all functions for counting runtime events per thread
+*          and dumping their totals
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of counters
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* Added releaseCounterBlock, and initCounters reports a failed key
+*
+* @note Requires counters.h
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "counters.h"
+
+// Names of the counters in the order of COUNTER_TYPES
+static const char *counterNames[ COUNTER_COUNT ] =
+{
+    "scheduling decisions",
+    "context switches",
+    "quantum expirations",
+    "interupts raised",
+    "interupts handled",
+    "peak interupt queue",
+    "MMU allocations",
+    "MMU accesses",
+    "MMU failures",
+    "log lines",
+    "log bytes",
+    "threads created"
+};
+
+// Bumped by the SIGUSR1 handler, each CounterSet dumps once per bump
+static volatile sig_atomic_t dumpRequests = 0;
+
+//
+// initCounters Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function initializes a set of counters with no blocks
+ *
+ * @pre counters a pointer to a CounterSet struct
+ *
+ * @post counters is ready to count at post
+ *
+ * @exception noKey
+ *            If pthreads has no thread key left, return False with nothing
+ *            to free.
+ *
+ * @param[out] counters a pointer to a CounterSet struct
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean initCounters( CounterSet *counters )
+{
+    int type;
+
+    if( pthread_key_create( &counters->blockKey, retireCounterBlock ) != 0 )
+    {
+        return False;
+    }
+
+    pthread_mutex_init( &counters->blockMutex, NULL );
+    counters->headBlock = NULL;
+
+    for( type = 0; type < COUNTER_COUNT; type++ )
+    {
+        counters->retiredValues[ type ] = 0;
+    }
+
+    counters->dumpRequestsSeen = dumpRequests;
+
+    return True;
+}
+//
+// freeCounters Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees a set of counters
+ *
+ * @details This function frees the block of every thread that counted.
+ *
+ * @pre no thread is counting into counters, and every detached thread that
+ *      counted has called releaseCounterBlock
+ *
+ * @post counters is freed at post
+ *
+ * @param[in,out] counters a pointer to a CounterSet struct
+ *
+ * @return nothing to return (void)
+ */
+void freeCounters( CounterSet *counters )
+{
+    CounterBlock *block = counters->headBlock, *nextBlock;
+
+    while( block != NULL )
+    {
+        nextBlock = block->nextBlock;
+        free( block );
+        block = nextBlock;
+    }
+
+    pthread_key_delete( counters->blockKey );
+    pthread_mutex_destroy( &counters->blockMutex );
+}
+//
+// clearCounters Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function sets every counter back to 0
+ *
+ * @pre no other thread is counting into counters
+ *
+ * @post counters read as 0 at post
+ *
+ * @param[in,out] counters a pointer to a CounterSet struct
+ *
+ * @return nothing to return (void)
+ */
+void clearCounters( CounterSet *counters )
+{
+    int type;
+    CounterBlock *block;
+
+    pthread_mutex_lock( &counters->blockMutex );
+
+    for( type = 0; type < COUNTER_COUNT; type++ )
+    {
+        counters->retiredValues[ type ] = 0;
+    }
+
+    for( block = counters->headBlock; block != NULL; block = block->nextBlock )
+    {
+        for( type = 0; type < COUNTER_COUNT; type++ )
+        {
+            block->values[ type ] = 0;
+        }
+    }
+
+    pthread_mutex_unlock( &counters->blockMutex );
+}
+//
+// getCounterBlock Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the block of counters of the calling thread
+ *
+ * @details This function makes a block for a thread the first time it
+ *          counts. The block is kept until the thread ends or the set is
+ *          freed.
+ *
+ * @pre counters a pointer to a CounterSet made by initCounters
+ *
+ * @post counters has a block for the thread at post
+ *
+ * @param[in,out] counters a pointer to a CounterSet struct
+ *
+ * @return the block of the calling thread (CounterBlock *)
+ */
+CounterBlock *getCounterBlock( CounterSet *counters )
+{
+    int type;
+    CounterBlock *block = pthread_getspecific( counters->blockKey );
+
+    if( block != NULL )
+    {
+        return block;
+    }
+
+    block = malloc( sizeof( *block ) );
+
+    for( type = 0; type < COUNTER_COUNT; type++ )
+    {
+        block->values[ type ] = 0;
+    }
+
+    block->counters = counters;
+
+    pthread_mutex_lock( &counters->blockMutex );
+    block->nextBlock = counters->headBlock;
+    counters->headBlock = block;
+    pthread_mutex_unlock( &counters->blockMutex );
+
+    pthread_setspecific( counters->blockKey, block );
+
+    return block;
+}
+//
+// retireCounterBlock Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds the block of an ending thread into its set
+ *
+ * @details This function is run by pthreads when a thread that counted
+ *          ends. Its counts are added into the retired counts of the set,
+ *          and the block is taken off the list and freed.
+ *
+ * @pre block a pointer to a CounterBlock made by getCounterBlock
+ *
+ * @post block is freed at post
+ *
+ * @param[in] block a pointer to a CounterBlock struct
+ *
+ * @return nothing to return (void)
+ */
+void retireCounterBlock( void *block )
+{
+    CounterBlock *oldBlock = block;
+    CounterSet *counters = oldBlock->counters;
+    CounterBlock **link = &counters->headBlock;
+
+    pthread_mutex_lock( &counters->blockMutex );
+
+    addCounterValues( counters->retiredValues, oldBlock->values );
+
+    while( *link != oldBlock )
+    {
+        link = &( *link )->nextBlock;
+    }
+
+    *link = oldBlock->nextBlock;
+
+    pthread_mutex_unlock( &counters->blockMutex );
+
+    free( oldBlock );
+}
+//
+// releaseCounterBlock Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function retires the block of the calling thread now
+ *
+ * @details This function is called by a detached thread before the event
+ *          that lets the run end, so the set is not freed while the block
+ *          is still on it. The key is cleared, so pthreads does not retire
+ *          the block again when the thread ends.
+ *
+ * @pre counters a pointer to a CounterSet made by initCounters
+ *
+ * @post the thread has no block at post
+ *
+ * @param[in,out] counters a pointer to a CounterSet struct
+ *
+ * @return nothing to return (void)
+ */
+void releaseCounterBlock( CounterSet *counters )
+{
+    CounterBlock *block = pthread_getspecific( counters->blockKey );
+
+    if( block != NULL )
+    {
+        pthread_setspecific( counters->blockKey, NULL );
+        retireCounterBlock( block );
+    }
+}
+//
+// addCounterValues Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds one set of counter values into another
+ *
+ * @details This function sums each counter, taking the largest value for
+ *          peak counters.
+ *
+ * @pre totals and values pointers to COUNTER_COUNT long longs
+ *
+ * @post values remain unchanged at post
+ *
+ * @param[in,out] totals a pointer to COUNTER_COUNT long longs
+ *
+ * @param[in] values a pointer to COUNTER_COUNT long longs
+ *
+ * @return nothing to return (void)
+ */
+void addCounterValues( long long *totals, long long *values )
+{
+    int type;
+    long long value;
+
+    for( type = 0; type < COUNTER_COUNT; type++ )
+    {
+        value = __atomic_load_n( &values[ type ], __ATOMIC_RELAXED );
+
+        if( type == INTERUPT_QUEUE_PEAK )
+        {
+            totals[ type ] = value > totals[ type ] ? value : totals[ type ];
+        }
+        else
+        {
+            totals[ type ] += value;
+        }
+    }
+}
+//
+// countEvent Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds to a counter of the calling thread
+ *
+ * @details This function adds to the thread's own block. Only this thread
+ *          writes to it, so a relaxed load and store is enough for readers
+ *          on other threads to see whole values, without a locked add.
+ *
+ * @param[in,out] counters a pointer to a CounterSet struct
+ *
+ * @param[in] type the counter to add to
+ *
+ * @param[in] amount the amount to add
+ *
+ * @return nothing to return (void)
+ */
+void countEvent( CounterSet *counters, COUNTER_TYPES type, long long amount )
+{
+    long long *value = &getCounterBlock( counters )->values[ type ];
+
+    __atomic_store_n( value, __atomic_load_n( value, __ATOMIC_RELAXED )
+                             + amount, __ATOMIC_RELAXED );
+}
+//
+// countPeak Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function raises a peak counter of the calling thread
+ *
+ * @param[in,out] counters a pointer to a CounterSet struct
+ *
+ * @param[in] type the peak counter to raise
+ *
+ * @param[in] value the value seen
+ *
+ * @return nothing to return (void)
+ */
+void countPeak( CounterSet *counters, COUNTER_TYPES type, long long value )
+{
+    long long *peak = &getCounterBlock( counters )->values[ type ];
+
+    if( value > __atomic_load_n( peak, __ATOMIC_RELAXED ) )
+    {
+        __atomic_store_n( peak, value, __ATOMIC_RELAXED );
+    }
+}
+//
+// readCounters Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds up the counters of every thread
+ *
+ * @details This function adds the block of every running thread to the
+ *          counts of the threads that have ended. Threads may still be
+ *          counting, so the totals are a snapshot.
+ *
+ * @pre totals a pointer to COUNTER_COUNT long longs
+ *
+ * @post totals holds the counters at post
+ *
+ * @param[in] counters a pointer to a CounterSet struct
+ *
+ * @param[out] totals a pointer to COUNTER_COUNT long longs
+ *
+ * @return nothing to return (void)
+ */
+void readCounters( CounterSet *counters, long long *totals )
+{
+    int type;
+    CounterBlock *block;
+
+    pthread_mutex_lock( &counters->blockMutex );
+
+    for( type = 0; type < COUNTER_COUNT; type++ )
+    {
+        totals[ type ] = counters->retiredValues[ type ];
+    }
+
+    for( block = counters->headBlock; block != NULL; block = block->nextBlock )
+    {
+        addCounterValues( totals, block->values );
+    }
+
+    pthread_mutex_unlock( &counters->blockMutex );
+}
+//
+// writeCounters Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes the totals of a set of counters
+ *
+ * @details This function writes one "name: value" line per counter, and
+ *          the timer calls, which the timer counts itself.
+ *
+ * @pre filePointer a pointer to a file open for writing
+ *
+ * @post counters remain unchanged at post
+ *
+ * @param[in] counters a pointer to a CounterSet struct
+ *
+ * @param[in] filePointer a pointer to a file
+ *
+ * @param[in] timerCalls the number of calls to accessTimer
+ *
+ * @return nothing to return (void)
+ */
+void writeCounters( CounterSet *counters,
+                    FILE *filePointer,
+                    long long timerCalls )
+{
+    int type;
+    long long totals[ COUNTER_COUNT ];
+
+    readCounters( counters, totals );
+
+    fprintf( filePointer, "Runtime Counters\n" );
+
+    for( type = 0; type < COUNTER_COUNT; type++ )
+    {
+        fprintf( filePointer, "  %-22s: %lld\n",
+                 counterNames[ type ], totals[ type ] );
+    }
+
+    fprintf( filePointer, "  %-22s: %lld\n", "timer calls", timerCalls );
+    fflush( filePointer );
+}
+//
+// installCounterSignal Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function makes SIGUSR1 ask for a dump of the counters
+ *
+ * @details This function only sets the handler. Running simulations check
+ *          for the request themselves and dump from their own thread, as
+ *          writing from a signal handler is not safe.
+ *
+ * @return nothing to return (void)
+ */
+void installCounterSignal( void )
+{
+    struct sigaction action;
+
+    action.sa_handler = requestCounterDump;
+    sigemptyset( &action.sa_mask );
+    action.sa_flags = SA_RESTART;
+
+    sigaction( SIGUSR1, &action, NULL );
+}
+//
+// requestCounterDump Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function asks every running simulation to dump its counters
+ *
+ * @param[in] signalNumber the signal that was caught
+ *
+ * @return nothing to return (void)
+ */
+void requestCounterDump( int signalNumber )
+{
+    dumpRequests++;
+}
+//
+// checkCounterDumpRequest Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if a dump was asked for since the last check
+ *
+ * @param[in,out] counters a pointer to a CounterSet struct
+ *
+ * @return True once for each dump request, False otherwise (Boolean)
+ */
+Boolean checkCounterDumpRequest( CounterSet *counters )
+{
+    int requests = dumpRequests;
+
+    if( requests == counters->dumpRequestsSeen )
+    {
+        return False;
+    }
+
+    counters->dumpRequestsSeen = requests;
+
+    return True;
+}
@@ -0,0 +1,122 @@
+// Counters Header Information ////////////////////////////////////////
+/**
+* @file counters.h
+*
+* @brief Header file for counters
+*
+* @details Specifies constants, simple data structures, included libraries,
+*          and function declarations used in counting runtime events
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of counters
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* Added releaseCounterBlock, and initCounters reports a failed key
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides counters for the events long runs spend their time
+  on. Each thread that counts gets its own block of counters, so counting is
+  a plain add with no lock, and the blocks are only added up when the
+  counters are read. The block of a thread that ends is added into the set
+  and freed, so short lived I/O threads do not pile up blocks. A detached
+  thread releases its block itself before the run can end, as the set may
+  be freed before the thread's key destructor runs
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef COUNTERS_H
+#define COUNTERS_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <pthread.h>
+#include "basicStructs.h"
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+
+// Counters ending in _PEAK keep the largest value seen instead of a sum
+typedef enum
+{
+  SCHEDULE_COUNTER = 0,
+  CONTEXT_SWITCH_COUNTER,
+  QUANTUM_EXPIRED_COUNTER,
+  INTERUPT_RAISED_COUNTER,
+  INTERUPT_HANDLED_COUNTER,
+  INTERUPT_QUEUE_PEAK,
+  MMU_ALLOCATE_COUNTER,
+  MMU_ACCESS_COUNTER,
+  MMU_FAIL_COUNTER,
+  LOG_LINE_COUNTER,
+  LOG_BYTE_COUNTER,
+  THREAD_CREATED_COUNTER,
+  COUNTER_COUNT
+} COUNTER_TYPES;
+
+// The counters of one thread, only ever written by that thread
+typedef struct CounterBlock
+{
+  long long values[ COUNTER_COUNT ];
+  struct CounterSet *counters;
+  struct CounterBlock *nextBlock;
+} CounterBlock;
+
+typedef struct CounterSet
+{
+  // Finds the block of the calling thread
+  pthread_key_t blockKey;
+  // Guards the list of blocks and the retired counts, not the counts in
+  // the blocks
+  pthread_mutex_t blockMutex;
+  CounterBlock *headBlock;
+  // Counts of threads that have ended, such as the I/O threads
+  long long retiredValues[ COUNTER_COUNT ];
+  // Dump requests already answered by this set
+  int dumpRequestsSeen;
+} CounterSet;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+Boolean initCounters( CounterSet *counters );
+
+void freeCounters( CounterSet *counters );
+
+void clearCounters( CounterSet *counters );
+
+CounterBlock *getCounterBlock( CounterSet *counters );
+
+void retireCounterBlock( void *block );
+
+void releaseCounterBlock( CounterSet *counters );
+
+void addCounterValues( long long *totals, long long *values );
+
+void countEvent( CounterSet *counters, COUNTER_TYPES type, long long amount );
+
+void countPeak( CounterSet *counters, COUNTER_TYPES type, long long value );
+
+void readCounters( CounterSet *counters, long long *totals );
+
+void writeCounters( CounterSet *counters,
+                    FILE *filePointer,
+                    long long timerCalls );
+
+void installCounterSignal( void );
+
+void requestCounterDump( int signalNumber );
+
+Boolean checkCounterDumpRequest( CounterSet *counters );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // COUNTERS_H
+//
@@ -0,0 +1,373 @@
+// Deadline Implementation File Information ///////////////////////////////
+/**
+* @file deadline.c
+*
+* @brief Implementation for deadline
+*
+* @details Implements all functions for the EDF-P and RM-P ready heaps and
+*          their schedulability checks
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of deadline
+*
+* @note Requires deadline.h
+*/
+
+#include "deadline.h"
+
+//
+// createDeadlineQueue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function creates an empty EDF-P or RM-P ready heap
+ *
+ * @param[in] earliestDeadline True for EDF-P, False for RM-P
+ *
+ * @return a pointer to the new ready heap (DeadlineQueue *)
+ */
+DeadlineQueue *createDeadlineQueue( Boolean earliestDeadline )
+{
+    DeadlineQueue *queue = malloc( sizeof( *queue ) );
+
+    queue->earliestDeadline = earliestDeadline;
+    queue->capacity = DEADLINE_START_CAPACITY;
+    queue->readyHeap = malloc( sizeof( PCB * ) * queue->capacity );
+    queue->readyCount = 0;
+
+    return queue;
+}
+//
+// freeDeadlineQueue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees a ready heap, the PCBs in it are not freed
+ *
+ * @param[in] queue a pointer to a DeadlineQueue struct
+ *
+ * @return nothing to return (void)
+ */
+void freeDeadlineQueue( DeadlineQueue *queue )
+{
+    free( queue->readyHeap );
+    free( queue );
+}
+//
+// getDeadlineKey Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the urgency of a process, lower first
+ *
+ * @param[in] queue a pointer to a DeadlineQueue struct
+ *
+ * @param[in] process a pointer to a PCB struct
+ *
+ * @return the absolute deadline under EDF-P or the period under RM-P in
+ *         msec, or NO_DEADLINE_KEY if the process has none (long long)
+ */
+long long getDeadlineKey( DeadlineQueue *queue, PCB *process )
+{
+    if( queue->earliestDeadline == True && process->deadline >= 0 )
+    {
+        return process->deadline;
+    }
+    else if( queue->earliestDeadline == False && process->period > 0 )
+    {
+        return process->period;
+    }
+
+    return NO_DEADLINE_KEY;
+}
+//
+// checkDeadlineBefore Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if one process is more urgent than another
+ *
+ * @details Processes that are as urgent are ordered by process number so
+ *          runs are repeatable.
+ *
+ * @param[in] queue a pointer to a DeadlineQueue struct
+ *
+ * @param[in] first a pointer to a PCB struct
+ *
+ * @param[in] second a pointer to a PCB struct
+ *
+ * @return True if first comes before second, False otherwise (Boolean)
+ */
+Boolean checkDeadlineBefore( DeadlineQueue *queue, PCB *first, PCB *second )
+{
+    long long firstKey = getDeadlineKey( queue, first );
+    long long secondKey = getDeadlineKey( queue, second );
+
+    if( firstKey < secondKey
+     || ( firstKey == secondKey && first->processNum < second->processNum ) )
+    {
+        return True;
+    }
+
+    return False;
+}
+//
+// queueDeadlineProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds a ready process to the heap
+ *
+ * @param[in,out] queue a pointer to a DeadlineQueue struct
+ *
+ * @param[in] process a pointer to a PCB that is not in the heap
+ *
+ * @return nothing to return (void)
+ */
+void queueDeadlineProcess( DeadlineQueue *queue, PCB *process )
+{
+    int index = queue->readyCount, parent;
+
+    if( index == queue->capacity )
+    {
+        queue->capacity *= 2;
+        queue->readyHeap = realloc( queue->readyHeap,
+                                    sizeof( PCB * ) * queue->capacity );
+    }
+
+    while( index > 0 )
+    {
+        parent = ( index - 1 ) / 2;
+
+        if( checkDeadlineBefore( queue, process,
+                                 queue->readyHeap[ parent ] ) == False )
+        {
+            break;
+        }
+
+        queue->readyHeap[ index ] = queue->readyHeap[ parent ];
+        index = parent;
+    }
+
+    queue->readyHeap[ index ] = process;
+    queue->readyCount++;
+}
+//
+// takeDeadlineProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function takes the most urgent process from the heap
+ *
+ * @param[in,out] queue a pointer to a DeadlineQueue struct
+ *
+ * @return the process, or NULL if no process is ready (PCB *)
+ */
+PCB *takeDeadlineProcess( DeadlineQueue *queue )
+{
+    int index = 0, child;
+    PCB *first, *last;
+
+    if( queue->readyCount == 0 )
+    {
+        return NULL;
+    }
+
+    queue->readyCount--;
+    first = queue->readyHeap[ 0 ];
+    last = queue->readyHeap[ queue->readyCount ];
+
+    while( ( child = index * 2 + 1 ) < queue->readyCount )
+    {
+        if( child + 1 < queue->readyCount
+         && checkDeadlineBefore( queue, queue->readyHeap[ child + 1 ],
+                                 queue->readyHeap[ child ] ) == True )
+        {
+            child++;
+        }
+
+        if( checkDeadlineBefore( queue, queue->readyHeap[ child ],
+                                 last ) == False )
+        {
+            break;
+        }
+
+        queue->readyHeap[ index ] = queue->readyHeap[ child ];
+        index = child;
+    }
+
+    queue->readyHeap[ index ] = last;
+
+    return first;
+}
+//
+// getPeriodicTasks Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function lists the periodic tasks of a PCB list
+ *
+ * @details Every process with a period is a task, except that the instances
+ *          of a process template, which share their first op, are the jobs
+ *          of one task. A task without a deadline has its period as one.
+ *
+ * @pre headProcess a pointer to the head of the PCB list or ring
+ *
+ * @post tasks points at a new array the caller frees at post
+ *
+ * @param[in] headProcess a pointer to a PCB struct
+ *
+ * @param[out] tasks a pointer to the new array of tasks
+ *
+ * @return the number of tasks (int)
+ */
+int getPeriodicTasks( PCB *headProcess, PeriodicTask **tasks )
+{
+    int taskCount = 0, capacity = DEADLINE_START_CAPACITY;
+    PCB *currentProcess;
+    MetaNode *lastStart = NULL;
+
+    *tasks = malloc( sizeof( PeriodicTask ) * capacity );
+
+    currentProcess = headProcess;
+
+    do
+    {
+        if( currentProcess->period <= 0
+         || currentProcess->startNode == lastStart )
+        {
+            currentProcess = currentProcess->nextProcess;
+            continue;
+        }
+
+        if( taskCount == capacity )
+        {
+            capacity *= 2;
+            *tasks = realloc( *tasks, sizeof( PeriodicTask ) * capacity );
+        }
+
+        ( *tasks )[ taskCount ].cost = currentProcess->processTime;
+        ( *tasks )[ taskCount ].period = currentProcess->period;
+        ( *tasks )[ taskCount ].deadline = currentProcess->period;
+
+        if( currentProcess->deadline >= 0 )
+        {
+            ( *tasks )[ taskCount ].deadline = currentProcess->deadline
+                                             - currentProcess->arrivalTime;
+        }
+
+        lastStart = currentProcess->startNode;
+        taskCount++;
+        currentProcess = currentProcess->nextProcess;
+    }
+    while( currentProcess != NULL && currentProcess != headProcess );
+
+    return taskCount;
+}
+//
+// getTaskDensity Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the density of a set of periodic tasks
+ *
+ * @details Under EDF-P the tasks always meet their deadlines if the
+ *          density is at most 1.
+ *
+ * @param[in] tasks a pointer to an array of tasks
+ *
+ * @param[in] taskCount the number of tasks
+ *
+ * @return the sum of cost over the lesser of deadline and period (double)
+ */
+double getTaskDensity( PeriodicTask *tasks, int taskCount )
+{
+    double density = 0;
+    int index, window;
+
+    for( index = 0; index < taskCount; index++ )
+    {
+        window = tasks[ index ].period;
+
+        if( tasks[ index ].deadline < window )
+        {
+            window = tasks[ index ].deadline;
+        }
+
+        if( window <= 0 )
+        {
+            return INT_MAX;
+        }
+
+        density += (double) tasks[ index ].cost / window;
+    }
+
+    return density;
+}
+//
+// getResponseTime Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the worst response time of a task under RM-P
+ *
+ * @details This function starts from the cost of the task and adds the
+ *          jobs of every task with a shorter period that are released in
+ *          that time, until the time stops growing or passes the deadline.
+ *
+ * @pre tasks are sorted by period, shortest first
+ *
+ * @param[in] tasks a pointer to an array of tasks
+ *
+ * @param[in] taskCount the number of tasks
+ *
+ * @param[in] taskIndex the task to check
+ *
+ * @return the response time in msec, more than the deadline if it can be
+ *         missed (int)
+ */
+int getResponseTime( PeriodicTask *tasks, int taskCount, int taskIndex )
+{
+    long long responseTime = tasks[ taskIndex ].cost, nextTime;
+    int index;
+
+    while( responseTime <= tasks[ taskIndex ].deadline )
+    {
+        nextTime = tasks[ taskIndex ].cost;
+
+        for( index = 0; index < taskIndex; index++ )
+        {
+            nextTime += ( responseTime + tasks[ index ].period - 1 )
+                      / tasks[ index ].period * tasks[ index ].cost;
+        }
+
+        if( nextTime == responseTime )
+        {
+            break;
+        }
+
+        responseTime = nextTime;
+    }
+
+    return responseTime > INT_MAX ? INT_MAX : (int) responseTime;
+}
+//
+// comparePeriods Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function orders periodic tasks by period for qsort
+ *
+ * @param[in] first a pointer to a PeriodicTask struct
+ *
+ * @param[in] second a pointer to a PeriodicTask struct
+ *
+ * @return negative, zero or positive as first is shorter, the same or
+ *         longer (int)
+ */
+int comparePeriods( const void *first, const void *second )
+{
+    return ( (const PeriodicTask *) first )->period
+         - ( (const PeriodicTask *) second )->period;
+}
@@ -0,0 +1,105 @@
+// Deadline Header Information ////////////////////////////////////////
+/**
+* @file deadline.h
+*
+* @brief Header file for deadline
+*
+* @details Specifies constants, simple data structures, included libraries,
+*          and function declarations used in the EDF-P and RM-P ready heaps
+*          and their schedulability checks
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of deadline
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides the ready set of the real-time schedulers, a binary
+  heap of PCBs with the most urgent first. EDF-P orders it by absolute
+  deadline and RM-P by period, so taking the next process and adding one are
+  O(log n). Processes without a deadline or period come after every process
+  with one.
+
+  Before a run the periodic tasks of the workload are checked. EDF-P uses the
+  density test, the sum of C / min( D, P ), which is exact when deadlines
+  are periods. RM-P uses response time analysis, which is exact for any
+  deadlines up to the period
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef DEADLINE_H
+#define DEADLINE_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "processor.h"
+#include "metaLinkedList.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+
+// Processes the ready heap has room for before it grows
+#define DEADLINE_START_CAPACITY 64
+
+// Key of a process without a deadline or period, after all the others
+#define NO_DEADLINE_KEY LLONG_MAX
+
+// Msec a process can finish after its deadline and still meet it, so timer
+// rounding is not counted as a miss
+#define DEADLINE_TOLERANCE 0.001
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+typedef struct DeadlineQueue
+{
+  // True for EDF-P, False for RM-P
+  Boolean earliestDeadline;
+  struct PCB **readyHeap;
+  int readyCount;
+  int capacity;
+} DeadlineQueue;
+
+// A periodic task of the workload, one for each process block with a
+// period, with its longest run time as the cost of each job
+typedef struct PeriodicTask
+{
+  int cost;
+  int period;
+  int deadline;
+} PeriodicTask;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+DeadlineQueue *createDeadlineQueue( Boolean earliestDeadline );
+
+void freeDeadlineQueue( DeadlineQueue *queue );
+
+long long getDeadlineKey( DeadlineQueue *queue, struct PCB *process );
+
+Boolean checkDeadlineBefore( DeadlineQueue *queue,
+                             struct PCB *first,
+                             struct PCB *second );
+
+void queueDeadlineProcess( DeadlineQueue *queue, struct PCB *process );
+
+struct PCB *takeDeadlineProcess( DeadlineQueue *queue );
+
+int getPeriodicTasks( struct PCB *headProcess, PeriodicTask **tasks );
+
+double getTaskDensity( PeriodicTask *tasks, int taskCount );
+
+int getResponseTime( PeriodicTask *tasks, int taskCount, int taskIndex );
+
+int comparePeriods( const void *first, const void *second );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // DEADLINE_H
+//
@@ -0,0 +1,360 @@
+// Device Implementation File Information ///////////////////////////////
+/**
+* @file device.c
+*
+* @brief Implementation for device
+*
+* @details Implements all functions for the I/O device request queues
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of device
+*
+* @note Requires device.h
+*/
+
+#include "device.h"
+
+//
+// createDeviceQueues Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function creates an empty request queue for every I/O device
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @post cfData remains unchanged at post
+ *
+ * @param[in] cfData a pointer to a ConfigData struct
+ *
+ * @return a pointer to the new request queues (DeviceQueues *)
+ */
+DeviceQueues *createDeviceQueues( ConfigData *cfData )
+{
+    DeviceQueues *queues = malloc( sizeof( *queues ) );
+    Device *device;
+    int index;
+
+    for( index = 0; index < DEVICE_COUNT; index++ )
+    {
+        device = &queues->devices[ index ];
+
+        device->channels = cfData->deviceChannels[ index ];
+        device->channelFree = NULL;
+
+        if( device->channels > 0 )
+        {
+            device->channelFree = calloc( device->channels, sizeof( double ) );
+        }
+
+        device->waitingCapacity = DEVICE_START_CAPACITY;
+        device->waitingStarts = malloc( sizeof( double )
+                                        * device->waitingCapacity );
+        device->waitingHead = 0;
+        device->waitingCount = 0;
+        device->nextTicket = 0;
+        device->doneCount = 0;
+        device->requestCount = 0;
+        device->peakDepth = 0;
+        device->totalWait = 0;
+        device->maxWait = 0;
+        device->busyTime = 0;
+
+        pthread_mutex_init( &device->mutex, NULL );
+        pthread_cond_init( &device->channelFreed, NULL );
+    }
+
+    return queues;
+}
+//
+// freeDeviceQueues Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees the request queues of the I/O devices
+ *
+ * @pre no I/O op is using a device
+ *
+ * @param[in] queues a pointer to a DeviceQueues struct
+ *
+ * @return nothing to return (void)
+ */
+void freeDeviceQueues( DeviceQueues *queues )
+{
+    int index;
+
+    for( index = 0; index < DEVICE_COUNT; index++ )
+    {
+        pthread_mutex_destroy( &queues->devices[ index ].mutex );
+        pthread_cond_destroy( &queues->devices[ index ].channelFreed );
+        free( queues->devices[ index ].channelFree );
+        free( queues->devices[ index ].waitingStarts );
+    }
+
+    free( queues );
+}
+//
+// reserveDevice Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gives an I/O op started under the virtual clock the
+ *        first channel of its device to free up
+ *
+ * @details Ops that got a channel by the start time no longer count as
+ *          waiting, and the op itself waits if the channel is still busy.
+ *          An op on no known device, or on a device without a channel count,
+ *          never waits.
+ *
+ * @pre startTime is no earlier than the start of any op reserved before
+ *
+ * @post the channel is busy until the op ends at post
+ *
+ * @param[in,out] queues a pointer to a DeviceQueues struct
+ *
+ * @param[in] opString a pointer to the op string of the I/O op
+ *
+ * @param[in] startTime the time the op is started in sec
+ *
+ * @param[in] runTime the msec the op runs on the device
+ *
+ * @return the time the op gets a channel in sec (double)
+ */
+double reserveDevice( DeviceQueues *queues,
+                      char *opString,
+                      double startTime,
+                      int runTime )
+{
+    int index = getDeviceIndex( opString ), channel, freeChannel = 0;
+    double channelTime;
+    Device *device;
+
+    if( index == -1 )
+    {
+        return startTime;
+    }
+
+    device = &queues->devices[ index ];
+    device->busyTime += runTime;
+
+    if( device->channels == 0 )
+    {
+        recordDeviceWait( device, 0, 0 );
+        return startTime;
+    }
+
+    while( device->waitingCount > 0
+        && device->waitingStarts[ device->waitingHead ]
+                                     <= startTime + DEVICE_TIME_EPSILON )
+    {
+        device->waitingHead = ( device->waitingHead + 1 )
+                            % device->waitingCapacity;
+        device->waitingCount--;
+    }
+
+    for( channel = 1; channel < device->channels; channel++ )
+    {
+        if( device->channelFree[ channel ]
+                                    < device->channelFree[ freeChannel ] )
+        {
+            freeChannel = channel;
+        }
+    }
+
+    channelTime = device->channelFree[ freeChannel ];
+
+    // A channel freed at the start, less rounding, is free
+    if( channelTime <= startTime + DEVICE_TIME_EPSILON )
+    {
+        channelTime = startTime;
+    }
+    else
+    {
+        queueDeviceStart( device, channelTime );
+    }
+
+    device->channelFree[ freeChannel ] = channelTime + (double) runTime / 1000;
+    recordDeviceWait( device, ( channelTime - startTime ) * 1000,
+                      device->waitingCount );
+
+    return channelTime;
+}
+//
+// acquireDevice Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function waits for a channel of the device of an I/O op
+ *        under the real clock
+ *
+ * @details This function is run on the thread of the I/O op, which sleeps
+ *          until every op started on the device before it has a channel and
+ *          one is free. An op on no known device, or on a device without a
+ *          channel count, never waits.
+ *
+ * @post the op holds a channel until releaseDevice at post
+ *
+ * @param[in,out] queues a pointer to a DeviceQueues struct
+ *
+ * @param[in] opString a pointer to the op string of the I/O op
+ *
+ * @param[in] timer a pointer to the SimTimer of the run
+ *
+ * @return nothing to return (void)
+ */
+void acquireDevice( DeviceQueues *queues, char *opString, SimTimer *timer )
+{
+    int index = getDeviceIndex( opString );
+    char timeString[ 300 ];
+    double requestTime;
+    long long ticket, depth;
+    Device *device;
+
+    if( index == -1 )
+    {
+        return;
+    }
+
+    device = &queues->devices[ index ];
+    requestTime = accessTimer( timer, LAP_TIMER, timeString );
+
+    pthread_mutex_lock( &device->mutex );
+
+    if( device->channels == 0 )
+    {
+        recordDeviceWait( device, 0, 0 );
+        pthread_mutex_unlock( &device->mutex );
+        return;
+    }
+
+    ticket = device->nextTicket;
+    device->nextTicket++;
+    depth = device->nextTicket - device->doneCount - device->channels;
+
+    while( ticket >= device->doneCount + device->channels )
+    {
+        pthread_cond_wait( &device->channelFreed, &device->mutex );
+    }
+
+    recordDeviceWait( device,
+                      ( accessTimer( timer, LAP_TIMER, timeString )
+                        - requestTime ) * 1000,
+                      depth > 0 ? (int) depth : 0 );
+
+    pthread_mutex_unlock( &device->mutex );
+}
+//
+// releaseDevice Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees the channel an I/O op held under the real
+ *        clock
+ *
+ * @pre the op got its channel from acquireDevice
+ *
+ * @param[in,out] queues a pointer to a DeviceQueues struct
+ *
+ * @param[in] opString a pointer to the op string of the I/O op
+ *
+ * @param[in] runTime the msec the op ran on the device
+ *
+ * @return nothing to return (void)
+ */
+void releaseDevice( DeviceQueues *queues, char *opString, int runTime )
+{
+    int index = getDeviceIndex( opString );
+    Device *device;
+
+    if( index == -1 )
+    {
+        return;
+    }
+
+    device = &queues->devices[ index ];
+
+    pthread_mutex_lock( &device->mutex );
+
+    device->busyTime += runTime;
+
+    if( device->channels > 0 )
+    {
+        device->doneCount++;
+        pthread_cond_broadcast( &device->channelFreed );
+    }
+
+    pthread_mutex_unlock( &device->mutex );
+}
+//
+// recordDeviceWait Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds one I/O op to the totals of its device
+ *
+ * @param[in,out] device a pointer to a Device struct
+ *
+ * @param[in] waitTime the msec the op waited for a channel
+ *
+ * @param[in] depth the ops waiting for a channel once the op was started
+ *
+ * @return nothing to return (void)
+ */
+void recordDeviceWait( Device *device, double waitTime, int depth )
+{
+    device->requestCount++;
+    device->totalWait += waitTime;
+
+    if( waitTime > device->maxWait )
+    {
+        device->maxWait = waitTime;
+    }
+
+    if( depth > device->peakDepth )
+    {
+        device->peakDepth = depth;
+    }
+}
+//
+// queueDeviceStart Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds the time a waiting op gets a channel to the
+ *        back of the waiting ops of its device
+ *
+ * @details The ring of start times doubles when it is full, and is copied
+ *          in order so the front is the first element again.
+ *
+ * @param[in,out] device a pointer to a Device struct
+ *
+ * @param[in] startTime the time the op gets a channel in sec
+ *
+ * @return nothing to return (void)
+ */
+void queueDeviceStart( Device *device, double startTime )
+{
+    double *waitingStarts;
+    int index;
+
+    if( device->waitingCount == device->waitingCapacity )
+    {
+        waitingStarts = malloc( sizeof( double ) * device->waitingCapacity * 2 );
+
+        for( index = 0; index < device->waitingCount; index++ )
+        {
+            waitingStarts[ index ] = device->waitingStarts[
+                ( device->waitingHead + index ) % device->waitingCapacity ];
+        }
+
+        free( device->waitingStarts );
+        device->waitingStarts = waitingStarts;
+        device->waitingCapacity *= 2;
+        device->waitingHead = 0;
+    }
+
+    device->waitingStarts[ ( device->waitingHead + device->waitingCount )
+                           % device->waitingCapacity ] = startTime;
+    device->waitingCount++;
+}
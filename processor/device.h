@@ -0,0 +1,111 @@
+// Device Header Information ////////////////////////////////////////
+/**
+* @file device.h
+*
+* @brief Header file for device
+*
+* @details Specifies constants, simple data structures, included libraries,
+*          and function declarations used in the I/O device request queues
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of device
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides a request queue for each I/O device. A device with a
+  channel count serves that many I/O ops at once, and the ops started while
+  every channel is busy wait in the order they were started.
+
+  Under the virtual clock ops are started in time order, so the time an op
+  gets a channel is known when it starts: the time the first channel frees
+  up, or the start if one is free. The op's interupt is given that time plus
+  its run time, and nothing waits on a thread. Under the real clock each I/O
+  thread takes a ticket and sleeps until the ticket is one of the first
+  channel count tickets not yet served.
+
+  The wait, queue depth and busy time of each device are kept for the
+  summary at the end of the run
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef DEVICE_H
+#define DEVICE_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "configParser.h"
+#include "simTimer.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+
+// Waiting ops the queue of a device has room for before it grows
+#define DEVICE_START_CAPACITY 16
+
+// Slack in sec when checking if a channel is free, as the interupt of the op
+// that held it may be handled a rounding error early
+#define DEVICE_TIME_EPSILON 1e-9
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+typedef struct Device
+{
+  // Ops served at once, 0 for as many as are started
+  int channels;
+  // Sec each channel is next free, under the virtual clock
+  double *channelFree;
+  // Sec each waiting op gets a channel, in the order they do, under the
+  // virtual clock
+  double *waitingStarts;
+  int waitingHead;
+  int waitingCount;
+  int waitingCapacity;
+  // Tickets taken and ops finished, under the real clock
+  long long nextTicket;
+  long long doneCount;
+  pthread_mutex_t mutex;
+  pthread_cond_t channelFreed;
+  // Totals of the run, times in msec
+  int requestCount;
+  int peakDepth;
+  double totalWait;
+  double maxWait;
+  double busyTime;
+} Device;
+
+typedef struct DeviceQueues
+{
+  Device devices[ DEVICE_COUNT ];
+} DeviceQueues;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+DeviceQueues *createDeviceQueues( ConfigData *cfData );
+
+void freeDeviceQueues( DeviceQueues *queues );
+
+double reserveDevice( DeviceQueues *queues,
+                      char *opString,
+                      double startTime,
+                      int runTime );
+
+void acquireDevice( DeviceQueues *queues, char *opString, SimTimer *timer );
+
+void releaseDevice( DeviceQueues *queues, char *opString, int runTime );
+
+void recordDeviceWait( Device *device, double waitTime, int depth );
+
+void queueDeviceStart( Device *device, double startTime );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // DEVICE_H
+//
@@ -11,19 +11,58 @@
 * C.S student (22 April 2018)
 * Initial creation of interupt
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Added the pending interupt queue used by the virtual clock
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* deliverInterupts allows for rounding of the virtual time, which could leave
+* an interupt pending forever while the CPU idled
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* Interupt queues and mutexes moved into SimContext
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* handleInterupt records the I/O handling latency
+*
+* @version 1.50
+* C.S student (18 October 2026)
+* handleInterupt traces the interupt and its I/O op
+*
+* @version 1.60
+* C.S student (18 October 2026)
+* Interupts are counted in the runtime counters
+*
+* @version 1.70
+* C.S student (18 October 2026)
+* Interupt log lines go through the tracing macros
+*
+* @version 1.80
+* C.S student (18 October 2026)
+* MLFQ-P processes move up a level when their I/O ends
+*
+* @version 1.90
+* C.S student (18 October 2026)
+* I/O waits for a channel of its device when devices have channel counts
+*
+* @version 2.00
+* C.S student (18 October 2026)
+* The interupt queues grow as needed instead of overflowing, and pending
+* interupts are kept in a heap so starting I/O no longer shifts the queue
+*
+* @version 2.10
+* C.S student (18 October 2026)
+* I/O threads release their counter block before their interupt is queued
+* up to be handled, and the controller thread before it starts one
+*
 * @note Requires interupt.h
 */
 
 #include "interupt.h"
 
-Interupt interuptQueue[500];
-int interuptQueueIterator = -1;
-
-pthread_mutex_t interuptMutex = PTHREAD_MUTEX_INITIALIZER;
-pthread_mutex_t controlMutex = PTHREAD_MUTEX_INITIALIZER;
-pthread_mutex_t stringMutex = PTHREAD_MUTEX_INITIALIZER;
-pthread_mutex_t timerMutex = PTHREAD_MUTEX_INITIALIZER;
-
 //
 // runTimerIOInterupt Function Implementation ///////////////////////////////////
 //
@@ -33,7 +72,8 @@ pthread_mutex_t timerMutex = PTHREAD_MUTEX_INITIALIZER;
  *
  * @details This function processes an interupt by running a timer for a
  *          specific amount of time, then updating the process and interupt
- *          queue.
+ *          queue. When devices have channel counts the timer only starts
+ *          once the I/O has a channel of its device.
  *
  * @pre interupt a void pointer to (theoretically) an interupt struct
  *
@@ -48,20 +88,36 @@ void *runTimerIOInterupt( void* interupt )
     float clockTime;
     char timeString[300];
     int runTime;
+    SimContext *context = ((Interupt *)interupt)->context;
 
     runTime = ((Interupt *)interupt)->runTime;
 
+    if( context->devices != NULL )
+    {
+        acquireDevice( context->devices, ((Interupt *)interupt)->opString,
+                       &context->timer );
+    }
+
     runTimer(runTime);
+
+    if( context->devices != NULL )
+    {
+        releaseDevice( context->devices, ((Interupt *)interupt)->opString,
+                       runTime );
+    }
+
     ((Interupt *)interupt)->process->processTime -= runTime;
 
-    pthread_mutex_lock(&interuptMutex);
-    clockTime = accessTimer(LAP_TIMER, timeString);
+    pthread_mutex_lock(&context->interuptMutex);
+    clockTime = accessTimer(&context->timer, LAP_TIMER, timeString);
 
     ((Interupt *) interupt)->endTime = clockTime;
 
-    interuptQueueIterator += 1;
-    interuptQueue[interuptQueueIterator] = *(Interupt *)interupt;
-    pthread_mutex_unlock(&interuptMutex);
+    raiseInterupt( context, (Interupt *)interupt );
+
+    // Once unlocked the run can end and free the counters
+    releaseCounterBlock( &context->counters );
+    pthread_mutex_unlock(&context->interuptMutex);
 
     return NULL;
 }
@@ -75,6 +131,11 @@ void *runTimerIOInterupt( void* interupt )
  * @details This function sends out a runTimerIOInterupt on a thread for
  *          processing.
  *
+ * @par Algorithm
+ *      The thread is counted and this thread's counter block released
+ *      before the I/O thread starts, as the run can end and free the
+ *      context as soon as its interupt is handled.
+ *
  * @pre interupt a void pointer to (theoretically) an interupt struct
  *
  * @post interupt remains unchanged at post
@@ -85,7 +146,9 @@ void *runTimerIOInterupt( void* interupt )
  */
 void *controllerThread(void *interupt)
 {
-    pthread_mutex_lock(&controlMutex);
+    SimContext *context = ((Interupt *)interupt)->context;
+
+    pthread_mutex_lock(&context->controlMutex);
     pthread_t contollerThread;
     // Do thread initialization cus I'm dumb
     pthread_attr_t attr;
@@ -96,12 +159,16 @@ void *controllerThread(void *interupt)
 
     int rc;
 
+    countEvent( &context->counters, THREAD_CREATED_COUNTER, 1 );
+    releaseCounterBlock( &context->counters );
+    pthread_mutex_unlock(&context->controlMutex);
+
     if( (rc = pthread_create( &contollerThread, &attr, &runTimerIOInterupt, interupt )) )
     {
         printf( "Thread creation failed\n" );
-        return NULL;
     }
-    pthread_mutex_unlock(&controlMutex);
+
+    pthread_attr_destroy(&attr);
 
     return NULL;
 }
@@ -115,36 +182,32 @@ void *controllerThread(void *interupt)
  * @details This function processes the interupt queue and resolves all
  *          until the queue is empty interupts.
  *
- * @pre cfData a pointer to a ConfigData struct
+ * @pre context a pointer to a SimContext struct
  *
- * @pre startNode a pointer to a StringNode struct
+ * @post context remains unchanged at post
  *
- * @post cfData and startNode remain unchanged at post
- *
- * @param[in] cfData a pointer to a ConfigData struct
- *
- * @param[in] startNode a pointer to a StringNode struct
+ * @param[in] context a pointer to a SimContext struct
  *
  * @return nothing to return (void)
  */
-void resolveInterupts( ConfigData *cfData, StringNode *startNode )
+void resolveInterupts( SimContext *context )
 {
     char timeString[300];
-    float time;
 
-    pthread_mutex_lock(&interuptMutex);
+    pthread_mutex_lock(&context->interuptMutex);
 
-    time = accessTimer(LAP_TIMER, timeString);
-    logLine( cfData, startNode,
-             "Time:%10.6lf, OS: Handling Interupts\n",
-             time);
+    TRACE_EVENT( context,
+                 "Time:%10.6lf, OS: Handling Interupts\n",
+                 TRACE_TIME( context, timeString ) );
 
-    for(; interuptQueueIterator > -1; interuptQueueIterator--)
+    for(; context->interuptQueueIterator > -1;
+          context->interuptQueueIterator--)
     {
-        handleInterupt(interuptQueue[interuptQueueIterator], cfData, startNode);
+        handleInterupt(context->interuptQueue[context->interuptQueueIterator],
+                       context);
     }
 
-    pthread_mutex_unlock(&interuptMutex);
+    pthread_mutex_unlock(&context->interuptMutex);
 }
 //
 // handleInterupt Function Implementation ///////////////////////////////////
@@ -159,41 +222,60 @@ void resolveInterupts( ConfigData *cfData, StringNode *startNode )
  *
  * @pre interupt a pointer to an interupt struct
  *
- * @pre cfData a pointer to a ConfigData struct
+ * @pre context a pointer to a SimContext struct
  *
- * @pre startNode a pointer to a StringNode struct
- *
- * @post interupt, cfData, and startNode remain unchanged at post
+ * @post interupt and context remain unchanged at post
  *
  * @param[in] interupt a pointer to an interupt struct
  *
- * @param[in] cfData a pointer to a ConfigData struct
- *
- * @param[in] startNode a pointer to a StringNode struct
+ * @param[in] context a pointer to a SimContext struct
  *
  * @return nothing to return (void)
  */
-void handleInterupt(Interupt interupt, ConfigData *cfData, StringNode *startNode)
+void handleInterupt(Interupt interupt, SimContext *context)
 {
-    StringNode *newNode = malloc( sizeof(*newNode) );
     char timeString[300];
+    double handleTime;
     float time;
 
-    time = accessTimer(LAP_TIMER, timeString);
+    handleTime = accessTimer(&context->timer, LAP_TIMER, timeString);
+    time = handleTime;
+
+    countEvent( &context->counters, INTERUPT_HANDLED_COUNTER, 1 );
 
-    logLine( cfData, startNode,
-             "Time:%10.6lf, OS: Interupt, Process %d\n",
-             time, interupt.process->processNum );
+    // Time from the I/O finishing to the OS handling it, in usec
+    recordHistogramValue( &context->runMetrics.ioHandleLatency,
+                          (long long) ( ( handleTime - interupt.endTime )
+                                        * 1000000 ) );
 
-    time = accessTimer(LAP_TIMER, timeString);
+    if( checkTracing( &context->trace ) == True )
+    {
+        sprintf( timeString, "Interupt, Process %d",
+                 interupt.process->processNum );
+        traceInstant( &context->trace, TRACE_CPU_PID, TRACE_CORE_TID,
+                      timeString, "interupt", handleTime );
+        traceDeviceSlice( context, interupt.process, interupt.opString,
+                          interupt.opPrint, interupt.endTime,
+                          interupt.runTime );
+    }
 
-    logLine( cfData, startNode,
-             "Time:%10.6lf, Process %d, %s %s end\n",
-             time, interupt.process->processNum,
-                   interupt.opString,
-                   interupt.opPrint );
+    TRACE_EVENT( context,
+                 "Time:%10.6lf, OS: Interupt, Process %d\n",
+                 time, interupt.process->processNum );
 
-    setState( cfData, startNode, interupt.process, READY );
+    TRACE_OP( context,
+              "Time:%10.6lf, Process %d, %s %s end\n",
+              TRACE_TIME( context, timeString ),
+              interupt.process->processNum,
+              interupt.opString,
+              interupt.opPrint );
+
+    if( context->mlfq != NULL )
+    {
+        promoteMlfqProcess( context->mlfq, interupt.process );
+    }
+
+    setState( context, interupt.process, READY );
 }
 //
 // createInterupt Function Implementation ///////////////////////////////////
@@ -205,6 +287,8 @@ void handleInterupt(Interupt interupt, ConfigData *cfData, StringNode *startNode
  * @details This function allocates memory for an interupt, initializes all values
  *          and then returns said interupt.
  *
+ * @pre context a pointer to a SimContext struct
+ *
  * @pre process a pointer to a PCB struct
  *
  * @pre runTime total runtime in milliseconds
@@ -215,6 +299,8 @@ void handleInterupt(Interupt interupt, ConfigData *cfData, StringNode *startNode
  *
  * @post process, runTime, opString, and opPrint remain unchanged at post
  *
+ * @param[in] context a pointer to a SimContext struct
+ *
  * @param[in] process a pointer to a PCB struct
  *
  * @param[in] runTime total runtime in milliseconds
@@ -225,7 +311,8 @@ void handleInterupt(Interupt interupt, ConfigData *cfData, StringNode *startNode
  *
  * @return the pointer to a newly created interupt struct (Interupt *)
  */
-Interupt *createInterupt( PCB *process,
+Interupt *createInterupt( SimContext *context,
+                          PCB *process,
                           int runTime,
                           char *opString,
                           char *opPrint )
@@ -233,8 +320,10 @@ Interupt *createInterupt( PCB *process,
     Interupt *newInterupt = malloc( sizeof(*newInterupt) );
 
     newInterupt->process = process;
+    newInterupt->context = context;
     newInterupt->runTime = runTime;
     newInterupt->endTime = -1;
+    newInterupt->startOrder = 0;
     newInterupt->opString = opString;
     newInterupt->opPrint = opPrint;
 
@@ -262,3 +351,276 @@ void displayInterupt(Interupt interupt)
     printf("ProcessId: %d\nRun Time: %d\nEnd Time: %f\n",
             interupt.process->processNum, interupt.runTime, interupt.endTime);
 }
+//
+// queueInterupt Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function starts an I/O operation under the virtual clock.
+ *
+ * @details This function is the virtual clock version of controllerThread.
+ *          Instead of running a timer on a thread, the interupt is given
+ *          the time its I/O ends and is kept until the clock gets there.
+ *          The I/O ends its run time after it gets a channel of its device.
+ *
+ * @par Algorithm
+ *      Pending interupts are a heap with the earliest end time at the top,
+ *      equal end times in the order started, so starting I/O and taking the
+ *      next one to end are both O(log n).
+ *
+ * @pre interupt a pointer to an interupt made by createInterupt
+ *
+ * @post interupt has been copied into the pending queue and freed
+ *
+ * @param[in] interupt a pointer to an interupt struct
+ *
+ * @return nothing to return (void)
+ */
+void queueInterupt( Interupt *interupt )
+{
+    char timeString[300];
+    SimContext *context = interupt->context;
+
+    interupt->endTime = accessTimer(&context->timer, LAP_TIMER, timeString);
+
+    if( context->devices != NULL )
+    {
+        interupt->endTime = reserveDevice( context->devices,
+                                           interupt->opString,
+                                           interupt->endTime,
+                                           interupt->runTime );
+    }
+
+    interupt->endTime += (double) interupt->runTime / 1000;
+
+    pthread_mutex_lock(&context->interuptMutex);
+
+    interupt->startOrder = context->nextInteruptOrder;
+    context->nextInteruptOrder++;
+    pushPendingInterupt( context, interupt );
+
+    pthread_mutex_unlock(&context->interuptMutex);
+
+    free( interupt );
+}
+//
+// deliverInterupts Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function moves finished I/O into the interupt queue.
+ *
+ * @details This function does what runTimerIOInterupt does when its timer
+ *          runs out, for every pending interupt that has ended by the
+ *          current virtual time.
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @post finished interupts are in the interupt queue at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return nothing to return (void)
+ */
+void deliverInterupts( SimContext *context )
+{
+    Interupt interupt;
+    char timeString[300];
+    double currentTime = accessTimer(&context->timer, LAP_TIMER, timeString);
+
+    pthread_mutex_lock(&context->interuptMutex);
+
+    while( context->pendingInteruptCount > 0
+        && context->pendingInterupts[ 0 ].endTime
+                                   <= currentTime + INTERUPT_TIME_EPSILON )
+    {
+        popPendingInterupt( context, &interupt );
+        interupt.process->processTime -= interupt.runTime;
+
+        raiseInterupt( context, &interupt );
+    }
+
+    pthread_mutex_unlock(&context->interuptMutex);
+}
+//
+// getNextInteruptTime Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the time the next pending I/O ends.
+ *
+ * @details This function returns the end time of the earliest pending
+ *          interupt under the virtual clock.
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return the end time in seconds, or -1 if nothing is pending (double)
+ */
+double getNextInteruptTime( SimContext *context )
+{
+    double endTime = -1;
+
+    pthread_mutex_lock(&context->interuptMutex);
+
+    if( context->pendingInteruptCount > 0 )
+    {
+        endTime = context->pendingInterupts[ 0 ].endTime;
+    }
+
+    pthread_mutex_unlock(&context->interuptMutex);
+
+    return endTime;
+}
+//
+// raiseInterupt Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds finished I/O to the interupt queue.
+ *
+ * @details The queue doubles when it is full, so any number of interupts
+ *          can wait to be handled.
+ *
+ * @pre the interupt mutex of context is held
+ *
+ * @param[in,out] context a pointer to a SimContext struct
+ *
+ * @param[in] interupt a pointer to the interupt, which is copied
+ *
+ * @return nothing to return (void)
+ */
+void raiseInterupt( SimContext *context, Interupt *interupt )
+{
+    if( context->interuptQueueIterator + 1 == context->interuptQueueCapacity )
+    {
+        context->interuptQueueCapacity *= 2;
+        context->interuptQueue = realloc( context->interuptQueue,
+                                          sizeof( Interupt )
+                                          * context->interuptQueueCapacity );
+    }
+
+    context->interuptQueueIterator += 1;
+    context->interuptQueue[context->interuptQueueIterator] = *interupt;
+    countEvent( &context->counters, INTERUPT_RAISED_COUNTER, 1 );
+    countPeak( &context->counters, INTERUPT_QUEUE_PEAK,
+               context->interuptQueueIterator + 1 );
+}
+//
+// checkInteruptBefore Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if one pending interupt ends before another
+ *
+ * @details Interupts with the same end time are ordered by when their I/O
+ *          was started.
+ *
+ * @param[in] first a pointer to an interupt struct
+ *
+ * @param[in] second a pointer to an interupt struct
+ *
+ * @return True if first comes before second, False otherwise (Boolean)
+ */
+Boolean checkInteruptBefore( Interupt *first, Interupt *second )
+{
+    if( first->endTime < second->endTime
+     || ( first->endTime == second->endTime
+       && first->startOrder < second->startOrder ) )
+    {
+        return True;
+    }
+
+    return False;
+}
+//
+// pushPendingInterupt Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds an interupt to the pending heap.
+ *
+ * @details The heap doubles when it is full.
+ *
+ * @pre the interupt mutex of context is held
+ *
+ * @param[in,out] context a pointer to a SimContext struct
+ *
+ * @param[in] interupt a pointer to the interupt, which is copied
+ *
+ * @return nothing to return (void)
+ */
+void pushPendingInterupt( SimContext *context, Interupt *interupt )
+{
+    int index = context->pendingInteruptCount, parent;
+
+    if( index == context->pendingInteruptCapacity )
+    {
+        context->pendingInteruptCapacity *= 2;
+        context->pendingInterupts = realloc( context->pendingInterupts,
+                                             sizeof( Interupt )
+                                       * context->pendingInteruptCapacity );
+    }
+
+    while( index > 0 )
+    {
+        parent = ( index - 1 ) / 2;
+
+        if( checkInteruptBefore( interupt,
+                           &context->pendingInterupts[ parent ] ) == False )
+        {
+            break;
+        }
+
+        context->pendingInterupts[ index ] = context->pendingInterupts[ parent ];
+        index = parent;
+    }
+
+    context->pendingInterupts[ index ] = *interupt;
+    context->pendingInteruptCount++;
+}
+//
+// popPendingInterupt Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function takes the interupt that ends first from the pending
+ *        heap.
+ *
+ * @pre the interupt mutex of context is held and an interupt is pending
+ *
+ * @param[in,out] context a pointer to a SimContext struct
+ *
+ * @param[out] interupt a pointer to an interupt struct to copy it into
+ *
+ * @return nothing to return (void)
+ */
+void popPendingInterupt( SimContext *context, Interupt *interupt )
+{
+    int index = 0, child;
+    Interupt *heap = context->pendingInterupts;
+    Interupt *last;
+
+    *interupt = heap[ 0 ];
+    context->pendingInteruptCount--;
+    last = &heap[ context->pendingInteruptCount ];
+
+    while( ( child = index * 2 + 1 ) < context->pendingInteruptCount )
+    {
+        if( child + 1 < context->pendingInteruptCount
+         && checkInteruptBefore( &heap[ child + 1 ],
+                                 &heap[ child ] ) == True )
+        {
+            child++;
+        }
+
+        if( checkInteruptBefore( &heap[ child ], last ) == False )
+        {
+            break;
+        }
+
+        heap[ index ] = heap[ child ];
+        index = child;
+    }
+
+    heap[ index ] = *last;
+}
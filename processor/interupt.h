@@ -11,6 +11,23 @@
 * C.S student (22 April 2018)
 * Initial creation of interupt
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Added the pending interupt queue used by the virtual clock
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* Added INTERUPT_TIME_EPSILON
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* Interupt queues and mutexes moved into SimContext
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* The interupt queues grow as needed, and pending interupts are kept in a
+* heap
+*
 * @note None
 */
 
@@ -40,8 +57,12 @@
 typedef struct Interupt
 {
   struct PCB *process;
+  // Simulation the interupt belongs to
+  struct SimContext *context;
   int runTime;
-  float endTime;
+  double endTime;
+  // Order the I/O was started in, which settles equal end times
+  long long startOrder;
   char *opString;
   char *opPrint;
 } Interupt;
@@ -50,12 +71,12 @@ typedef struct Interupt
 // Global Constant Definitions ////////////////////////////////////
 //
 
-extern Interupt interuptQueue[500];
-extern int interuptQueueIterator;
-extern pthread_mutex_t interuptMutex;
-extern pthread_mutex_t controlMutex;
-extern pthread_mutex_t stringMutex;
-extern pthread_mutex_t timerMutex;
+// Interupts each queue of a simulation has room for before it doubles
+#define INTERUPT_QUEUE_SIZE 500
+
+// Slack in sec when checking if a pending interupt has ended, the idle CPU
+// moves the virtual clock to an end time through msec and back
+#define INTERUPT_TIME_EPSILON 1e-9
 //
 // Function Prototypes ///////////////////////////////////////
 //
@@ -63,16 +84,31 @@ void *runTimerIOInterupt(void* interupt);
 
 void *controllerThread(void *interupt);
 
-void resolveInterupts(ConfigData *cfData, StringNode *startNode);
+void resolveInterupts(struct SimContext *context);
 
-void handleInterupt(Interupt interupt, ConfigData *cfData, StringNode *startNode);
+void handleInterupt(Interupt interupt, struct SimContext *context);
 
-Interupt *createInterupt( struct PCB *processId,
+Interupt *createInterupt( struct SimContext *context,
+                          struct PCB *processId,
                           int runTime,
                           char *opString,
                           char *opPrint );
 
 void displayInterupt(Interupt interupt);
+
+void queueInterupt( Interupt *interupt );
+
+void deliverInterupts( struct SimContext *context );
+
+double getNextInteruptTime( struct SimContext *context );
+
+void raiseInterupt( struct SimContext *context, Interupt *interupt );
+
+Boolean checkInteruptBefore( Interupt *first, Interupt *second );
+
+void pushPendingInterupt( struct SimContext *context, Interupt *interupt );
+
+void popPendingInterupt( struct SimContext *context, Interupt *interupt );
 //
 // Terminating Precompiler Directives ///////////////////////////////
 //
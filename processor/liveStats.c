@@ -0,0 +1,444 @@
+// LiveStats Implementation File Information ///////////////////////////////
+/**
+* @file liveStats.c
+*
+* @brief Implementation for liveStats
+*
+* @details Implements all functions for serving the progress of a run over a
+*          Unix domain socket
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of liveStats
+*
+* @note Requires liveStats.h
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "liveStats.h"
+
+// Names of the process states in the order of STATE in processor.h
+static const char *liveStateNames[ LIVE_STATE_COUNT ] =
+{
+    "new", "ready", "blocked", "exit", "running"
+};
+
+//
+// initLiveStats Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function initializes a LiveStats struct that is not serving
+ *
+ * @pre stats a pointer to a LiveStats struct that is not serving
+ *
+ * @post stats holds no progress at post
+ *
+ * @param[out] stats a pointer to a LiveStats struct
+ *
+ * @param[in] counters a pointer to the CounterSet of the run
+ *
+ * @return nothing to return (void)
+ */
+void initLiveStats( LiveStats *stats, CounterSet *counters )
+{
+    int state;
+
+    stats->simTimeUSec = 0;
+
+    for( state = 0; state < LIVE_STATE_COUNT; state++ )
+    {
+        stats->stateCounts[ state ] = 0;
+    }
+
+    stats->queuedInterupts = 0;
+    stats->pendingInterupts = 0;
+    stats->memoryTotal = 0;
+    stats->memoryAvailable = 0;
+    stats->counters = counters;
+
+    stats->socketPath = NULL;
+    stats->socketFd = -1;
+    stats->serving = False;
+    stats->lastEvents = 0;
+    stats->lastHostNanoSec = 0;
+}
+//
+// startStatsServer Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function starts serving a run on a Unix domain socket
+ *
+ * @details This function binds the socket, removing a socket file left by an
+ *          earlier run, and starts the server thread.
+ *
+ * @pre stats a pointer to a LiveStats struct that is not serving
+ *
+ * @post stats is serving at post if True is returned
+ *
+ * @exception badSocket
+ *            If the socket can not be made, bound or listened on, or the
+ *            path is too long, return False.
+ *
+ * @param[in,out] stats a pointer to a LiveStats struct
+ *
+ * @param[in] socketPath the path of the socket
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean startStatsServer( LiveStats *stats, char *socketPath )
+{
+    struct sockaddr_un address;
+
+    if( stringLen( socketPath ) >= (int) sizeof( address.sun_path ) )
+    {
+        return False;
+    }
+
+    memset( &address, 0, sizeof( address ) );
+    address.sun_family = AF_UNIX;
+    strcpy( address.sun_path, socketPath );
+
+    stats->socketFd = socket( AF_UNIX, SOCK_STREAM, 0 );
+
+    if( stats->socketFd < 0 )
+    {
+        return False;
+    }
+
+    unlink( socketPath );
+
+    if( bind( stats->socketFd, (struct sockaddr *) &address,
+              sizeof( address ) ) != 0
+     || listen( stats->socketFd, 4 ) != 0 )
+    {
+        close( stats->socketFd );
+        stats->socketFd = -1;
+        return False;
+    }
+
+    stats->socketPath = socketPath;
+    stats->lastEvents = 0;
+    stats->lastHostNanoSec = getHostNanoSec();
+    __atomic_store_n( &stats->serving, True, __ATOMIC_RELEASE );
+
+    if( pthread_create( &stats->serverThread, NULL, serveStats, stats ) != 0 )
+    {
+        stats->serving = False;
+        stats->socketPath = NULL;
+        close( stats->socketFd );
+        stats->socketFd = -1;
+        unlink( socketPath );
+        return False;
+    }
+
+    return True;
+}
+//
+// stopStatsServer Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function stops serving a run
+ *
+ * @details This function waits up to LIVE_POLL_MSEC for the server thread
+ *          to see it should end, then closes and removes the socket.
+ *
+ * @pre stats a pointer to a LiveStats struct
+ *
+ * @post stats is not serving at post
+ *
+ * @param[in,out] stats a pointer to a LiveStats struct
+ *
+ * @return nothing to return (void)
+ */
+void stopStatsServer( LiveStats *stats )
+{
+    if( stats->socketPath == NULL )
+    {
+        return;
+    }
+
+    __atomic_store_n( &stats->serving, False, __ATOMIC_RELEASE );
+    pthread_join( stats->serverThread, NULL );
+
+    close( stats->socketFd );
+    unlink( stats->socketPath );
+
+    stats->socketFd = -1;
+    stats->socketPath = NULL;
+}
+//
+// serveStats Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function answers connections until the run ends
+ *
+ * @details This function is the server thread. It waits for connections a
+ *          LIVE_POLL_MSEC at a time, so it sees the end of the run, and
+ *          answers each connection before taking the next.
+ *
+ * @param[in] stats a void pointer to a LiveStats struct
+ *
+ * @return null for running on a thread (void *)
+ */
+void *serveStats( void *stats )
+{
+    LiveStats *liveStats = stats;
+    struct pollfd socketPoll;
+    int clientFd;
+
+    socketPoll.fd = liveStats->socketFd;
+    socketPoll.events = POLLIN;
+
+    while( __atomic_load_n( &liveStats->serving, __ATOMIC_ACQUIRE ) == True )
+    {
+        if( poll( &socketPoll, 1, LIVE_POLL_MSEC ) <= 0 )
+        {
+            continue;
+        }
+
+        clientFd = accept( liveStats->socketFd, NULL, NULL );
+
+        if( clientFd >= 0 )
+        {
+            answerStatsRequest( liveStats, clientFd );
+            close( clientFd );
+        }
+    }
+
+    return NULL;
+}
+//
+// answerStatsRequest Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function answers one connection
+ *
+ * @details This function reads a request line of "json" or "text". A client
+ *          that sends nothing within LIVE_POLL_MSEC is answered in text, so
+ *          a bare connect, as from socat or nc -U, works.
+ *
+ * @param[in,out] stats a pointer to a LiveStats struct
+ *
+ * @param[in] clientFd the connected socket
+ *
+ * @return nothing to return (void)
+ */
+void answerStatsRequest( LiveStats *stats, int clientFd )
+{
+    char request[ LIVE_REQUEST_SIZE ] = "";
+    char answer[ LIVE_ANSWER_SIZE ];
+    struct pollfd clientPoll;
+    int answerLength, sent, written = 0;
+
+    clientPoll.fd = clientFd;
+    clientPoll.events = POLLIN;
+
+    if( poll( &clientPoll, 1, LIVE_POLL_MSEC ) > 0 )
+    {
+        sent = read( clientFd, request, LIVE_REQUEST_SIZE - 1 );
+        request[ sent > 0 ? sent : 0 ] = '\0';
+    }
+
+    answerLength = writeLiveStats( stats, answer,
+                                   strncmp( request, "json", 4 ) == 0 );
+
+    while( written < answerLength )
+    {
+        sent = send( clientFd, answer + written, answerLength - written,
+                     MSG_NOSIGNAL );
+
+        if( sent <= 0 )
+        {
+            return;
+        }
+
+        written += sent;
+    }
+}
+//
+// writeLiveStats Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes the progress of a run
+ *
+ * @details This function writes the simulated time, the processes in each
+ *          state, the interupts queued to be handled and still running, the
+ *          memory in use and the events (log lines) so far. Events per sec
+ *          are the events since the last answer over the host time since.
+ *
+ * @pre answer a pointer to LIVE_ANSWER_SIZE chars
+ *
+ * @post answer holds the progress at post
+ *
+ * @param[in,out] stats a pointer to a LiveStats struct
+ *
+ * @param[out] answer a pointer to LIVE_ANSWER_SIZE chars
+ *
+ * @param[in] json True for a JSON object, False for name=value lines
+ *
+ * @return the length of the answer (int)
+ */
+int writeLiveStats( LiveStats *stats, char *answer, Boolean json )
+{
+    int state, length, stateCounts[ LIVE_STATE_COUNT ];
+    long long counterTotals[ COUNTER_COUNT ], hostNanoSec;
+    double simTime, eventRate = 0;
+    int queued, pending, memoryTotal, memoryUsed;
+
+    simTime = __atomic_load_n( &stats->simTimeUSec, __ATOMIC_RELAXED )
+              / 1000000.0;
+
+    for( state = 0; state < LIVE_STATE_COUNT; state++ )
+    {
+        stateCounts[ state ] = __atomic_load_n( &stats->stateCounts[ state ],
+                                                __ATOMIC_RELAXED );
+    }
+
+    queued = __atomic_load_n( &stats->queuedInterupts, __ATOMIC_RELAXED );
+    pending = __atomic_load_n( &stats->pendingInterupts, __ATOMIC_RELAXED );
+    memoryTotal = __atomic_load_n( &stats->memoryTotal, __ATOMIC_RELAXED );
+    memoryUsed = memoryTotal - __atomic_load_n( &stats->memoryAvailable,
+                                                __ATOMIC_RELAXED );
+
+    readCounters( stats->counters, counterTotals );
+    hostNanoSec = getHostNanoSec();
+
+    if( hostNanoSec > stats->lastHostNanoSec )
+    {
+        eventRate = ( counterTotals[ LOG_LINE_COUNTER ] - stats->lastEvents )
+                    * 1e9 / ( hostNanoSec - stats->lastHostNanoSec );
+    }
+
+    stats->lastEvents = counterTotals[ LOG_LINE_COUNTER ];
+    stats->lastHostNanoSec = hostNanoSec;
+
+    if( json == True )
+    {
+        length = sprintf( answer, "{\"time\":%.6f,\"states\":{", simTime );
+
+        for( state = 0; state < LIVE_STATE_COUNT; state++ )
+        {
+            length += sprintf( answer + length, "%s\"%s\":%d",
+                               state > 0 ? "," : "",
+                               liveStateNames[ state ], stateCounts[ state ] );
+        }
+
+        length += sprintf( answer + length,
+                           "},\"interupts_queued\":%d," \
+                           "\"interupts_pending\":%d," \
+                           "\"memory_used\":%d,\"memory_total\":%d," \
+                           "\"events\":%lld,\"events_per_sec\":%.1f}\n",
+                           queued, pending, memoryUsed, memoryTotal,
+                           counterTotals[ LOG_LINE_COUNTER ], eventRate );
+
+        return length;
+    }
+
+    length = sprintf( answer, "time=%.6f\n", simTime );
+
+    for( state = 0; state < LIVE_STATE_COUNT; state++ )
+    {
+        length += sprintf( answer + length, "%s=%d\n",
+                           liveStateNames[ state ], stateCounts[ state ] );
+    }
+
+    length += sprintf( answer + length,
+                       "interupts_queued=%d\ninterupts_pending=%d\n" \
+                       "memory_used=%d\nmemory_total=%d\n" \
+                       "events=%lld\nevents_per_sec=%.1f\n",
+                       queued, pending, memoryUsed, memoryTotal,
+                       counterTotals[ LOG_LINE_COUNTER ], eventRate );
+
+    return length;
+}
+//
+// setLiveState Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function moves processes from one state count to another
+ *
+ * @details This function is only called by the processing thread, so a
+ *          relaxed load and store is enough for the server thread to see
+ *          whole counts.
+ *
+ * @param[in,out] stats a pointer to a LiveStats struct
+ *
+ * @param[in] oldState the STATE the processes leave, or -1 for new PCBs
+ *
+ * @param[in] newState the STATE the processes enter
+ *
+ * @param[in] count the number of processes
+ *
+ * @return nothing to return (void)
+ */
+void setLiveState( LiveStats *stats, int oldState, int newState, int count )
+{
+    int *stateCount;
+
+    if( oldState >= 0 )
+    {
+        stateCount = &stats->stateCounts[ oldState ];
+        __atomic_store_n( stateCount, *stateCount - count, __ATOMIC_RELAXED );
+    }
+
+    stateCount = &stats->stateCounts[ newState ];
+    __atomic_store_n( stateCount, *stateCount + count, __ATOMIC_RELAXED );
+}
+//
+// setLiveProgress Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function stores the simulated time and interupt queues
+ *
+ * @param[in,out] stats a pointer to a LiveStats struct
+ *
+ * @param[in] simTime the simulated time in sec
+ *
+ * @param[in] queuedInterupts interupts waiting to be handled
+ *
+ * @param[in] pendingInterupts I/O ops still running under the virtual clock
+ *
+ * @return nothing to return (void)
+ */
+void setLiveProgress( LiveStats *stats,
+                      double simTime,
+                      int queuedInterupts,
+                      int pendingInterupts )
+{
+    __atomic_store_n( &stats->simTimeUSec, (long long) ( simTime * 1000000 ),
+                      __ATOMIC_RELAXED );
+    __atomic_store_n( &stats->queuedInterupts, queuedInterupts,
+                      __ATOMIC_RELAXED );
+    __atomic_store_n( &stats->pendingInterupts, pendingInterupts,
+                      __ATOMIC_RELAXED );
+}
+//
+// setLiveMemory Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function stores the memory of the MMU
+ *
+ * @param[in,out] stats a pointer to a LiveStats struct
+ *
+ * @param[in] memoryTotal the memory the MMU manages
+ *
+ * @param[in] memoryAvailable the memory not allocated
+ *
+ * @return nothing to return (void)
+ */
+void setLiveMemory( LiveStats *stats, int memoryTotal, int memoryAvailable )
+{
+    __atomic_store_n( &stats->memoryTotal, memoryTotal, __ATOMIC_RELAXED );
+    __atomic_store_n( &stats->memoryAvailable, memoryAvailable,
+                      __ATOMIC_RELAXED );
+}
@@ -0,0 +1,111 @@
+// LiveStats Header Information ////////////////////////////////////////
+/**
+* @file liveStats.h
+*
+* @brief Header file for liveStats
+*
+* @details Specifies constants, simple data structures, included libraries,
+*          and function declarations used in serving the progress of a run
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of liveStats
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides a Unix domain socket that tells whoever connects how far
+  a run has got. The processing thread only stores a few values as it goes,
+  and a server thread of its own answers each connection from those values,
+  so polling a run never waits on the processing thread or its mutexes
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef LIVE_STATS_H
+#define LIVE_STATS_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "counters.h"
+#include "histogram.h"
+#include "stringUtils.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+
+// One count for each STATE in processor.h, in the same order
+#define LIVE_STATE_COUNT 5
+
+// Most msec the server waits for a request line before answering in text,
+// and between checks that the run has not ended
+#define LIVE_POLL_MSEC 100
+
+// Longest request line read, "json" or "text"
+#define LIVE_REQUEST_SIZE 16
+
+// Longest answer, a few hundred bytes are used
+#define LIVE_ANSWER_SIZE 1024
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+typedef struct LiveStats
+{
+  // Written by the processing thread only
+  long long simTimeUSec;
+  int stateCounts[ LIVE_STATE_COUNT ];
+  int queuedInterupts;
+  int pendingInterupts;
+  int memoryTotal;
+  int memoryAvailable;
+  // Log lines of the run are its events
+  CounterSet *counters;
+
+  // Used by the server thread only, socketPath is NULL when not serving
+  char *socketPath;
+  int socketFd;
+  pthread_t serverThread;
+  int serving;
+  long long lastEvents;
+  long long lastHostNanoSec;
+} LiveStats;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+void initLiveStats( LiveStats *stats, CounterSet *counters );
+
+Boolean startStatsServer( LiveStats *stats, char *socketPath );
+
+void stopStatsServer( LiveStats *stats );
+
+void *serveStats( void *stats );
+
+void answerStatsRequest( LiveStats *stats, int clientFd );
+
+int writeLiveStats( LiveStats *stats, char *answer, Boolean json );
+
+void setLiveState( LiveStats *stats, int oldState, int newState, int count );
+
+void setLiveProgress( LiveStats *stats,
+                      double simTime,
+                      int queuedInterupts,
+                      int pendingInterupts );
+
+void setLiveMemory( LiveStats *stats, int memoryTotal, int memoryAvailable );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // LIVE_STATS_H
+//
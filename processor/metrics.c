@@ -0,0 +1,574 @@
+// Metrics Implementation File Information ///////////////////////////////
+/**
+* @file metrics.c
+*
+* @brief Implementation for metrics
+*
+* @details Implements all functions for collecting and summing up the
+*          scheduling metrics of a run
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of metrics
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* Added latency histograms
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* Added the run time and the CPU time owed by share of each process
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* Added the deadline of each process
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* Added the CPU burst prediction totals
+*
+* @version 1.50
+* C.S student (18 October 2026)
+* Added the longest wait of each process
+*
+* @version 1.60
+* C.S student (18 October 2026)
+* Added the time spent switching processes
+*
+* @note Requires metrics.h
+*/
+
+#include "metrics.h"
+
+//
+// initProcessMetrics Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function initializes the metrics of a new process
+ *
+ * @details This function clears the times of a process. Its current state
+ *          is taken to start at its arrival time.
+ *
+ * @pre metrics a pointer to a ProcessMetrics struct
+ *
+ * @post metrics holds no time spent in any state at post
+ *
+ * @param[out] metrics a pointer to a ProcessMetrics struct
+ *
+ * @param[in] processNum the number of the process
+ *
+ * @param[in] arrivalTime the arrival time of the process in msec
+ *
+ * @return nothing to return (void)
+ */
+void initProcessMetrics( ProcessMetrics *metrics,
+                         int processNum,
+                         double arrivalTime )
+{
+    metrics->processNum = processNum;
+    metrics->arrivalTime = arrivalTime;
+    metrics->firstRunTime = -1;
+    metrics->completionTime = 0;
+    metrics->waitTime = 0;
+    metrics->maxWait = 0;
+    metrics->blockedTime = 0;
+    metrics->runTime = 0;
+    metrics->shareTime = 0;
+    metrics->deadline = -1;
+    metrics->stateTime = arrivalTime;
+}
+//
+// initRunMetrics Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function initializes the metrics of a run
+ *
+ * @pre runMetrics a pointer to a RunMetrics struct
+ *
+ * @post runMetrics holds no processes at post
+ *
+ * @param[out] runMetrics a pointer to a RunMetrics struct
+ *
+ * @return nothing to return (void)
+ */
+void initRunMetrics( RunMetrics *runMetrics )
+{
+    runMetrics->processes = NULL;
+    runMetrics->processCount = 0;
+    runMetrics->processCapacity = 0;
+    runMetrics->busyTime = 0;
+    runMetrics->contextSwitches = 0;
+    runMetrics->switchTime = 0;
+    runMetrics->lastProcessNum = -1;
+    runMetrics->burstCount = 0;
+    runMetrics->burstTime = 0;
+    runMetrics->predictedTime = 0;
+    runMetrics->burstError = 0;
+
+    clearHistogram( &runMetrics->dispatchLatency );
+    clearHistogram( &runMetrics->ioHandleLatency );
+    clearHistogram( &runMetrics->quantumUsed );
+    clearHistogram( &runMetrics->mmuLatency );
+}
+//
+// freeRunMetrics Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function frees the process metrics and histograms of a run
+ *
+ * @pre runMetrics a pointer to a RunMetrics struct
+ *
+ * @post runMetrics holds no processes at post
+ *
+ * @param[in,out] runMetrics a pointer to a RunMetrics struct
+ *
+ * @return nothing to return (void)
+ */
+void freeRunMetrics( RunMetrics *runMetrics )
+{
+    free( runMetrics->processes );
+
+    freeHistogram( &runMetrics->dispatchLatency );
+    freeHistogram( &runMetrics->ioHandleLatency );
+    freeHistogram( &runMetrics->quantumUsed );
+    freeHistogram( &runMetrics->mmuLatency );
+
+    initRunMetrics( runMetrics );
+}
+//
+// recordProcessMetrics Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function keeps the metrics of an exited process
+ *
+ * @details This function copies the metrics of a process into the run, so
+ *          they outlive the PCB when a streamed workload frees it.
+ *
+ * @pre runMetrics a pointer to a RunMetrics struct
+ *
+ * @pre metrics a pointer to the ProcessMetrics of an exited process
+ *
+ * @post metrics remains unchanged at post
+ *
+ * @param[in,out] runMetrics a pointer to a RunMetrics struct
+ *
+ * @param[in] metrics a pointer to a ProcessMetrics struct
+ *
+ * @return nothing to return (void)
+ */
+void recordProcessMetrics( RunMetrics *runMetrics, ProcessMetrics *metrics )
+{
+    ProcessMetrics *processes;
+
+    if( runMetrics->processCount == runMetrics->processCapacity )
+    {
+        processes = realloc( runMetrics->processes,
+                             sizeof( ProcessMetrics )
+                             * ( runMetrics->processCapacity * 2
+                               + METRICS_GROW_SIZE ) );
+
+        if( processes == NULL )
+        {
+            return;
+        }
+
+        runMetrics->processes = processes;
+        runMetrics->processCapacity = runMetrics->processCapacity * 2
+                                    + METRICS_GROW_SIZE;
+    }
+
+    runMetrics->processes[ runMetrics->processCount ] = *metrics;
+    runMetrics->processCount++;
+}
+//
+// getProcessMetric Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function gets one time of an exited process
+ *
+ * @details This function works out the turnaround (arrival to completion),
+ *          waiting (time spent ready) or response (arrival to first run)
+ *          time of a process.
+ *
+ * @pre metrics a pointer to the ProcessMetrics of an exited process
+ *
+ * @post metrics remains unchanged at post
+ *
+ * @param[in] metrics a pointer to a ProcessMetrics struct
+ *
+ * @param[in] type the time to get
+ *
+ * @return the time in msec (double)
+ */
+double getProcessMetric( ProcessMetrics *metrics, METRIC_TYPES type )
+{
+    switch( type )
+    {
+      case TURNAROUND_METRIC:
+        return metrics->completionTime - metrics->arrivalTime;
+
+      case WAITING_METRIC:
+        return metrics->waitTime;
+
+      case RESPONSE_METRIC:
+        // A process can fail before it is ever run
+        if( metrics->firstRunTime < 0 )
+        {
+            return metrics->completionTime - metrics->arrivalTime;
+        }
+
+        return metrics->firstRunTime - metrics->arrivalTime;
+    }
+
+    return 0;
+}
+//
+// getMetricStats Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function sums up one time over every exited process
+ *
+ * @details This function finds the mean and the 50th, 95th and 99th
+ *          percentiles of one time of every process recorded in the run.
+ *
+ * @par Algorithm
+ *      The times are copied out and sorted, then getPercentile takes the
+ *      nearest rank of each percentile.
+ *
+ * @pre runMetrics a pointer to a RunMetrics struct
+ *
+ * @post runMetrics remains unchanged at post
+ *
+ * @param[in] runMetrics a pointer to a RunMetrics struct
+ *
+ * @param[in] type the time to sum up
+ *
+ * @param[out] stats a pointer to a MetricStats struct, all zero if no
+ *             process was recorded
+ *
+ * @return nothing to return (void)
+ */
+void getMetricStats( RunMetrics *runMetrics,
+                     METRIC_TYPES type,
+                     MetricStats *stats )
+{
+    int index, count = runMetrics->processCount;
+    double total = 0;
+    double *values;
+
+    stats->mean = 0;
+    stats->p50 = 0;
+    stats->p95 = 0;
+    stats->p99 = 0;
+
+    if( count == 0 )
+    {
+        return;
+    }
+
+    values = malloc( sizeof( double ) * count );
+
+    if( values == NULL )
+    {
+        return;
+    }
+
+    for( index = 0; index < count; index++ )
+    {
+        values[ index ] = getProcessMetric( &runMetrics->processes[ index ],
+                                            type );
+        total += values[ index ];
+    }
+
+    qsort( values, count, sizeof( double ), compareDoubles );
+
+    stats->mean = total / count;
+    stats->p50 = getPercentile( values, count, 50 );
+    stats->p95 = getPercentile( values, count, 95 );
+    stats->p99 = getPercentile( values, count, 99 );
+
+    free( values );
+}
+//
+// getPercentile Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function gets a percentile of sorted values
+ *
+ * @details This function uses the nearest rank method, so the result is
+ *          always one of the values.
+ *
+ * @pre sortedValues a pointer to count values in increasing order
+ *
+ * @post sortedValues remains unchanged at post
+ *
+ * @param[in] sortedValues a pointer to the values
+ *
+ * @param[in] count the number of values, at least one
+ *
+ * @param[in] percentile the percentile to get, from 0 to 100
+ *
+ * @return the value at the percentile (double)
+ */
+double getPercentile( double *sortedValues, int count, double percentile )
+{
+    int rank = (int) ( percentile / 100 * count + 0.999999 );
+
+    if( rank < 1 )
+    {
+        rank = 1;
+    }
+    else if( rank > count )
+    {
+        rank = count;
+    }
+
+    return sortedValues[ rank - 1 ];
+}
+//
+// compareDoubles Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function compares two doubles for qsort
+ *
+ * @param[in] first a pointer to a double
+ *
+ * @param[in] second a pointer to a double
+ *
+ * @return less than, equal to or greater than zero as first is less than,
+ *         equal to or greater than second (int)
+ */
+int compareDoubles( const void *first, const void *second )
+{
+    double firstValue = *(const double *) first;
+    double secondValue = *(const double *) second;
+
+    return ( firstValue > secondValue ) - ( firstValue < secondValue );
+}
+//
+// writeMetricsFile Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function writes the metrics of a run to a file
+ *
+ * @details This function writes the summed up metrics of a run as one
+ *          "name=value" line each, so scripts comparing runs do not need to
+ *          read the log.
+ *
+ * @pre runMetrics a pointer to the RunMetrics of a finished run
+ *
+ * @post runMetrics remains unchanged at post
+ *
+ * @exception badFile
+ *            If the file cannot be opened, return False.
+ *
+ * @param[in] runMetrics a pointer to a RunMetrics struct
+ *
+ * @param[in] filename a pointer to the path of the file
+ *
+ * @param[in] policy a pointer to the scheduling code of the run
+ *
+ * @param[in] totalTime the simulated time of the run in msec
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean writeMetricsFile( RunMetrics *runMetrics,
+                          char *filename,
+                          char *policy,
+                          double totalTime )
+{
+    const char *metricNames[] = { "turnaround", "waiting", "response" };
+    MetricStats stats;
+    int type;
+    double utilization = 0, throughput = 0;
+    FILE *filePointer = fopen( filename, "w" );
+
+    if( filePointer == NULL )
+    {
+        return False;
+    }
+
+    if( totalTime > 0 )
+    {
+        utilization = runMetrics->busyTime / totalTime;
+        throughput = runMetrics->processCount / ( totalTime / 1000 );
+    }
+
+    fprintf( filePointer, "policy=%s\n", policy );
+    fprintf( filePointer, "total_time_ms=%.3lf\n", totalTime );
+    fprintf( filePointer, "processes=%d\n", runMetrics->processCount );
+
+    for( type = TURNAROUND_METRIC; type <= RESPONSE_METRIC; type++ )
+    {
+        getMetricStats( runMetrics, type, &stats );
+
+        fprintf( filePointer, "%s_mean_ms=%.3lf\n", metricNames[ type ],
+                 stats.mean );
+        fprintf( filePointer, "%s_p50_ms=%.3lf\n", metricNames[ type ],
+                 stats.p50 );
+        fprintf( filePointer, "%s_p95_ms=%.3lf\n", metricNames[ type ],
+                 stats.p95 );
+        fprintf( filePointer, "%s_p99_ms=%.3lf\n", metricNames[ type ],
+                 stats.p99 );
+    }
+
+    fprintf( filePointer, "cpu_utilization=%.4lf\n", utilization );
+    fprintf( filePointer, "context_switches=%d\n",
+             runMetrics->contextSwitches );
+    fprintf( filePointer, "switch_overhead_ms=%.3lf\n",
+             runMetrics->switchTime );
+    fprintf( filePointer, "throughput_per_sec=%.4lf\n", throughput );
+
+    fclose( filePointer );
+
+    return True;
+}
+//
+// startLatencyHistograms Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function starts recording the latency histograms of a run
+ *
+ * @details This function allocates the dispatch, I/O handling, quantum and
+ *          MMU histograms. Until it is called, values recorded to them are
+ *          dropped, so runs that do not write histograms pay nothing for
+ *          them.
+ *
+ * @pre runMetrics a pointer to a RunMetrics struct
+ *
+ * @post runMetrics records latencies at post
+ *
+ * @exception noMemory
+ *            If any histogram cannot be allocated, none are kept and False
+ *            is returned.
+ *
+ * @param[in,out] runMetrics a pointer to a RunMetrics struct
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean startLatencyHistograms( RunMetrics *runMetrics )
+{
+    if( initHistogram( &runMetrics->dispatchLatency,
+                       LATENCY_HISTOGRAM_HIGHEST,
+                       LATENCY_HISTOGRAM_DIGITS ) == False
+     || initHistogram( &runMetrics->ioHandleLatency,
+                       LATENCY_HISTOGRAM_HIGHEST,
+                       LATENCY_HISTOGRAM_DIGITS ) == False
+     || initHistogram( &runMetrics->quantumUsed,
+                       LATENCY_HISTOGRAM_HIGHEST,
+                       LATENCY_HISTOGRAM_DIGITS ) == False
+     || initHistogram( &runMetrics->mmuLatency,
+                       LATENCY_HISTOGRAM_HIGHEST,
+                       LATENCY_HISTOGRAM_DIGITS ) == False )
+    {
+        freeHistogram( &runMetrics->dispatchLatency );
+        freeHistogram( &runMetrics->ioHandleLatency );
+        freeHistogram( &runMetrics->quantumUsed );
+        freeHistogram( &runMetrics->mmuLatency );
+        return False;
+    }
+
+    return True;
+}
+//
+// writeLatencyHistograms Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function writes the latency histograms of a run
+ *
+ * @details This function writes each histogram to its own file named
+ *          after the prefix, as the percentile distribution format holds
+ *          one histogram per file:
+ *          <prefix>_dispatch.hgrm, <prefix>_io.hgrm, <prefix>_quantum.hgrm
+ *          and <prefix>_mmu.hgrm.
+ *
+ * @pre runMetrics a pointer to the RunMetrics of a finished run
+ *
+ * @post runMetrics remains unchanged at post
+ *
+ * @exception badFile
+ *            If any file cannot be written, return False.
+ *
+ * @param[in] runMetrics a pointer to a RunMetrics struct
+ *
+ * @param[in] filePrefix a pointer to the start of each file path
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean writeLatencyHistograms( RunMetrics *runMetrics, char *filePrefix )
+{
+    Boolean isValid = True;
+
+    if( writeHistogramFile( &runMetrics->dispatchLatency,
+                            filePrefix, "dispatch" ) == False )
+    {
+        isValid = False;
+    }
+
+    if( writeHistogramFile( &runMetrics->ioHandleLatency,
+                            filePrefix, "io" ) == False )
+    {
+        isValid = False;
+    }
+
+    if( writeHistogramFile( &runMetrics->quantumUsed,
+                            filePrefix, "quantum" ) == False )
+    {
+        isValid = False;
+    }
+
+    if( writeHistogramFile( &runMetrics->mmuLatency,
+                            filePrefix, "mmu" ) == False )
+    {
+        isValid = False;
+    }
+
+    return isValid;
+}
+//
+// writeHistogramFile Function Implementation ///////////////////////////////////
+//
+/**
+ * @brief This function writes one histogram to <prefix>_<name>.hgrm
+ *
+ * @pre histogram a pointer to a Histogram struct
+ *
+ * @post histogram remains unchanged at post
+ *
+ * @exception badFile
+ *            If the file cannot be opened, return False.
+ *
+ * @param[in] histogram a pointer to a Histogram struct
+ *
+ * @param[in] filePrefix a pointer to the start of the file path
+ *
+ * @param[in] name a pointer to the name of the histogram
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean writeHistogramFile( Histogram *histogram,
+                            char *filePrefix,
+                            char *name )
+{
+    FILE *filePointer;
+    char *filename = malloc( strlen( filePrefix ) + strlen( name ) + 7 );
+
+    if( filename == NULL )
+    {
+        return False;
+    }
+
+    sprintf( filename, "%s_%s.hgrm", filePrefix, name );
+    filePointer = fopen( filename, "w" );
+    free( filename );
+
+    if( filePointer == NULL )
+    {
+        return False;
+    }
+
+    writePercentileDistribution( histogram, filePointer, LATENCY_UNIT_SCALE );
+    fclose( filePointer );
+
+    return True;
+}
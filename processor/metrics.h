@@ -0,0 +1,183 @@
+// Metrics Header Information ////////////////////////////////////////
+/**
+* @file metrics.h
+*
+* @brief Header file for metrics
+*
+* @details Specifies constants, simple data structures, included libraries,
+* and function declarations used in collecting scheduling metrics
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of metrics
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* Added latency histograms
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* Added the run time and the CPU time owed by share of each process
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* Added the deadline of each process
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* Added the CPU burst prediction totals
+*
+* @version 1.50
+* C.S student (18 October 2026)
+* Added the longest wait of each process
+*
+* @version 1.60
+* C.S student (18 October 2026)
+* Added the time spent switching processes
+*
+* @note None
+*/
+
+// Metrics Description/Support /////////////////////////////////////
+/*
+  This file provides the operations for keeping the turnaround, waiting and
+  response times of every process of a run, and for summing them up once
+  the run is over. Latencies whose tails matter are also kept in histograms
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef METRICS_H
+#define METRICS_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "basicStructs.h"
+#include "histogram.h"
+
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+
+// Per process times that can be summed up by getMetricStats
+typedef enum
+{
+  TURNAROUND_METRIC = 0,
+  WAITING_METRIC,
+  RESPONSE_METRIC
+} METRIC_TYPES;
+
+// Room for this many exited processes is made at a time
+#define METRICS_GROW_SIZE 64
+
+// Latency histograms keep 3 significant digits of values up to an hour of
+// simulated time in usec, or a second of host time in nsec
+#define LATENCY_HISTOGRAM_DIGITS 3
+#define LATENCY_HISTOGRAM_HIGHEST 3600000000LL
+
+// Histograms of simulated time are kept in usec and written in msec, MMU
+// histograms are kept in nsec of host time and written in usec
+#define LATENCY_UNIT_SCALE 1000.0
+
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+
+// Times of one process, all in simulated msec
+typedef struct ProcessMetrics
+{
+  int processNum;
+  double arrivalTime;
+  // -1 until the process is first set in the Running state
+  double firstRunTime;
+  double completionTime;
+  // Time spent in the Ready state, including any wait to be admitted
+  double waitTime;
+  // Longest single stretch of waiting
+  double maxWait;
+  double blockedTime;
+  double runTime;
+  // CPU time owed by the tickets of the process under LOTTERY-P or STRIDE-P
+  double shareTime;
+  // Absolute deadline, -1 if the process has none
+  double deadline;
+  // Time of the last state change, the start of the current state
+  double stateTime;
+} ProcessMetrics;
+
+// Metrics of every process that has exited during a run
+typedef struct RunMetrics
+{
+  ProcessMetrics *processes;
+  int processCount;
+  int processCapacity;
+  // Time some process was in the Running state
+  double busyTime;
+  int contextSwitches;
+  // Msec spent on dispatch overhead and cache refills instead of processes
+  double switchTime;
+  // Process last set in the Running state, -1 before the first dispatch
+  int lastProcessNum;
+  // CPU bursts ended while bursts were predicted, the msec they ran and
+  // were predicted to run, and the msec the predictions were off by
+  int burstCount;
+  double burstTime;
+  double predictedTime;
+  double burstError;
+  // Only recorded when started by startLatencyHistograms
+  Histogram dispatchLatency;
+  Histogram ioHandleLatency;
+  Histogram quantumUsed;
+  Histogram mmuLatency;
+} RunMetrics;
+
+typedef struct MetricStats
+{
+  double mean;
+  double p50;
+  double p95;
+  double p99;
+} MetricStats;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+void initProcessMetrics( ProcessMetrics *metrics,
+                         int processNum,
+                         double arrivalTime );
+
+void initRunMetrics( RunMetrics *runMetrics );
+
+void freeRunMetrics( RunMetrics *runMetrics );
+
+void recordProcessMetrics( RunMetrics *runMetrics, ProcessMetrics *metrics );
+
+double getProcessMetric( ProcessMetrics *metrics, METRIC_TYPES type );
+
+void getMetricStats( RunMetrics *runMetrics,
+                     METRIC_TYPES type,
+                     MetricStats *stats );
+
+double getPercentile( double *sortedValues, int count, double percentile );
+
+int compareDoubles( const void *first, const void *second );
+
+Boolean writeMetricsFile( RunMetrics *runMetrics,
+                          char *filename,
+                          char *policy,
+                          double totalTime );
+
+Boolean startLatencyHistograms( RunMetrics *runMetrics );
+
+Boolean writeLatencyHistograms( RunMetrics *runMetrics, char *filePrefix );
+
+Boolean writeHistogramFile( Histogram *histogram,
+                            char *filePrefix,
+                            char *name );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // METRICS_H
+//
@@ -0,0 +1,299 @@
+// Mlfq Implementation File Information ///////////////////////////////
+/**
+* @file mlfq.c
+*
+* @brief Implementation for mlfq
+*
+* @details Implements all functions for the MLFQ-P ready queues
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of mlfq
+*
+* @note Requires mlfq.h
+*/
+
+#include "mlfq.h"
+
+//
+// createMlfq Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function creates empty MLFQ-P ready queues
+ *
+ * @details This function gives each level the quantum from the config. With
+ *          no MLFQ Quantums line there are MLFQ_DEFAULT_LEVELS levels, the
+ *          top one with the Quantum Time and each one below with double the
+ *          one above. Boosts default to every MLFQ_BOOST_QUANTA bottom level
+ *          quanta.
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @post cfData remains unchanged at post
+ *
+ * @param[in] cfData a pointer to a ConfigData struct
+ *
+ * @return a pointer to the new queues (Mlfq *)
+ */
+Mlfq *createMlfq( ConfigData *cfData )
+{
+    int level;
+    Mlfq *mlfq = malloc( sizeof( *mlfq ) );
+
+    mlfq->levelCount = cfData->mlfqLevels;
+
+    if( mlfq->levelCount == 0 )
+    {
+        mlfq->levelCount = MLFQ_DEFAULT_LEVELS;
+    }
+
+    for( level = 0; level < mlfq->levelCount; level++ )
+    {
+        mlfq->levels[ level ].headProcess = NULL;
+        mlfq->levels[ level ].tailProcess = NULL;
+
+        if( cfData->mlfqLevels == 0 )
+        {
+            mlfq->levels[ level ].quantum = cfData->quantumTime << level;
+        }
+        else
+        {
+            mlfq->levels[ level ].quantum = cfData->mlfqQuantums[ level ];
+        }
+    }
+
+    mlfq->readyCount = 0;
+    mlfq->boostEpoch = 0;
+    mlfq->boostTime = cfData->mlfqBoostTime;
+
+    if( mlfq->boostTime < 0 )
+    {
+        mlfq->boostTime = MLFQ_BOOST_QUANTA * cfData->processorCycleTime
+                        * mlfq->levels[ mlfq->levelCount - 1 ].quantum;
+    }
+
+    mlfq->nextBoost = mlfq->boostTime;
+
+    return mlfq;
+}
+//
+// getMlfqLevel Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the level of a process
+ *
+ * @details This function puts a process back at the top level if a boost
+ *          has happened since its level was last set.
+ *
+ * @param[in] mlfq a pointer to an Mlfq struct
+ *
+ * @param[in,out] process a pointer to a PCB struct
+ *
+ * @return the level, 0 for the top (int)
+ */
+int getMlfqLevel( Mlfq *mlfq, PCB *process )
+{
+    if( process->mlfqEpoch != mlfq->boostEpoch )
+    {
+        process->mlfqLevel = 0;
+        process->mlfqEpoch = mlfq->boostEpoch;
+    }
+
+    return process->mlfqLevel;
+}
+//
+// getMlfqQuantum Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the quantum of a process in cycles
+ *
+ * @param[in] mlfq a pointer to an Mlfq struct
+ *
+ * @param[in,out] process a pointer to a PCB struct
+ *
+ * @return the quantum of the level of the process (int)
+ */
+int getMlfqQuantum( Mlfq *mlfq, PCB *process )
+{
+    return mlfq->levels[ getMlfqLevel( mlfq, process ) ].quantum;
+}
+//
+// queueMlfqProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds a ready process to the back of its level
+ *
+ * @pre process a pointer to a PCB that is not queued
+ *
+ * @post process is the last of its level at post
+ *
+ * @param[in,out] mlfq a pointer to an Mlfq struct
+ *
+ * @param[in,out] process a pointer to a PCB struct
+ *
+ * @return nothing to return (void)
+ */
+void queueMlfqProcess( Mlfq *mlfq, PCB *process )
+{
+    MlfqLevel *level = &mlfq->levels[ getMlfqLevel( mlfq, process ) ];
+
+    process->nextQueued = NULL;
+
+    if( level->tailProcess == NULL )
+    {
+        level->headProcess = process;
+    }
+    else
+    {
+        level->tailProcess->nextQueued = process;
+    }
+
+    level->tailProcess = process;
+    mlfq->readyCount++;
+}
+//
+// takeMlfqProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function takes the first process of the highest level
+ *
+ * @param[in,out] mlfq a pointer to an Mlfq struct
+ *
+ * @return the process, or NULL if no process is ready (PCB *)
+ */
+PCB *takeMlfqProcess( Mlfq *mlfq )
+{
+    int level;
+    PCB *process;
+
+    for( level = 0; level < mlfq->levelCount; level++ )
+    {
+        process = mlfq->levels[ level ].headProcess;
+
+        if( process != NULL )
+        {
+            mlfq->levels[ level ].headProcess = process->nextQueued;
+
+            if( process->nextQueued == NULL )
+            {
+                mlfq->levels[ level ].tailProcess = NULL;
+            }
+
+            process->nextQueued = NULL;
+            mlfq->readyCount--;
+
+            return process;
+        }
+    }
+
+    return NULL;
+}
+//
+// demoteMlfqProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function moves a process that used its quantum down a level
+ *
+ * @pre process a pointer to a PCB that is not queued
+ *
+ * @param[in] mlfq a pointer to an Mlfq struct
+ *
+ * @param[in,out] process a pointer to a PCB struct
+ *
+ * @return nothing to return (void)
+ */
+void demoteMlfqProcess( Mlfq *mlfq, PCB *process )
+{
+    if( getMlfqLevel( mlfq, process ) < mlfq->levelCount - 1 )
+    {
+        process->mlfqLevel++;
+    }
+}
+//
+// promoteMlfqProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function moves a process whose I/O ended up a level
+ *
+ * @pre process a pointer to a PCB that is not queued
+ *
+ * @param[in] mlfq a pointer to an Mlfq struct
+ *
+ * @param[in,out] process a pointer to a PCB struct
+ *
+ * @return nothing to return (void)
+ */
+void promoteMlfqProcess( Mlfq *mlfq, PCB *process )
+{
+    if( getMlfqLevel( mlfq, process ) > 0 )
+    {
+        process->mlfqLevel--;
+    }
+}
+//
+// boostMlfq Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function moves every process to the top level when a boost
+ *        is due
+ *
+ * @details This function appends each level to the top level in order, so
+ *          processes keep their order within the old levels, and starts a
+ *          new epoch, which puts blocked and running processes at the top
+ *          level the next time their level is read.
+ *
+ * @param[in,out] mlfq a pointer to an Mlfq struct
+ *
+ * @param[in] time the simulated time in msec
+ *
+ * @return True if a boost happened, False otherwise (Boolean)
+ */
+Boolean boostMlfq( Mlfq *mlfq, double time )
+{
+    int level;
+    MlfqLevel *topLevel = &mlfq->levels[ 0 ];
+
+    if( mlfq->boostTime == 0 || time < mlfq->nextBoost )
+    {
+        return False;
+    }
+
+    for( level = 1; level < mlfq->levelCount; level++ )
+    {
+        if( mlfq->levels[ level ].headProcess == NULL )
+        {
+            continue;
+        }
+
+        if( topLevel->tailProcess == NULL )
+        {
+            topLevel->headProcess = mlfq->levels[ level ].headProcess;
+        }
+        else
+        {
+            topLevel->tailProcess->nextQueued
+                                        = mlfq->levels[ level ].headProcess;
+        }
+
+        topLevel->tailProcess = mlfq->levels[ level ].tailProcess;
+        mlfq->levels[ level ].headProcess = NULL;
+        mlfq->levels[ level ].tailProcess = NULL;
+    }
+
+    mlfq->boostEpoch++;
+
+    while( mlfq->nextBoost <= time )
+    {
+        mlfq->nextBoost += mlfq->boostTime;
+    }
+
+    return True;
+}
@@ -0,0 +1,87 @@
+// Mlfq Header Information ////////////////////////////////////////
+/**
+* @file mlfq.h
+*
+* @brief Header file for mlfq
+*
+* @details Specifies constants, simple data structures, included libraries,
+*          and function declarations used in the MLFQ-P ready queues
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of mlfq
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides the ready queues of the multi-level feedback queue
+  scheduler. Each level is a FIFO of PCBs linked through the PCBs
+  themselves, so adding, taking, demoting and promoting are O(1). A boost
+  moves every process to the top level in O(levels) by splicing the queues
+  together and starting a new boost epoch, instead of visiting each PCB
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef MLFQ_H
+#define MLFQ_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include "processor.h"
+#include "configParser.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+
+// Boosts come this many bottom level quanta apart unless set
+#define MLFQ_BOOST_QUANTA 10
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+typedef struct MlfqLevel
+{
+  struct PCB *headProcess;
+  struct PCB *tailProcess;
+  // Cycles a process at this level runs before it is moved down
+  int quantum;
+} MlfqLevel;
+
+typedef struct Mlfq
+{
+  MlfqLevel levels[ MLFQ_MAX_LEVELS ];
+  int levelCount;
+  int readyCount;
+  // Levels of PCBs from an earlier epoch were undone by a boost
+  int boostEpoch;
+  // Msec between boosts, 0 for never, and the time of the next one
+  int boostTime;
+  double nextBoost;
+} Mlfq;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+Mlfq *createMlfq( ConfigData *cfData );
+
+int getMlfqLevel( Mlfq *mlfq, struct PCB *process );
+
+int getMlfqQuantum( Mlfq *mlfq, struct PCB *process );
+
+void queueMlfqProcess( Mlfq *mlfq, struct PCB *process );
+
+struct PCB *takeMlfqProcess( Mlfq *mlfq );
+
+void demoteMlfqProcess( Mlfq *mlfq, struct PCB *process );
+
+void promoteMlfqProcess( Mlfq *mlfq, struct PCB *process );
+
+Boolean boostMlfq( Mlfq *mlfq, double time );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // MLFQ_H
+//
@@ -20,11 +20,266 @@
 * Added interupt system and made necessary changes/inclusions for preemptive
 * stuffs
 *
+* @version 1.30
+* C.S student (18 October 2026)
+* Added process arrival times and streaming workload ingestion
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* Added the virtual clock and RunSummary for parameter sweeps
+*
+* @version 1.50
+* C.S student (18 October 2026)
+* Moved all run state into SimContext so simulations can run side by side
+* in one process
+*
+* @version 1.60
+* C.S student (18 October 2026)
+* Added the log sink used by libossim
+*
+* @version 1.70
+* C.S student (18 October 2026)
+* Added per process scheduling metrics
+*
+* @version 1.80
+* C.S student (18 October 2026)
+* Added latency histograms
+*
+* @version 1.90
+* C.S student (18 October 2026)
+* Added the Trace log target
+*
+* @version 2.00
+* C.S student (18 October 2026)
+* Added runtime counters
+*
+* @version 2.10
+* C.S student (18 October 2026)
+* Added the live stats socket
+*
+* @version 2.20
+* C.S student (18 October 2026)
+* Op, state and interupt log lines go through the tracing macros
+*
+* @version 2.30
+* C.S student (18 October 2026)
+* Added the MLFQ-P scheduler
+*
+* @version 2.40
+* C.S student (18 October 2026)
+* Added the CFS-P scheduler
+*
+* @version 2.50
+* C.S student (18 October 2026)
+* Added the LOTTERY-P and STRIDE-P schedulers and their CPU share table
+*
+* @version 2.60
+* C.S student (18 October 2026)
+* Added the EDF-P and RM-P schedulers, periodic releases and the deadline
+* table
+*
+* @version 2.70
+* C.S student (18 October 2026)
+* SJF-N and SRTF-P can pick by exponentially averaged CPU burst predictions
+* instead of the known process times
+*
+* @version 2.80
+* C.S student (18 October 2026)
+* RR-P quanta last across ops instead of ending with each op, and can adapt
+* to the CPU bursts of each process
+*
+* @version 2.90
+* C.S student (18 October 2026)
+* SJF-N and SRTF-P pick from a ready queue that ages waiting processes
+* instead of walking the PCB list
+*
+* @version 3.00
+* C.S student (18 October 2026)
+* Dispatches can cost context switch and cache refill time
+*
+* @version 3.10
+* C.S student (18 October 2026)
+* I/O ops wait for a channel of their device when devices have channel
+* counts, and the device queues are summarized at the end of the run
+*
+* @version 3.20
+* C.S student (18 October 2026)
+* The schedulers with ready structures of their own run through
+* dispatchReadyQueue, which takes their pick, queue and charge hooks
+*
+* @version 3.30
+* C.S student (18 October 2026)
+* The MLFQ-P quantum lasts across ops, so a process with short ops is still
+* moved down a level once it has used its quantum
+*
+* @version 3.40
+* C.S student (18 October 2026)
+* The CFS-P slice is kept as the quantum of the process, so it also runs
+* out at the end of an op
+*
+* @version 3.50
+* C.S student (18 October 2026)
+* The LOTTERY-P and STRIDE-P quantum lasts across ops, so a process with
+* short ops no longer holds the CPU until it blocks
+*
+* @version 3.60
+* C.S student (18 October 2026)
+* The EDF-P and RM-P quantum lasts across ops, so released jobs are admitted
+* and preempt within a quantum
+*
+* @version 3.70
+* C.S student (18 October 2026)
+* The interupt queues start at INTERUPT_QUEUE_SIZE and grow as needed
+*
+* @version 3.80
+* C.S student (18 October 2026)
+* Context switch time no longer counts as waiting, response or dispatch
+* latency time
+*
+* @version 3.90
+* C.S student (18 October 2026)
+* createSimContext returns NULL if the counters cannot be set up, and
+* controller threads are detached
+*
 * @note Requires processor.h
 */
 
 #include "processor.h"
 
+// Names of the states in the order of STATE, as logged by setState
+static const char *stateNames[] =
+{
+    "New", "Ready", "Blocked", "Exit", "Running"
+};
+
+// Hooks of the schedulers run by dispatchReadyQueue
+static const ReadyQueueOps mlfqReadyOps =
+{
+    queueMlfqReady, countMlfqReady, takeMlfqReady, selectMlfqReady, NULL,
+    demoteMlfqReady
+};
+
+static const ReadyQueueOps cfsReadyOps =
+{
+    queueCfsReady, countCfsReady, takeCfsReady, selectCfsReady,
+    chargeCfsReady, NULL
+};
+
+static const ReadyQueueOps shareReadyOps =
+{
+    queueShareReady, countShareReady, takeShareReady, selectShareReady,
+    chargeShareReady, NULL
+};
+
+static const ReadyQueueOps deadlineReadyOps =
+{
+    queueDeadlineReady, countDeadlineReady, takeDeadlineReady,
+    selectDeadlineReady, NULL, NULL
+};
+
+//
+// createSimContext Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function creates a SimContext struct
+ *
+ * @details This function allocates the state for one run of the simulator
+ *          and initializes its queues and mutexes. The workload and run
+ *          totals are reset by each call to beginProcessing.
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @post cfData remains unchanged at post
+ *
+ * @exception noCounters
+ *            If the counters cannot be set up, return NULL.
+ *
+ * @param[in] cfData a pointer to the ConfigData struct the run uses
+ *
+ * @return the pointer to a newly created SimContext struct (SimContext *)
+ */
+SimContext *createSimContext( ConfigData *cfData )
+{
+    SimContext *context = malloc( sizeof( *context ) );
+
+    if( initCounters( &context->counters ) == False )
+    {
+        free( context );
+        return NULL;
+    }
+
+    context->cfData = cfData;
+    context->logNode = NULL;
+    context->logSink = NULL;
+    context->logUserData = NULL;
+
+    initTimer( &context->timer );
+
+    context->interuptQueue = malloc( sizeof( Interupt ) * INTERUPT_QUEUE_SIZE );
+    context->interuptQueueIterator = -1;
+    context->interuptQueueCapacity = INTERUPT_QUEUE_SIZE;
+    context->pendingInterupts = malloc( sizeof( Interupt )
+                                        * INTERUPT_QUEUE_SIZE );
+    context->pendingInteruptCount = 0;
+    context->pendingInteruptCapacity = INTERUPT_QUEUE_SIZE;
+    context->nextInteruptOrder = 0;
+
+    initRunMetrics( &context->runMetrics );
+    initTrace( &context->trace );
+    initLiveStats( &context->liveStats, &context->counters );
+    context->mlfq = NULL;
+    context->cfs = NULL;
+    context->share = NULL;
+    context->deadlines = NULL;
+    context->readyOps = NULL;
+    context->aging = NULL;
+    context->devices = NULL;
+
+    pthread_mutex_init( &context->interuptMutex, NULL );
+    pthread_mutex_init( &context->controlMutex, NULL );
+    pthread_mutex_init( &context->stringMutex, NULL );
+
+    return context;
+}
+//
+// freeSimContext Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees a SimContext struct
+ *
+ * @details This function frees the queues and mutexes of a SimContext. The
+ *          ConfigData and the log it points to belong to the caller and are
+ *          left alone.
+ *
+ * @pre context a pointer to a SimContext struct, or NULL
+ *
+ * @post context is freed at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return Nothing to return (void)
+ */
+void freeSimContext( SimContext *context )
+{
+    if( context == NULL )
+    {
+        return;
+    }
+
+    pthread_mutex_destroy( &context->interuptMutex );
+    pthread_mutex_destroy( &context->controlMutex );
+    pthread_mutex_destroy( &context->stringMutex );
+    destroyTimer( &context->timer );
+    freeRunMetrics( &context->runMetrics );
+    closeTrace( &context->trace );
+    freeCounters( &context->counters );
+
+    free( context->interuptQueue );
+    free( context->pendingInterupts );
+    free( context );
+}
 //
 // beginProcessing Function Implementation ///////////////////////////////////
 //
@@ -37,96 +292,285 @@
  *          control blocks (PCB's) and then executes the operations in those
  *          PCB's using the data found in a ConfigData struct.
  *
- * @pre currentNode a pointer to the head of a MetaNode linked list
+ * @par Algorithm
+ *      When a MetaStream is given instead of a list, PCBs are only created
+ *      for each process block once simulated time reaches its arrival time,
+ *      and are freed again once they exit.
+ *
+ * @pre context a pointer to a SimContext made by createSimContext
+ *
+ * @pre currentNode a pointer to the head of a MetaNode linked list, or NULL
+ *                  if the workload is streamed
+ *
+ * @pre stream a pointer to an open MetaStream, or NULL
  *
- * @pre cfData a pointer to ConfigData struct
+ * @post currentNode and the context's ConfigData remain unchanged at post
  *
- * @post currentNode and cfData remain unchanged at post
+ * @post context holds the totals of the run at post
+ *
+ * @param[in,out] context a pointer to a SimContext struct
  *
  * @param[in] currentNode a pointer to a MetaNode struct
  *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @param[in] stream a pointer to a MetaStream struct
  *
  * @return the head of a StringNode linked list (StringNode *)
  */
-StringNode *beginProcessing( MetaNode *currentNode, ConfigData *cfData )
+StringNode *beginProcessing( SimContext *context,
+                             MetaNode *currentNode,
+                             MetaStream *stream )
 {
     double time;
     int pcbCode;
     char *timeString = malloc( sizeof( char ) * 200 );
+    PCB *currentProcess = NULL;
+
+    context->logNode = malloc( sizeof( *context->logNode ) );
+    context->logNode->nextNode = NULL;
+    context->logNode->string = NULL;
+
+    context->runSummary.totalTime = 0;
+    context->runSummary.processes = 0;
+    context->runSummary.dispatches = 0;
+    context->runSummary.ioBlocks = 0;
+    context->runSummary.segFaults = 0;
 
-    StringNode *startNode = malloc( sizeof( *startNode ) );
-    startNode->nextNode = NULL;
-    startNode->string = NULL;
+    freeRunMetrics( &context->runMetrics );
+    clearCounters( &context->counters );
+    initLiveStats( &context->liveStats, &context->counters );
 
-    time = accessTimer( ZERO_TIMER, timeString );
-    logLine( cfData, startNode, "Time:%10.6lf, System start\n", time );
+    if( context->cfData->histogramFilePrefix != NULL )
+    {
+        startLatencyHistograms( &context->runMetrics );
+    }
+
+    if( stringCmp( context->cfData->logTo, "Trace" ) == True
+     && openTrace( &context->trace, context->cfData->logFilePath ) == False )
+    {
+        printf( "Unable to write trace file: %s\n",
+                context->cfData->logFilePath );
+    }
+
+    setVirtualClock( &context->timer, context->cfData->virtualClock );
+    time = accessTimer( &context->timer, ZERO_TIMER, timeString );
+    logLine( context, "Time:%10.6lf, System start\n", time );
+
+    time  = accessTimer( &context->timer, LAP_TIMER, timeString );
+    logLine( context, "Time:%10.6lf, OS: Begin PCB Creation\n", time );
+
+    MMU *memoryManagementUnit = createMMU(context->cfData->memAvailable);
+    setLiveMemory( &context->liveStats, memoryManagementUnit->totalMemory,
+                   memoryManagementUnit->memAvailable );
 
-    time  = accessTimer( LAP_TIMER, timeString );
-    logLine( cfData, startNode, "Time:%10.6lf, OS: Begin PCB Creation\n", time );
+    if( context->cfData->statsSocketPath != NULL
+     && startStatsServer( &context->liveStats,
+                          context->cfData->statsSocketPath ) == False )
+    {
+        printf( "Unable to open stats socket: %s\n",
+                context->cfData->statsSocketPath );
+    }
 
-    PCB *currentProcess = createPCB();
+    context->workload.stream = stream;
+    context->workload.tailProcess = NULL;
+    context->workload.nextProcessNum = 0;
+    context->workload.activeProcesses = 0;
+    context->workload.exitedProcesses = 0;
+    context->workload.nextArrival = INT_MAX;
+    context->workload.streamError = False;
+    context->workload.heldProcesses = 0;
 
-    MMU *memoryManagementUnit = createMMU(cfData->memAvailable);
+    if( stream != NULL )
+    {
+        pcbCode = startPcbStream( context, &currentProcess, stream );
+    }
+    else
+    {
+        pcbCode = buildPcbList( context, &currentProcess, currentNode );
+    }
 
-    pcbCode = buildPcbList( currentProcess, currentNode, cfData );
-    checkPcbCreation( cfData, startNode, pcbCode );
+    checkPcbCreation( context, pcbCode );
 
     if( pcbCode != 0 )
     {
-        logLine( cfData, startNode, "Unable to create PCB list. Exiting\n" );
+        logLine( context, "Unable to create PCB list. Exiting\n" );
+        closeTrace( &context->trace );
+        stopStatsServer( &context->liveStats );
         freePcbList( currentProcess );
+        free( memoryManagementUnit );
         free( timeString );
-        return startNode;
+        return context->logNode;
     }
 
-    time = accessTimer( LAP_TIMER, timeString );
-    logLine( cfData, startNode,
-             "Time:%10.6lf, OS: All processes initialized in New state\n", time );
+    if( stream != NULL )
+    {
+        time = accessTimer( &context->timer, LAP_TIMER, timeString );
+        logLine( context,
+                 "Time:%10.6lf, OS: Processes are created as they arrive\n",
+                 time );
+
+        context->workload.nextArrival = getNextArrival( context,
+                                                        currentProcess );
+        admitArrivals( context, currentProcess, NULL );
+    }
+    else
+    {
+        time = accessTimer( &context->timer, LAP_TIMER, timeString );
+        logLine( context,
+                 "Time:%10.6lf, OS: All processes initialized in New state\n",
+                 time );
+
+        setLiveState( &context->liveStats, NEW, READY,
+                      setStateRecursive( currentProcess, READY ) );
+        context->workload.nextArrival = getNextArrival( context,
+                                                        currentProcess );
+        time = accessTimer( &context->timer, LAP_TIMER, timeString );
+
+        if( context->workload.nextArrival == INT_MAX )
+        {
+            logLine( context,
+                     "Time:%10.6lf, OS: All processes now set in Ready state\n",
+                     time );
+        }
+        else
+        {
+            logLine( context,
+                     "Time:%10.6lf, OS: Arrived processes now set in Ready " \
+                     "state\n", time );
+        }
+    }
 
-    setStateRecursive( currentProcess, READY );
-    time = accessTimer( LAP_TIMER, timeString );
-    logLine( cfData, startNode,
-             "Time:%10.6lf, OS: All processes now set in Ready state\n", time);
+    if( checkDeviceQueues( context->cfData ) == True )
+    {
+        context->devices = createDeviceQueues( context->cfData );
+    }
 
-    if( stringCmp( cfData->cpuSchedCode, "FCFS-N" ) == True
-     || stringCmp( cfData->cpuSchedCode, "NONE" ) == True )
+    if( stringCmp( context->cfData->cpuSchedCode, "FCFS-N" ) == True
+     || stringCmp( context->cfData->cpuSchedCode, "NONE" ) == True )
+    {
+        processAsFCFSN( currentProcess, context, memoryManagementUnit );
+    }
+    else if( stringCmp( context->cfData->cpuSchedCode, "SJF-N" ) == True )
+    {
+        processAsSJFN( currentProcess, context, memoryManagementUnit );
+    }
+    else if( stringCmp( context->cfData->cpuSchedCode, "FCFS-P" ) == True )
     {
-        processAsFCFSN( currentProcess, cfData, startNode, memoryManagementUnit );
+        processAsFCFSP( currentProcess, context, memoryManagementUnit );
     }
-    else if( stringCmp( cfData->cpuSchedCode, "SJF-N" ) == True )
+    else if( stringCmp( context->cfData->cpuSchedCode, "SRTF-P" ) )
     {
-        processAsSJFN( currentProcess, cfData, startNode, memoryManagementUnit );
+        processAsSRTFP( currentProcess, context, memoryManagementUnit );
     }
-    else if( stringCmp( cfData->cpuSchedCode, "FCFS-P" ) == True )
+    else if( stringCmp( context->cfData->cpuSchedCode, "RR-P" ) )
     {
-        processAsFCFSP( currentProcess, cfData, startNode, memoryManagementUnit );
+        processAsRRP( currentProcess, context, memoryManagementUnit );
     }
-    else if( stringCmp( cfData->cpuSchedCode, "SRTF-P" ) )
+    else if( stringCmp( context->cfData->cpuSchedCode, "MLFQ-P" ) )
     {
-        processAsSRTFP( currentProcess, cfData, startNode, memoryManagementUnit );
+        processAsMLFQP( currentProcess, context, memoryManagementUnit );
     }
-    else if( stringCmp( cfData->cpuSchedCode, "RR-P" ) )
+    else if( stringCmp( context->cfData->cpuSchedCode, "CFS-P" ) )
     {
-        processAsRRP( currentProcess, cfData, startNode, memoryManagementUnit );
+        processAsCFSP( currentProcess, context, memoryManagementUnit );
+    }
+    else if( stringCmp( context->cfData->cpuSchedCode, "LOTTERY-P" )
+          || stringCmp( context->cfData->cpuSchedCode, "STRIDE-P" ) )
+    {
+        processAsShareP( currentProcess, context, memoryManagementUnit );
+    }
+    else if( stringCmp( context->cfData->cpuSchedCode, "EDF-P" )
+          || stringCmp( context->cfData->cpuSchedCode, "RM-P" ) )
+    {
+        processAsDeadlineP( currentProcess, context, memoryManagementUnit );
     }
     else
     {
-        logLine( cfData,
-                 startNode,
+        logLine( context,
                  "Unimplemented processing schedule code: \n" );
+        closeTrace( &context->trace );
+
+        if( context->devices != NULL )
+        {
+            freeDeviceQueues( context->devices );
+            context->devices = NULL;
+        }
+
+        stopStatsServer( &context->liveStats );
         freePcbList( currentProcess );
+        free( memoryManagementUnit );
         free( timeString );
-        return startNode;
+        return context->logNode;
+    }
+
+    time = accessTimer( &context->timer, LAP_TIMER, timeString );
+    logLine( context, "Time:%10.6lf, System stop\n", time );
+
+    context->runSummary.totalTime = time * 1000;
+    context->runSummary.processes = context->workload.nextProcessNum;
+
+    if( context->cfData->logMetrics == True )
+    {
+        logRunMetrics( context );
+    }
+
+    if( stringCmp( context->cfData->cpuSchedCode, "LOTTERY-P" )
+     || stringCmp( context->cfData->cpuSchedCode, "STRIDE-P" ) )
+    {
+        logShareMetrics( context );
     }
 
-    time = accessTimer( LAP_TIMER, timeString );
-    logLine( cfData, startNode, "Time:%10.6lf, System stop\n", time );
+    if( context->cfData->agingRate > 0
+     && ( stringCmp( context->cfData->cpuSchedCode, "SJF-N" )
+       || stringCmp( context->cfData->cpuSchedCode, "SRTF-P" ) ) )
+    {
+        logWaitMetrics( context );
+    }
+
+    logDeadlineMetrics( context );
+
+    if( context->devices != NULL )
+    {
+        logDeviceMetrics( context );
+        freeDeviceQueues( context->devices );
+        context->devices = NULL;
+    }
+
+    if( context->cfData->burstPrediction == True )
+    {
+        logBurstPrediction( context );
+    }
+
+    if( context->cfData->dumpCounters == True )
+    {
+        dumpCounters( context );
+    }
+
+    stopStatsServer( &context->liveStats );
+
+    if( context->cfData->metricsFilePath != NULL
+     && writeMetricsFile( &context->runMetrics,
+                          context->cfData->metricsFilePath,
+                          context->cfData->cpuSchedCode,
+                          context->runSummary.totalTime ) == False )
+    {
+        logLine( context, "Unable to write metrics file: %s\n",
+                 context->cfData->metricsFilePath );
+    }
 
+    if( context->cfData->histogramFilePrefix != NULL
+     && writeLatencyHistograms( &context->runMetrics,
+                                context->cfData->histogramFilePrefix )
+        == False )
+    {
+        logLine( context, "Unable to write histogram files: %s\n",
+                 context->cfData->histogramFilePrefix );
+    }
+
+    closeTrace( &context->trace );
     freePcbList( currentProcess );
     free( memoryManagementUnit );
     free( timeString );
-    return startNode;
+    return context->logNode;
 }
 //
 // buildPcbList Function Implementation ///////////////////////////////////
@@ -140,23 +584,39 @@ StringNode *beginProcessing( MetaNode *currentNode, ConfigData *cfData )
  *          PCB creation. Ideally, the MetaNode pointer it is given at the
  *          begging is the head of the linked list.
  *
- * @pre currentPCB a pointer to the head of a PCB linked list
+ * @par Algorithm
+ *      Each A(start) or T(start) block is checked and timed by
+ *      measurePcbBlock, then createPcbBlock makes its PCBs which are added
+ *      to the end of the list.
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre headProcess a pointer to where the head of the new list is stored
  *
  * @pre currentNode a pointer to the head of a MetaNode linked list
  *
- * @post currentNode and cfData remain unchanged at post
+ * @post currentNode and context remain unchanged at post
  *
- * @param[in] currentPCB a pointer to a PCB struct
+ * @post headProcess holds every PCB that was created, even on failure
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[out] headProcess a pointer to a PCB pointer
  *
  * @param[in] currentNode a pointer to a MetaNode struct
  *
  * @return code for the operation exit status, 0 for success and anything
  *         else is some kind of failure (int)
  */
-int buildPcbList( PCB *currentPCB, MetaNode *currentNode, ConfigData *cfData )
+int buildPcbList( SimContext *context,
+                  PCB **headProcess,
+                  MetaNode *currentNode )
 {
-    int processNum = 0, processFlag = 0, processTime = 0;
-    PCB *previous;
+    int processTime = 0, maxLoopDepth = 0, pcbCode = 0;
+    MetaNode *endNode = NULL;
+    PCB *tailProcess = NULL, *blockHead = NULL, *blockTail = NULL;
+
+    *headProcess = NULL;
 
     // Bad start node
     if( currentNode->commandLetter != 'S'
@@ -168,226 +628,570 @@ int buildPcbList( PCB *currentPCB, MetaNode *currentNode, ConfigData *cfData )
     currentNode = currentNode->nextNode;
 
     // Begin looping and creating PCBs
-    do
+    while( currentNode != NULL
+        && ( currentNode->commandLetter != 'S'
+          || stringCmp( currentNode->opString, "end" ) == False ) )
     {
-        if( currentNode == NULL )
+        // Make sure we see an A or a T
+        if( currentNode->commandLetter == 'A'
+         || currentNode->commandLetter == 'T' )
         {
-            return 2;
-        }
+            // An end outside of a block has no matching start
+            if ( stringCmp( currentNode->opString, "start" ) == False )
+            {
+                return 4;
+            }
 
-        // Make sure we see an A
-        if( currentNode->commandLetter == 'A' )
-        {
-            // Make sure we see a start
-            if ( stringCmp( currentNode->opString, "start" ) == True )
+            pcbCode = measurePcbBlock( currentNode,
+                                       context->cfData,
+                                       &processTime,
+                                       &maxLoopDepth,
+                                       &endNode );
+
+            if( pcbCode != 0 )
             {
-                if (processFlag == 0)
-                {
-                    currentPCB->processNum = processNum++;
-                    // THIS ONE
-                    currentPCB->startNode = currentNode->nextNode;
-                    currentPCB->state = NEW;
-                    processFlag = 1;
-                }
-                else
-                {
-                    return 3;
-                }
+                return pcbCode;
             }
-            // Make sure if we have seen a start we see and end
-            else if ( stringCmp( currentNode->opString, "end" ) == True )
+
+            blockHead = createPcbBlock( context,
+                                        currentNode,
+                                        processTime,
+                                        maxLoopDepth,
+                                        &blockTail );
+
+            if( blockHead != NULL )
             {
-                if ( processFlag == 1 )
+                if( tailProcess == NULL )
                 {
-                    currentPCB->processTime = processTime;
-                    PCB *newPCB = malloc( sizeof( *newPCB ) );
-                    previous = currentPCB;
-                    currentPCB->nextProcess = newPCB;
-                    currentPCB = newPCB;
-                    processFlag = 0;
-                    processTime = 0;
+                    *headProcess = blockHead;
                 }
                 else
                 {
-                    return 4;
+                    tailProcess->nextProcess = blockHead;
                 }
+
+                tailProcess = blockTail;
             }
+
+            currentNode = endNode;
         }
-        else
+        // Repeat blocks can only be used inside of a process
+        else if( currentNode->commandLetter == 'R' )
         {
-            processTime += getOpTime( currentNode, cfData );
+            return 7;
         }
 
         currentNode = currentNode->nextNode;
-
     }
 
-    while( currentNode->commandLetter != 'S'
-        || stringCmp( currentNode->opString, "end" ) == False);
-
-    previous->nextProcess = NULL;
-    free( currentPCB );
+    if( currentNode == NULL )
+    {
+        return 2;
+    }
 
-    if( processFlag == 1 )
+    if( *headProcess == NULL )
     {
-        return 5;
+        return 6;
     }
 
     return 0;
 }
 //
-// processAsFCFSN Function Implementation ///////////////////////////////////
+// measurePcbBlock Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function processes a PCB linked list using a First Come First
- *        Serve algorithm.
- *
- * @details This function processes a PCB linked list using a First Come First
- *          Serve algorithm, where the first PCB to come in is the first PCB
- *          that is processed by the system.
- *
- * @pre currentProcess a pointer to the head of a PCB linked list
+ * @brief This function checks and times a single process block
  *
- * @pre cfData a pointer to a ConfigData struct
+ * @details This function follows the ops of an A(start) or T(start) block
+ *          up to its matching end, adding up the time one process of the
+ *          block takes to run.
  *
- * @pre startNode a pointer to the head of a StringNode linked list
+ * @par Algorithm
+ *      Ops inside R(count){ ... } blocks have their time multiplied by the
+ *      repeat counts around them. The deepest nesting is returned so each
+ *      PCB can get a loop stack that size, the body itself is not expanded.
  *
- * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
+ * @pre blockNode a pointer to an A(start) or T(start) MetaNode
  *
- * @post startNode, cfData, and memoryManagementUnit remain unchanged at post
+ * @post blockNode and cfData remain unchanged at post
  *
- * @post currentProcess is a NULL pointer at post
+ * @param[in] blockNode a pointer to a MetaNode struct
  *
- * @param[in] currentProcess a pointer to a PCB struct
+ * @param[in] cfData a pointer to a ConfigData struct
  *
- * @param[in] startNode a pointer to a StringNode struct
+ * @param[out] processTime the time one process of the block takes
  *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @param[out] maxLoopDepth the deepest R(count) nesting in the block
  *
- * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
+ * @param[out] endNode the A(end) or T(end) node of the block
  *
- * @return Nothing to return (void)
+ * @return code for the operation exit status, 0 for success and the
+ *         buildPcbList failure codes otherwise (int)
  */
-void processAsFCFSN( PCB *currentProcess,
+int measurePcbBlock( MetaNode *blockNode,
                      ConfigData *cfData,
-                     StringNode *startNode,
-                     MMU *memoryManagementUnit )
+                     int *processTime,
+                     int *maxLoopDepth,
+                     MetaNode **endNode )
 {
-    double time = 0;
-    int processesCode = 0;
-    char *timeString = malloc( sizeof(char *) * 200 );
+    int loopDepth = 0;
+    double blockTime = 0, loopScale[ MAX_LOOP_DEPTH + 1 ];
+    MetaNode *currentNode = blockNode->nextNode;
 
-    while( currentProcess != NULL )
-    {
-        time = accessTimer( LAP_TIMER, timeString );
-        logLine( cfData, startNode,
-                 "Time:%10.6lf, OS: FCFS-N Strategy selects " \
-                 "Process %d with time: %d mSec\n",
-                 time, currentProcess->processNum, currentProcess->processTime  );
+    loopScale[ 0 ] = 1;
+    *maxLoopDepth = 0;
 
-        setState( cfData, startNode, currentProcess, RUNNING );
+    while( True )
+    {
+        if( currentNode == NULL )
+        {
+            return 2;
+        }
 
-        processesCode = runProcess( currentProcess,
-                                    cfData,
-                                    startNode,
-                                    memoryManagementUnit );
+        if( currentNode->commandLetter == 'S'
+         && stringCmp( currentNode->opString, "end" ) == True )
+        {
+            return 5;
+        }
 
-        if( processesCode == 2 )
+        if( currentNode->commandLetter == 'A'
+         || currentNode->commandLetter == 'T' )
         {
-            time = accessTimer( LAP_TIMER, timeString );
-            logLine( cfData, startNode,
-                     "Time:%10.6lf, OS: Process %d, " \
-                     "Segmentation Fault - Process ended\n",
-                     time, currentProcess->processNum );
+            if( stringCmp( currentNode->opString, "start" ) == True )
+            {
+                return 3;
+            }
+
+            // Make sure we see an end matching the start
+            if( currentNode->commandLetter != blockNode->commandLetter )
+            {
+                return 4;
+            }
+
+            if( loopDepth != 0 )
+            {
+                return 7;
+            }
+
+            break;
         }
+        // Repeat blocks only scale the time of the ops inside them
+        else if( currentNode->commandLetter == 'R' )
+        {
+            if( stringCmp( currentNode->opString, "start" ) == True )
+            {
+                if( loopDepth == MAX_LOOP_DEPTH
+                 || currentNode->cycleTime < 1
+                 || currentNode->nextNode == NULL
+                 || ( currentNode->nextNode->commandLetter == 'R'
+                   && stringCmp( currentNode->nextNode->opString,
+                                 "end" ) == True ) )
+                {
+                    return 7;
+                }
 
-        deallocate( memoryManagementUnit, currentProcess->processNum );
+                loopDepth++;
+                loopScale[ loopDepth ] = loopScale[ loopDepth - 1 ]
+                                       * currentNode->cycleTime;
 
-        setState( cfData, startNode, currentProcess, EXIT );
+                if( loopDepth > *maxLoopDepth )
+                {
+                    *maxLoopDepth = loopDepth;
+                }
+            }
+            else
+            {
+                if( loopDepth == 0 )
+                {
+                    return 7;
+                }
 
-        currentProcess = currentProcess->nextProcess;
+                loopDepth--;
+            }
+        }
+        else
+        {
+            blockTime += loopScale[ loopDepth ]
+                       * getOpTime( currentNode, cfData );
+        }
+
+        currentNode = currentNode->nextNode;
     }
 
-    free( timeString );
+    *processTime = blockTime < INT_MAX ? (int) blockTime : INT_MAX;
+    *endNode = currentNode;
+
+    return 0;
 }
 //
-// processAsSJFN Function Implementation ///////////////////////////////////
+// createPcbBlock Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function processes a PCB linked list using a Shortest Job
- *        First Nonpreemptive algorithm.
+ * @brief This function creates the PCBs for a single process block
  *
- * @details This function processes a PCB linked list using a Shortest Job
- *          First Nonpreemptive algorithm, where processes are executed from
- *          shortest to longest process based on total processing time.
+ * @details This function creates one PCB for an A(start) block, or N PCBs
+ *          for a T(start)N process template. Every PCB points at the same op
+ *          list, the ops themselves are never copied, each PCB only keeps
+ *          its own cursor into the shared list. If the block has a period,
+ *          each instance arrives one period after the one before, and its
+ *          deadline is counted from its own arrival.
  *
- * @pre currentProcess a pointer to the head of a PCB linked list
+ * @pre context a pointer to a SimContext struct
  *
- * @pre cfData a pointer to a ConfigData struct
+ * @pre blockNode a pointer to a checked A(start) or T(start) MetaNode
  *
- * @pre startNode a pointer to the head of a StringNode linked list
+ * @post blockNode remains unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] blockNode a pointer to a MetaNode struct
+ *
+ * @param[in] processTime the time one process of the block takes
+ *
+ * @param[in] maxLoopDepth the deepest R(count) nesting in the block
+ *
+ * @param[out] tailProcess the last PCB that was created
+ *
+ * @return the first PCB that was created, or NULL if none were (PCB *)
+ */
+PCB *createPcbBlock( SimContext *context,
+                     MetaNode *blockNode,
+                     int processTime,
+                     int maxLoopDepth,
+                     PCB **tailProcess )
+{
+    int instanceCount = 1, instance, relativeDeadline;
+    long long absoluteTime;
+    char trackName[ 30 ];
+    PCB *headProcess = NULL, *newProcess = NULL;
+
+    if( blockNode->commandLetter == 'T' )
+    {
+        instanceCount = blockNode->cycleTime;
+    }
+
+    *tailProcess = NULL;
+
+    for( instance = 0; instance < instanceCount; instance++ )
+    {
+        newProcess = createPCB();
+        newProcess->processNum = context->workload.nextProcessNum++;
+        setLiveState( &context->liveStats, -1, NEW, 1 );
+        newProcess->processTime = processTime;
+        absoluteTime = blockNode->arrivalTime
+                     + (long long) instance * blockNode->period;
+        newProcess->arrivalTime = absoluteTime < INT_MAX
+                                ? (int) absoluteTime : INT_MAX;
+        newProcess->nice = blockNode->nice;
+        newProcess->tickets = blockNode->tickets;
+        newProcess->period = blockNode->period;
+        relativeDeadline = blockNode->deadline > 0
+                         ? blockNode->deadline : blockNode->period;
+
+        if( relativeDeadline > 0 )
+        {
+            absoluteTime = (long long) newProcess->arrivalTime
+                         + relativeDeadline;
+            newProcess->deadline = absoluteTime < INT_MAX
+                                 ? (int) absoluteTime : INT_MAX;
+        }
+
+        initProcessMetrics( &newProcess->metrics, newProcess->processNum,
+                            newProcess->arrivalTime );
+        newProcess->metrics.deadline = newProcess->deadline;
+        newProcess->burstTau = context->cfData->burstInitialTau;
+
+        sprintf( trackName, "Process %d", newProcess->processNum );
+        traceTrackName( &context->trace, TRACE_PROCESS_PID,
+                        newProcess->processNum, trackName );
+        newProcess->startNode = blockNode->nextNode;
+
+        if( maxLoopDepth > 0 )
+        {
+            newProcess->loopStack = malloc( sizeof( LoopFrame ) * maxLoopDepth );
+        }
+
+        if( *tailProcess == NULL )
+        {
+            headProcess = newProcess;
+        }
+        else
+        {
+            ( *tailProcess )->nextProcess = newProcess;
+        }
+
+        *tailProcess = newProcess;
+        context->workload.activeProcesses++;
+    }
+
+    return headProcess;
+}
+//
+// startPcbStream Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function sets up a PCB ring for a streamed workload
+ *
+ * @details This function creates the head of the PCB ring for a streamed
+ *          workload. The head is a placeholder PCB that is always in the
+ *          Exit state, arriving processes are added behind it by
+ *          admitArrivals.
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre headProcess a pointer to where the head of the ring is stored
+ *
+ * @pre stream a pointer to a MetaStream that has read ahead its first block
+ *
+ * @post headProcess holds the placeholder PCB at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[out] headProcess a pointer to a PCB pointer
+ *
+ * @param[in] stream a pointer to a MetaStream struct
+ *
+ * @return code for the operation exit status, 0 for success and 6 if the
+ *         stream holds no processes (int)
+ */
+int startPcbStream( SimContext *context, PCB **headProcess, MetaStream *stream )
+{
+    PCB *placeholder = createPCB();
+
+    placeholder->processNum = -1;
+    placeholder->state = EXIT;
+    placeholder->nextProcess = placeholder;
+
+    context->workload.tailProcess = placeholder;
+    *headProcess = placeholder;
+
+    if( stream->pendingBlock == NULL )
+    {
+        return 6;
+    }
+
+    return 0;
+}
+//
+// processAsFCFSN Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function processes a PCB linked list using a First Come First
+ *        Serve algorithm.
+ *
+ * @details This function processes a PCB linked list using a First Come First
+ *          Serve algorithm, where the first PCB to come in is the first PCB
+ *          that is processed by the system.
+ *
+ * @pre currentProcess a pointer to the head of a PCB linked list
+ *
+ * @pre context a pointer to a SimContext struct
  *
  * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
  *
- * @post startNode, cfData, and memoryManagementUnit remain unchanged at post
+ * @post context and memoryManagementUnit remain unchanged at post
  *
  * @post currentProcess is a NULL pointer at post
  *
  * @param[in] currentProcess a pointer to a PCB struct
  *
- * @param[in] startNode a pointer to a StringNode struct
+ * @param[in] context a pointer to a SimContext struct
  *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @return Nothing to return (void)
+ */
+void processAsFCFSN( PCB *currentProcess,
+                     SimContext *context,
+                     MMU *memoryManagementUnit )
+{
+    double time = 0;
+    int processesCode = 0;
+    char *timeString = malloc( sizeof(char *) * 200 );
+    PCB *head = currentProcess, *selectedProcess = NULL;
+    PCB *tail = getFinalProcess(currentProcess);
+    tail->nextProcess = head;
+
+    while( checkWorkloadDone( context ) == False )
+    {
+        admitArrivals( context, head, currentProcess );
+        selectedProcess = getNextReadyProcess( currentProcess );
+
+        // Nothing has arrived yet, wait for the next process
+        if( selectedProcess == NULL )
+        {
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
+            logLine( context, "Time:%10.6lf, OS: CPU Idle\n", time );
+
+            waitForEvent( context );
+            continue;
+        }
+
+        currentProcess = selectedProcess;
+
+        time = accessTimer( &context->timer, LAP_TIMER, timeString );
+        logLine( context,
+                 "Time:%10.6lf, OS: FCFS-N Strategy selects " \
+                 "Process %d with time: %d mSec\n",
+                 time, currentProcess->processNum, currentProcess->processTime  );
+        countEvent( &context->counters, SCHEDULE_COUNTER, 1 );
+
+        setState( context, currentProcess, RUNNING );
+
+        processesCode = runProcess( currentProcess,
+                                    context,
+                                    memoryManagementUnit );
+
+        if( processesCode == 2 )
+        {
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
+            logLine( context,
+                     "Time:%10.6lf, OS: Process %d, " \
+                     "Segmentation Fault - Process ended\n",
+                     time, currentProcess->processNum );
+
+            context->runSummary.segFaults++;
+        }
+
+        deallocate( memoryManagementUnit, currentProcess->processNum );
+        setLiveMemory( &context->liveStats, memoryManagementUnit->totalMemory,
+                       memoryManagementUnit->memAvailable );
+
+        setState( context, currentProcess, EXIT );
+
+        currentProcess = currentProcess->nextProcess;
+    }
+
+    free( timeString );
+}
+//
+// processAsSJFN Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function processes a PCB linked list using a Shortest Job
+ *        First Nonpreemptive algorithm.
+ *
+ * @details This function processes a PCB linked list using a Shortest Job
+ *          First Nonpreemptive algorithm, where processes are executed from
+ *          shortest to longest process based on total processing time.
+ *
+ * @par Algorithm
+ *      Processes are added to the aging ready queue by setState as they
+ *      become ready, so picking the next process does not walk the PCB
+ *      list. With an Aging Rate, time spent waiting counts against the
+ *      process time so long processes are not starved.
+ *
+ * @pre currentProcess a pointer to the head of a PCB linked list
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @post context and memoryManagementUnit remain unchanged at post
+ *
+ * @post currentProcess is a NULL pointer at post
+ *
+ * @param[in] currentProcess a pointer to a PCB struct
+ *
+ * @param[in] context a pointer to a SimContext struct
  *
  * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
  *
  * @return Nothing to return (void)
  */
 void processAsSJFN( PCB *currentProcess,
-                    ConfigData *cfData,
-                    StringNode *startNode,
+                    SimContext *context,
                     MMU *memoryManagementUnit )
 {
     double time = 0;
     int processesCode = 0;
     char *timeString = malloc( sizeof(char *) * 200 );
     PCB *head = currentProcess, *selectedProcess = NULL;
+    PCB *tail = getFinalProcess(currentProcess);
+    tail->nextProcess = head;
+
+    context->aging = createAgingQueue( context->cfData );
+
+    // Processes made ready before the ready queue existed
+    do
+    {
+        if( currentProcess->state == READY )
+        {
+            queueAgingProcess( context->aging, currentProcess );
+        }
+
+        currentProcess = currentProcess->nextProcess;
+    }
+    while( currentProcess != head );
 
-    while( currentProcess != NULL )
+    while( checkWorkloadDone( context ) == False )
     {
-        selectedProcess = getShortestProcess(head);
+        admitArrivals( context, head, NULL );
 
-        time = accessTimer( LAP_TIMER, timeString );
-        logLine( cfData, startNode,
-                 "Time:%10.6lf, OS: SJF-N Strategy selects " \
-                 "Process %d with time: %d mSec\n",
-                 time, selectedProcess->processNum, selectedProcess->processTime );
+        selectedProcess = takeAgingProcess( context->aging );
+
+        // Nothing has arrived yet, wait for the next process
+        if( selectedProcess == NULL )
+        {
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
+            logLine( context, "Time:%10.6lf, OS: CPU Idle\n", time );
+
+            waitForEvent( context );
+            continue;
+        }
+
+        time = accessTimer( &context->timer, LAP_TIMER, timeString );
+
+        if( context->cfData->burstPrediction == True )
+        {
+            logLine( context,
+                     "Time:%10.6lf, OS: SJF-N Strategy selects " \
+                     "Process %d with predicted burst: %.3lf mSec " \
+                     "with time: %d mSec\n",
+                     time, selectedProcess->processNum,
+                     getPredictedTime( selectedProcess ),
+                     selectedProcess->processTime );
+        }
+        else
+        {
+            logLine( context,
+                     "Time:%10.6lf, OS: SJF-N Strategy selects " \
+                     "Process %d with time: %d mSec\n",
+                     time, selectedProcess->processNum, selectedProcess->processTime );
+        }
+        countEvent( &context->counters, SCHEDULE_COUNTER, 1 );
 
-        setState( cfData, startNode, selectedProcess, RUNNING );
+        setState( context, selectedProcess, RUNNING );
 
         processesCode = runProcess( selectedProcess,
-                                    cfData,
-                                    startNode,
+                                    context,
                                     memoryManagementUnit );
 
         if( processesCode == 2 )
         {
-            time = accessTimer( LAP_TIMER, timeString );
-            logLine( cfData, startNode,
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
+            logLine( context,
                      "Time:%10.6lf, OS: Process %d, " \
                      "Segmentation Fault - Process ended\n",
                      time, selectedProcess->processNum );
+
+            context->runSummary.segFaults++;
         }
 
         deallocate( memoryManagementUnit, selectedProcess->processNum );
+        setLiveMemory( &context->liveStats, memoryManagementUnit->totalMemory,
+                       memoryManagementUnit->memAvailable );
 
-        setState( cfData, startNode, selectedProcess, EXIT );
-
-        currentProcess = currentProcess->nextProcess;
+        setState( context, selectedProcess, EXIT );
     }
 
+    freeAgingQueue( context->aging );
+    context->aging = NULL;
     free( timeString );
 }
 //
@@ -404,29 +1208,24 @@ void processAsSJFN( PCB *currentProcess,
  *
  * @pre currentProcess a pointer to the head of a PCB linked list
  *
- * @pre cfData a pointer to a ConfigData struct
- *
- * @pre startNode a pointer to the head of a StringNode linked list
+ * @pre context a pointer to a SimContext struct
  *
  * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
  *
- * @post startNode, cfData, and memoryManagementUnit remain unchanged at post
+ * @post context and memoryManagementUnit remain unchanged at post
  *
  * @post currentProcess is a NULL pointer at post
  *
  * @param[in] currentProcess a pointer to a PCB struct
  *
- * @param[in] startNode a pointer to a StringNode struct
- *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @param[in] context a pointer to a SimContext struct
  *
  * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
  *
  * @return Nothing to return (void)
  */
 void processAsFCFSP( PCB *currentProcess,
-                     ConfigData *cfData,
-                     StringNode *startNode,
+                     SimContext *context,
                      MMU *memoryManagementUnit )
 {
     double time = 0;
@@ -440,47 +1239,56 @@ void processAsFCFSP( PCB *currentProcess,
 
     while( allExit == False )
     {
-        if( checkState(currentProcess, BLOCKED) )
+        admitArrivals( context, head, currentProcess );
+
+        if( checkIdle( context, currentProcess ) )
         {
-            time = accessTimer( LAP_TIMER, timeString );
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
 
-            logLine( cfData, startNode,
+            logLine( context,
                      "Time:%10.6lf, OS: CPU Idle\n",
                      time );
 
-            while(interuptQueueIterator < 0);
+            waitForEvent( context );
+
+            if( context->interuptQueueIterator > -1 )
+            {
+                resolveInterupts(context);
+            }
 
-            resolveInterupts(cfData, startNode);
+            admitArrivals( context, head, NULL );
             currentProcess = head;
         }
 
         if( currentProcess->state == READY )
         {
-            time = accessTimer( LAP_TIMER, timeString );
-            logLine( cfData, startNode,
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
+            logLine( context,
                      "Time:%10.6lf, OS: FCFS-N Strategy selects " \
                      "Process %d with time: %d mSec\n",
                      time, currentProcess->processNum, currentProcess->processTime );
+            countEvent( &context->counters, SCHEDULE_COUNTER, 1 );
 
-            setState( cfData, startNode, currentProcess, RUNNING );
+            setState( context, currentProcess, RUNNING );
 
             processesCode = runProcess( currentProcess,
-                                        cfData,
-                                        startNode,
+                                        context,
                                         memoryManagementUnit );
 
             // Final metadata process was found. Exit the PCB
             if( processesCode == 0 )
             {
                 deallocate( memoryManagementUnit, currentProcess->processNum );
+                setLiveMemory( &context->liveStats, memoryManagementUnit->totalMemory,
+                               memoryManagementUnit->memAvailable );
 
-                setState( cfData, startNode, currentProcess, EXIT );
+                setState( context, currentProcess, EXIT );
             }
             // End quantum or end of run process came through.
             // Reset the head and keep going
             else if( processesCode == 1 )
             {
-                setState( cfData, startNode, currentProcess, READY );
+                setState( context, currentProcess, READY );
 
                 currentProcess = head;
                 continue;
@@ -488,31 +1296,33 @@ void processAsFCFSP( PCB *currentProcess,
             // Memory segmentation fault happened. Handle appropriately
             else if( processesCode == 2 )
             {
-                  time = accessTimer( LAP_TIMER, timeString );
-                  logLine( cfData, startNode,
+                  time = accessTimer( &context->timer, LAP_TIMER, timeString );
+                  logLine( context,
                            "Time:%10.6lf, OS: Process %d, " \
                            "Segmentation Fault - Process ended\n",
                            time, currentProcess->processNum );
 
-                  setState( cfData, startNode, currentProcess, EXIT );
+                  context->runSummary.segFaults++;
+
+                  setState( context, currentProcess, EXIT );
             }
             // System has interupts, handle them
             else if( processesCode == 3 )
             {
-                  setState( cfData, startNode, currentProcess, READY );
+                  setState( context, currentProcess, READY );
 
-                  resolveInterupts(cfData, startNode);
+                  resolveInterupts(context);
                   currentProcess = head;
                   continue;
             }
             // System sent out an IO thread, set state to blocked
             else if( processesCode == 4 )
             {
-                  setState( cfData, startNode, currentProcess, BLOCKED );
+                  setState( context, currentProcess, BLOCKED );
             }
         }
 
-        allExit = checkState(currentProcess, EXIT);
+        allExit = checkWorkloadDone( context );
         currentProcess = currentProcess->nextProcess;
     }
 
@@ -530,31 +1340,31 @@ void processAsFCFSP( PCB *currentProcess,
  *          Time First Preemptive algorithm, where the job to processes is the
  *          shortest job currently in the ready state.
  *
- * @pre currentProcess a pointer to the head of a PCB linked list
+ * @par Algorithm
+ *      Processes are added to the aging ready queue by setState as they
+ *      become ready, and again after each quantum with their time left, so
+ *      picking the next process does not walk the PCB list.
  *
- * @pre cfData a pointer to a ConfigData struct
+ * @pre currentProcess a pointer to the head of a PCB linked list
  *
- * @pre startNode a pointer to the head of a StringNode linked list
+ * @pre context a pointer to a SimContext struct
  *
  * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
  *
- * @post startNode, cfData, and memoryManagementUnit remain unchanged at post
+ * @post context and memoryManagementUnit remain unchanged at post
  *
  * @post currentProcess is a NULL pointer at post
  *
  * @param[in] currentProcess a pointer to a PCB struct
  *
- * @param[in] startNode a pointer to a StringNode struct
- *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @param[in] context a pointer to a SimContext struct
  *
  * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
  *
  * @return Nothing to return (void)
  */
 void processAsSRTFP( PCB *currentProcess,
-                     ConfigData *cfData,
-                     StringNode *startNode,
+                     SimContext *context,
                      MMU *memoryManagementUnit )
 {
     double time = 0;
@@ -566,76 +1376,124 @@ void processAsSRTFP( PCB *currentProcess,
     PCB *tail = getFinalProcess(currentProcess);
     tail->nextProcess = head;
 
+    context->aging = createAgingQueue( context->cfData );
+
+    // Processes made ready before the ready queue existed
+    do
+    {
+        if( currentProcess->state == READY )
+        {
+            queueAgingProcess( context->aging, currentProcess );
+        }
+
+        currentProcess = currentProcess->nextProcess;
+    }
+    while( currentProcess != head );
+
     while( allExit == False )
     {
-        if( checkState(currentProcess, BLOCKED) )
+        admitArrivals( context, head, NULL );
+
+        if( context->aging->readyCount == 0
+         && checkWorkloadDone( context ) == False )
         {
-            time = accessTimer( LAP_TIMER, timeString );
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
 
-            logLine( cfData, startNode,
+            logLine( context,
                      "Time:%10.6lf, OS: CPU Idle\n",
                      time );
 
-            while(interuptQueueIterator < 0);
+            waitForEvent( context );
+
+            if( context->interuptQueueIterator > -1 )
+            {
+                resolveInterupts(context);
+            }
 
-            resolveInterupts(cfData, startNode);
+            admitArrivals( context, head, NULL );
         }
 
-        currentProcess = getShortestProcess(head);
+        currentProcess = takeAgingProcess( context->aging );
 
-        time = accessTimer( LAP_TIMER, timeString );
-        logLine( cfData, startNode,
-                 "Time:%10.6lf, OS: FCFS-N Strategy selects " \
-                 "Process %d with time: %d mSec\n",
-                 time, currentProcess->processNum, currentProcess->processTime );
+        if( currentProcess == NULL )
+        {
+            allExit = checkWorkloadDone( context );
+            continue;
+        }
+
+        time = accessTimer( &context->timer, LAP_TIMER, timeString );
+
+        if( context->cfData->burstPrediction == True )
+        {
+            logLine( context,
+                     "Time:%10.6lf, OS: SRTF-P Strategy selects " \
+                     "Process %d with predicted burst: %.3lf mSec " \
+                     "with time: %d mSec\n",
+                     time, currentProcess->processNum,
+                     getPredictedTime( currentProcess ),
+                     currentProcess->processTime );
+        }
+        else
+        {
+            logLine( context,
+                     "Time:%10.6lf, OS: FCFS-N Strategy selects " \
+                     "Process %d with time: %d mSec\n",
+                     time, currentProcess->processNum, currentProcess->processTime );
+        }
+        countEvent( &context->counters, SCHEDULE_COUNTER, 1 );
 
-        setState( cfData, startNode, currentProcess, RUNNING );
+        setState( context, currentProcess, RUNNING );
 
         processesCode = runProcess( currentProcess,
-                                    cfData,
-                                    startNode,
+                                    context,
                                     memoryManagementUnit );
 
         // Final metadata process was found. Exit the PCB
         if( processesCode == 0 )
         {
             deallocate( memoryManagementUnit, currentProcess->processNum );
+            setLiveMemory( &context->liveStats, memoryManagementUnit->totalMemory,
+                           memoryManagementUnit->memAvailable );
 
-            setState( cfData, startNode, currentProcess, EXIT );
+            setState( context, currentProcess, EXIT );
         }
         // End quantum or end of run process came through.
         // Reset the head and keep going
         else if( processesCode == 1 )
         {
-            setState( cfData, startNode, currentProcess, READY );
+            setState( context, currentProcess, READY );
         }
         // Memory segmentation fault happened. Handle appropriately
         else if( processesCode == 2 )
         {
-            time = accessTimer( LAP_TIMER, timeString );
-            logLine( cfData, startNode,
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
+            logLine( context,
                      "Time:%10.6lf, OS: Process %d, " \
                      "Segmentation Fault - Process ended\n",
                      time, currentProcess->processNum );
 
-            setState( cfData, startNode, currentProcess, EXIT );
+            context->runSummary.segFaults++;
+
+            setState( context, currentProcess, EXIT );
         }
         // System has interupts, handle them
         else if( processesCode == 3 )
         {
-            setState( cfData, startNode, currentProcess, READY );
+            setState( context, currentProcess, READY );
 
-            resolveInterupts(cfData, startNode);
+            resolveInterupts(context);
         }
         // System sent out an IO thread, set state to blocked
         else if( processesCode == 4 )
         {
-            setState( cfData, startNode, currentProcess, BLOCKED );
+            setState( context, currentProcess, BLOCKED );
         }
 
-          allExit = checkState(currentProcess, EXIT);
+          allExit = checkWorkloadDone( context );
     }
 
+    freeAgingQueue( context->aging );
+    context->aging = NULL;
     free( timeString );
 }
 
@@ -654,29 +1512,24 @@ void processAsSRTFP( PCB *currentProcess,
  *
  * @pre currentProcess a pointer to the head of a PCB linked list
  *
- * @pre cfData a pointer to a ConfigData struct
- *
- * @pre startNode a pointer to the head of a StringNode linked list
+ * @pre context a pointer to a SimContext struct
  *
  * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
  *
- * @post startNode, cfData, and memoryManagementUnit remain unchanged at post
+ * @post context and memoryManagementUnit remain unchanged at post
  *
  * @post currentProcess is a NULL pointer at post
  *
  * @param[in] currentProcess a pointer to a PCB struct
  *
- * @param[in] startNode a pointer to a StringNode struct
- *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @param[in] context a pointer to a SimContext struct
  *
  * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
  *
  * @return Nothing to return (void)
  */
 void processAsRRP( PCB *currentProcess,
-                     ConfigData *cfData,
-                     StringNode *startNode,
+                     SimContext *context,
                      MMU *memoryManagementUnit )
 {
     double time = 0;
@@ -690,1045 +1543,3634 @@ void processAsRRP( PCB *currentProcess,
 
     while( allExit == False )
     {
-        if( checkState(currentProcess, BLOCKED) )
+        admitArrivals( context, head, currentProcess );
+
+        if( checkIdle( context, currentProcess ) )
         {
-            time = accessTimer( LAP_TIMER, timeString );
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
 
-            logLine( cfData, startNode,
+            logLine( context,
                      "Time:%10.6lf, OS: CPU Idle\n",
                      time );
 
-            while(interuptQueueIterator < 0);
+            waitForEvent( context );
+
+            if( context->interuptQueueIterator > -1 )
+            {
+                resolveInterupts(context);
+            }
 
-            resolveInterupts(cfData, startNode);
+            admitArrivals( context, head, NULL );
             currentProcess = head;
         }
 
         if( currentProcess->state == READY )
         {
-            time = accessTimer( LAP_TIMER, timeString );
-            logLine( cfData, startNode,
-                     "Time:%10.6lf, OS: FCFS-N Strategy selects " \
-                     "Process %d with time: %d mSec\n",
-                     time, currentProcess->processNum, currentProcess->processTime );
+            currentProcess->quantumLeft = getRoundRobinQuantum( context,
+                                                                currentProcess );
+
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
+
+            if( context->cfData->rrAdaptive == True )
+            {
+                logLine( context,
+                         "Time:%10.6lf, OS: RR-P Strategy selects " \
+                         "Process %d with quantum: %d cycles with time: " \
+                         "%d mSec\n",
+                         time, currentProcess->processNum,
+                         currentProcess->quantumLeft,
+                         currentProcess->processTime );
+            }
+            else
+            {
+                logLine( context,
+                         "Time:%10.6lf, OS: FCFS-N Strategy selects " \
+                         "Process %d with time: %d mSec\n",
+                         time, currentProcess->processNum, currentProcess->processTime );
+            }
+            countEvent( &context->counters, SCHEDULE_COUNTER, 1 );
 
-            setState( cfData, startNode, currentProcess, RUNNING );
+            setState( context, currentProcess, RUNNING );
 
             processesCode = runProcess( currentProcess,
-                                        cfData,
-                                        startNode,
+                                        context,
                                         memoryManagementUnit );
 
             // Final metadata process was found. Exit the PCB
             if( processesCode == 0 )
             {
               deallocate( memoryManagementUnit, currentProcess->processNum );
+              setLiveMemory( &context->liveStats, memoryManagementUnit->totalMemory,
+                             memoryManagementUnit->memAvailable );
 
-              setState( cfData, startNode, currentProcess, EXIT );
+              setState( context, currentProcess, EXIT );
             }
             // End quantum or end of run process came through.
             // Reset the head and keep going
             else if( processesCode == 1 )
             {
-              setState( cfData, startNode, currentProcess, READY );
+              setState( context, currentProcess, READY );
             }
             // Memory segmentation fault happened. Handle appropriately
             else if( processesCode == 2 )
             {
-                time = accessTimer( LAP_TIMER, timeString );
-                logLine( cfData, startNode,
+                time = accessTimer( &context->timer, LAP_TIMER, timeString );
+                logLine( context,
                          "Time:%10.6lf, OS: Process %d, " \
                          "Segmentation Fault - Process ended\n",
                          time, currentProcess->processNum );
 
-                setState( cfData, startNode, currentProcess, EXIT );
+                context->runSummary.segFaults++;
+
+                setState( context, currentProcess, EXIT );
             }
             // System has interupts, handle them
             else if( processesCode == 3 )
             {
-              setState( cfData, startNode, currentProcess, READY );
+              setState( context, currentProcess, READY );
 
-              resolveInterupts(cfData, startNode);
+              resolveInterupts(context);
             }
             // System sent out an IO thread, set state to blocked
             else if( processesCode == 4 )
             {
-              setState( cfData, startNode, currentProcess, BLOCKED );
+              setState( context, currentProcess, BLOCKED );
             }
         }
 
-        allExit = checkState(currentProcess, EXIT);
+        allExit = checkWorkloadDone( context );
         currentProcess = currentProcess->nextProcess;
     }
 
   free( timeString );
 }
 //
-// runProcess Function Implementation ///////////////////////////////////
+// processAsMLFQP Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function processes a PCB.
+ * @brief This function processes a PCB linked list using a Multi-Level
+ *        Feedback Queue Preemptive algorithm.
  *
- * @details This function processes a PCB from its A(start)0 command to its
- *          A(end)0 command running all operations inbetween unless the
- *          execution of a command returns something other than 0.
+ * @details This function processes a PCB linked list using a Multi-Level
+ *          Feedback Queue Preemptive algorithm, where the system runs the
+ *          first ready process of the highest level for the quantum of that
+ *          level. A process that uses up its quantum is moved down a level,
+ *          one whose I/O ends is moved up a level, and every process is
+ *          moved back to the top level each boost time.
  *
- * @pre currentProcess a pointer to a PCB struct
+ * @par Algorithm
+ *      Processes are queued by setState as they become ready, so picking
+ *      the next process does not walk the PCB list. The run itself is
+ *      dispatchReadyQueue with the MLFQ-P hooks.
  *
- * @pre cfData a pointer to a ConfigData struct
+ * @pre currentProcess a pointer to the head of a PCB linked list
  *
- * @pre startNode a pointer to the head of a StringNode linked list
+ * @pre context a pointer to a SimContext struct
  *
  * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
  *
- * @post startNode, currentProcess, cfData, and memoryManagementUnit
- *       remain unchanged at post
+ * @post context and memoryManagementUnit remain unchanged at post
  *
- * @param[in] currentProcess a pointer to a PCB struct
+ * @post currentProcess is a NULL pointer at post
  *
- * @param[in] startNode a pointer to a StringNode struct
+ * @param[in] currentProcess a pointer to a PCB struct
  *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @param[in] context a pointer to a SimContext struct
  *
  * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
  *
- * @return Code for process execution status (int)
+ * @return Nothing to return (void)
  */
-int runProcess( PCB *currentProcess,
-                ConfigData *cfData,
-                StringNode *startNode,
-                MMU *memoryManagementUnit )
+void processAsMLFQP( PCB *currentProcess,
+                     SimContext *context,
+                     MMU *memoryManagementUnit )
 {
-    char *opPrint = NULL;
-    int executionCode = 0;
-    MetaNode *currentNode = currentProcess->startNode;
+    context->mlfq = createMlfq( context->cfData );
 
-    while ( currentNode->commandLetter != 'A'
-         || stringCmp( currentNode->opString, "end" ) == False )
-    {
-        switch ( currentNode->commandLetter )
-        {
-          case 'I':
-            opPrint = "input";
-            executionCode = executeOpIO( currentNode, currentProcess, cfData,
-                                         opPrint, startNode );
-            break;
+    dispatchReadyQueue( currentProcess, context, memoryManagementUnit,
+                        &mlfqReadyOps );
 
-          case 'O':
-            opPrint = "output";
-            executionCode = executeOpIO( currentNode, currentProcess, cfData,
-                                         opPrint, startNode );
-            break;
+    free( context->mlfq );
+    context->mlfq = NULL;
+}
+//
+// processAsCFSP Function Implementation ///////////////////////////////////
+//
 
-          case 'P':
-            opPrint = "Run operation";
-            executionCode = executeOp( currentNode, currentProcess, cfData,
-                                       opPrint, startNode );
-            break;
+/**
+ * @brief This function processes a PCB linked list using a Completely Fair
+ *        Scheduler Preemptive algorithm.
+ *
+ * @details This function processes a PCB linked list using a Completely Fair
+ *          Scheduler Preemptive algorithm, where the system runs the ready
+ *          process that has had the least CPU time for its weight. Each
+ *          process is given a slice of the target latency in proportion to
+ *          the weight of its nice value, which it keeps across ops.
+ *
+ * @par Algorithm
+ *      Processes are added to the ready tree by setState as they become
+ *      ready, so picking the next process does not walk the PCB list. The
+ *      run itself is dispatchReadyQueue with the CFS-P hooks.
+ *
+ * @pre currentProcess a pointer to the head of a PCB linked list
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @post context and memoryManagementUnit remain unchanged at post
+ *
+ * @post currentProcess is a NULL pointer at post
+ *
+ * @param[in] currentProcess a pointer to a PCB struct
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @return Nothing to return (void)
+ */
+void processAsCFSP( PCB *currentProcess,
+                     SimContext *context,
+                     MMU *memoryManagementUnit )
+{
+    context->cfs = createCfsQueue( context->cfData );
 
-          case 'M':
-            executionCode = executeOpMem( currentNode,
-                                          currentProcess,
-                                          cfData,
-                                          startNode,
-                                          memoryManagementUnit );
-            break;
+    dispatchReadyQueue( currentProcess, context, memoryManagementUnit,
+                        &cfsReadyOps );
+
+    free( context->cfs );
+    context->cfs = NULL;
+}
+//
+// processAsShareP Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function processes a PCB linked list using a Lottery or
+ *        Stride Preemptive algorithm.
+ *
+ * @details This function processes a PCB linked list using a Lottery or
+ *          Stride Preemptive algorithm, where each process gets a share of
+ *          the CPU in proportion to its tickets. LOTTERY-P runs the holder of
+ *          a ticket drawn at random for each quantum, STRIDE-P runs the
+ *          process with the least pass, which goes up by the inverse of its
+ *          tickets for each cycle it runs.
+ *
+ * @par Algorithm
+ *      Processes are added to the ready set by setState as they become
+ *      ready, so picking the next process does not walk the PCB list. The
+ *      run itself is dispatchReadyQueue with the LOTTERY-P and STRIDE-P
+ *      hooks.
+ *
+ * @pre currentProcess a pointer to the head of a PCB linked list
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @post context and memoryManagementUnit remain unchanged at post
+ *
+ * @post currentProcess is a NULL pointer at post
+ *
+ * @param[in] currentProcess a pointer to a PCB struct
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @return Nothing to return (void)
+ */
+void processAsShareP( PCB *currentProcess,
+                     SimContext *context,
+                     MMU *memoryManagementUnit )
+{
+    context->share = createShareQueue( context->cfData,
+                          stringCmp( context->cfData->cpuSchedCode,
+                                     "LOTTERY-P" ) );
+
+    dispatchReadyQueue( currentProcess, context, memoryManagementUnit,
+                        &shareReadyOps );
+
+    freeShareQueue( context->share );
+    context->share = NULL;
+}
+//
+// processAsDeadlineP Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function processes a PCB linked list using an Earliest
+ *        Deadline First or Rate Monotonic Preemptive algorithm.
+ *
+ * @details This function processes a PCB linked list using an Earliest
+ *          Deadline First or Rate Monotonic Preemptive algorithm. EDF-P
+ *          runs the ready process with the earliest absolute deadline,
+ *          RM-P the one with the shortest period. Processes without one run
+ *          when no process with one is ready.
+ *
+ * @par Algorithm
+ *      Processes are added to the ready heap by setState as they become
+ *      ready, so picking the next process does not walk the PCB list. The
+ *      periodic tasks known before the run are checked first, then the run
+ *      itself is dispatchReadyQueue with the EDF-P and RM-P hooks.
+ *
+ * @pre currentProcess a pointer to the head of a PCB linked list
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @post context and memoryManagementUnit remain unchanged at post
+ *
+ * @post currentProcess is a NULL pointer at post
+ *
+ * @param[in] currentProcess a pointer to a PCB struct
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @return Nothing to return (void)
+ */
+void processAsDeadlineP( PCB *currentProcess,
+                         SimContext *context,
+                         MMU *memoryManagementUnit )
+{
+    logSchedulability( context, currentProcess );
+
+    context->deadlines = createDeadlineQueue(
+                             stringCmp( context->cfData->cpuSchedCode,
+                                        "EDF-P" ) );
+
+    dispatchReadyQueue( currentProcess, context, memoryManagementUnit,
+                        &deadlineReadyOps );
+
+    freeDeadlineQueue( context->deadlines );
+    context->deadlines = NULL;
+}
+//
+// dispatchReadyQueue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function processes a PCB linked list from the ready
+ *        structure of a scheduling policy.
+ *
+ * @details This function runs the loop shared by the schedulers that keep
+ *          their ready processes in a structure of their own. The hooks of
+ *          the policy queue each process made ready, count and take the
+ *          ready processes, log the pick and charge the cycles a process
+ *          runs. Idling, running the picked process and acting on how it
+ *          stopped are the same for every policy.
+ *
+ * @par Algorithm
+ *      The hooks are set in the context for the run, so setState queues a
+ *      process made ready and executeOp charges a running one through them.
+ *
+ * @pre the ready structure of the policy has been created
+ *
+ * @pre currentProcess a pointer to the head of a PCB linked list
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @post context and memoryManagementUnit remain unchanged at post
+ *
+ * @post context has no hooks set at post
+ *
+ * @param[in] currentProcess a pointer to a PCB struct
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @param[in] ops a pointer to the ReadyQueueOps of the policy
+ *
+ * @return Nothing to return (void)
+ */
+void dispatchReadyQueue( PCB *currentProcess,
+                         SimContext *context,
+                         MMU *memoryManagementUnit,
+                         const ReadyQueueOps *ops )
+{
+    double time = 0;
+    int processesCode = 0;
+    char *timeString = malloc( sizeof(char *) * 200 );
+    Boolean allExit = False;
+
+    PCB *head = currentProcess;
+    PCB *tail = getFinalProcess(currentProcess);
+    tail->nextProcess = head;
+
+    context->readyOps = ops;
+
+    // Processes made ready before the ready structure existed
+    do
+    {
+        if( currentProcess->state == READY )
+        {
+            ops->queueProcess( context, currentProcess, True );
         }
 
-        if( executionCode == 4 )
+        currentProcess = currentProcess->nextProcess;
+    }
+    while( currentProcess != head );
+
+    while( allExit == False )
+    {
+        admitArrivals( context, head, NULL );
+
+        if( ops->countReady( context ) == 0
+         && checkWorkloadDone( context ) == False )
         {
-            currentProcess->startNode = currentNode->nextNode;
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
+
+            logLine( context,
+                     "Time:%10.6lf, OS: CPU Idle\n",
+                     time );
+
+            waitForEvent( context );
+
+            if( context->interuptQueueIterator > -1 )
+            {
+                resolveInterupts(context);
+            }
+
+            admitArrivals( context, head, NULL );
         }
-        else if( executionCode == 1 )
+
+        currentProcess = ops->takeProcess( context );
+
+        if( currentProcess == NULL )
         {
-            currentProcess->startNode = currentNode;
+            allExit = checkWorkloadDone( context );
+            continue;
         }
 
-        if( executionCode != 0 )
+        ops->selectProcess( context, currentProcess );
+        countEvent( &context->counters, SCHEDULE_COUNTER, 1 );
+
+        setState( context, currentProcess, RUNNING );
+
+        processesCode = runProcess( currentProcess,
+                                    context,
+                                    memoryManagementUnit );
+
+        // Final metadata process was found. Exit the PCB
+        if( processesCode == 0 )
         {
-            return executionCode;
+            deallocate( memoryManagementUnit, currentProcess->processNum );
+            setLiveMemory( &context->liveStats, memoryManagementUnit->totalMemory,
+                           memoryManagementUnit->memAvailable );
+
+            setState( context, currentProcess, EXIT );
         }
-        else if( executionCode == 0 && stringCmp(cfData->cpuSchedCode, "RR-P") )
+        // End quantum came through, back into the ready structure
+        else if( processesCode == 1 )
         {
-            currentProcess->startNode = currentNode->nextNode;
-            return 1;
+            setState( context, currentProcess, READY );
         }
+        // Memory segmentation fault happened. Handle appropriately
+        else if( processesCode == 2 )
+        {
+            time = accessTimer( &context->timer, LAP_TIMER, timeString );
+            logLine( context,
+                     "Time:%10.6lf, OS: Process %d, " \
+                     "Segmentation Fault - Process ended\n",
+                     time, currentProcess->processNum );
 
-        currentNode = currentNode->nextNode;
+            context->runSummary.segFaults++;
+
+            setState( context, currentProcess, EXIT );
+        }
+        // System has interupts, handle them
+        else if( processesCode == 3 )
+        {
+            setState( context, currentProcess, READY );
+
+            resolveInterupts(context);
+        }
+        // System sent out an IO thread, set state to blocked
+        else if( processesCode == 4 )
+        {
+            setState( context, currentProcess, BLOCKED );
+        }
+
+        allExit = checkWorkloadDone( context );
+    }
+
+    context->readyOps = NULL;
+    free( timeString );
+}
+//
+// queueMlfqReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function queues a process made ready under MLFQ-P
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] process a pointer to the ready PCB
+ *
+ * @param[in] fresh True unless the process was just running, unused
+ *
+ * @return nothing to return (void)
+ */
+void queueMlfqReady( SimContext *context, PCB *process, Boolean fresh )
+{
+    queueMlfqProcess( context->mlfq, process );
+}
+//
+// countMlfqReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function counts the ready processes under MLFQ-P
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return the number of ready processes (int)
+ */
+int countMlfqReady( SimContext *context )
+{
+    return context->mlfq->readyCount;
+}
+//
+// takeMlfqReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function takes the next process to run under MLFQ-P
+ *
+ * @details This function first moves every process back to the top level
+ *          if the boost time has come.
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return the first process of the highest level, NULL if none (PCB *)
+ */
+PCB *takeMlfqReady( SimContext *context )
+{
+    char timeString[ 300 ];
+    double time = accessTimer( &context->timer, LAP_TIMER, timeString );
+
+    if( boostMlfq( context->mlfq, time * 1000 ) == True )
+    {
+        logLine( context,
+                 "Time:%10.6lf, OS: MLFQ-P boosts all processes " \
+                 "to level 0\n",
+                 time );
+    }
+
+    return takeMlfqProcess( context->mlfq );
+}
+//
+// selectMlfqReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gives the process picked under MLFQ-P the quantum of
+ *        its level and logs it
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in,out] process a pointer to the picked PCB
+ *
+ * @return nothing to return (void)
+ */
+void selectMlfqReady( SimContext *context, PCB *process )
+{
+    char timeString[ 300 ];
+    double time = accessTimer( &context->timer, LAP_TIMER, timeString );
+
+    process->quantumLeft = getMlfqQuantum( context->mlfq, process );
+
+    logLine( context,
+             "Time:%10.6lf, OS: MLFQ-P Strategy selects " \
+             "Process %d at level %d with time: %d mSec\n",
+             time, process->processNum,
+             getMlfqLevel( context->mlfq, process ),
+             process->processTime );
+}
+//
+// demoteMlfqReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function moves a process that used its MLFQ-P quantum down a
+ *        level
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in,out] process a pointer to the running PCB
+ *
+ * @return nothing to return (void)
+ */
+void demoteMlfqReady( SimContext *context, PCB *process )
+{
+    demoteMlfqProcess( context->mlfq, process );
+}
+//
+// queueCfsReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds a process made ready to the CFS-P ready tree
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] process a pointer to the ready PCB
+ *
+ * @param[in] fresh True unless the process was just running
+ *
+ * @return nothing to return (void)
+ */
+void queueCfsReady( SimContext *context, PCB *process, Boolean fresh )
+{
+    queueCfsProcess( context->cfs, process, fresh );
+}
+//
+// countCfsReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function counts the ready processes under CFS-P
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return the number of ready processes (int)
+ */
+int countCfsReady( SimContext *context )
+{
+    return context->cfs->readyCount;
+}
+//
+// takeCfsReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function takes the next process to run under CFS-P
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return the process with the least vruntime, NULL if none (PCB *)
+ */
+PCB *takeCfsReady( SimContext *context )
+{
+    return takeCfsProcess( context->cfs );
+}
+//
+// selectCfsReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gives the process picked under CFS-P its slice and
+ *        logs it
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in,out] process a pointer to the picked PCB
+ *
+ * @return nothing to return (void)
+ */
+void selectCfsReady( SimContext *context, PCB *process )
+{
+    char timeString[ 300 ];
+    double time;
+
+    process->quantumLeft = getCfsSlice( context->cfs, process );
+
+    time = accessTimer( &context->timer, LAP_TIMER, timeString );
+    logLine( context,
+             "Time:%10.6lf, OS: CFS-P Strategy selects " \
+             "Process %d with vruntime: %lld uSec and slice: %d " \
+             "cycles with time: %d mSec\n",
+             time, process->processNum, process->vruntime,
+             process->quantumLeft, process->processTime );
+}
+//
+// chargeCfsReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function charges the cycles a process ran under CFS-P
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in,out] process a pointer to the running PCB
+ *
+ * @param[in] cycles the cycles it ran
+ *
+ * @return nothing to return (void)
+ */
+void chargeCfsReady( SimContext *context, PCB *process, int cycles )
+{
+    chargeCfsProcess( context->cfs, process, cycles );
+}
+//
+// queueShareReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds a process made ready to the LOTTERY-P or
+ *        STRIDE-P ready set
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] process a pointer to the ready PCB
+ *
+ * @param[in] fresh True unless the process was just running
+ *
+ * @return nothing to return (void)
+ */
+void queueShareReady( SimContext *context, PCB *process, Boolean fresh )
+{
+    queueShareProcess( context->share, process, fresh );
+}
+//
+// countShareReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function counts the ready processes under LOTTERY-P or
+ *        STRIDE-P
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return the number of ready processes (int)
+ */
+int countShareReady( SimContext *context )
+{
+    return context->share->readyCount;
+}
+//
+// takeShareReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function takes the next process to run under LOTTERY-P or
+ *        STRIDE-P
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return the winner of the draw or the process with the least pass, NULL
+ *         if none (PCB *)
+ */
+PCB *takeShareReady( SimContext *context )
+{
+    return takeShareProcess( context->share );
+}
+//
+// selectShareReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gives the process picked under LOTTERY-P or
+ *        STRIDE-P a quantum and logs it
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in,out] process a pointer to the picked PCB
+ *
+ * @return nothing to return (void)
+ */
+void selectShareReady( SimContext *context, PCB *process )
+{
+    char timeString[ 300 ];
+    double time = accessTimer( &context->timer, LAP_TIMER, timeString );
+
+    process->quantumLeft = context->cfData->quantumTime;
+
+    logLine( context,
+             "Time:%10.6lf, OS: %s Strategy selects " \
+             "Process %d with tickets: %d with time: %d mSec\n",
+             time, context->cfData->cpuSchedCode,
+             process->processNum, process->tickets,
+             process->processTime );
+}
+//
+// chargeShareReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function charges the cycles a process ran under LOTTERY-P or
+ *        STRIDE-P
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in,out] process a pointer to the running PCB
+ *
+ * @param[in] cycles the cycles it ran
+ *
+ * @return nothing to return (void)
+ */
+void chargeShareReady( SimContext *context, PCB *process, int cycles )
+{
+    chargeShareProcess( context->share, process, cycles );
+}
+//
+// queueDeadlineReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds a process made ready to the EDF-P or RM-P
+ *        ready heap
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] process a pointer to the ready PCB
+ *
+ * @param[in] fresh True unless the process was just running, unused
+ *
+ * @return nothing to return (void)
+ */
+void queueDeadlineReady( SimContext *context, PCB *process, Boolean fresh )
+{
+    queueDeadlineProcess( context->deadlines, process );
+}
+//
+// countDeadlineReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function counts the ready processes under EDF-P or RM-P
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return the number of ready processes (int)
+ */
+int countDeadlineReady( SimContext *context )
+{
+    return context->deadlines->readyCount;
+}
+//
+// takeDeadlineReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function takes the next process to run under EDF-P or RM-P
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return the process with the earliest deadline or shortest period, NULL
+ *         if none (PCB *)
+ */
+PCB *takeDeadlineReady( SimContext *context )
+{
+    return takeDeadlineProcess( context->deadlines );
+}
+//
+// selectDeadlineReady Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gives the process picked under EDF-P or RM-P a
+ *        quantum and logs it
+ *
+ * @details Arrivals are admitted between quanta, so a released job with an
+ *          earlier deadline or shorter period takes the CPU at the end of
+ *          the quantum it arrived in.
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in,out] process a pointer to the picked PCB
+ *
+ * @return nothing to return (void)
+ */
+void selectDeadlineReady( SimContext *context, PCB *process )
+{
+    char timeString[ 300 ];
+    double time = accessTimer( &context->timer, LAP_TIMER, timeString );
+    long long deadlineKey = getDeadlineKey( context->deadlines, process );
+
+    process->quantumLeft = context->cfData->quantumTime;
+
+    if( deadlineKey == NO_DEADLINE_KEY )
+    {
+        logLine( context,
+                 "Time:%10.6lf, OS: %s Strategy selects " \
+                 "Process %d without a %s with time: %d mSec\n",
+                 time, context->cfData->cpuSchedCode,
+                 process->processNum,
+                 context->deadlines->earliestDeadline == True
+                 ? "deadline" : "period",
+                 process->processTime );
+    }
+    else
+    {
+        logLine( context,
+                 "Time:%10.6lf, OS: %s Strategy selects " \
+                 "Process %d with %s: %lld mSec with time: %d mSec\n",
+                 time, context->cfData->cpuSchedCode,
+                 process->processNum,
+                 context->deadlines->earliestDeadline == True
+                 ? "deadline" : "period",
+                 deadlineKey, process->processTime );
+    }
+}
+//
+// logSchedulability Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function logs if the periodic tasks of a run can meet their
+ *        deadlines
+ *
+ * @details This function logs the density of the tasks under EDF-P, and
+ *          the response time of each task under RM-P. Only the tasks known
+ *          when the run starts are checked, which for a streamed workload
+ *          is its first block.
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre headProcess a pointer to the head of the PCB list or ring
+ *
+ * @post headProcess remains unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] headProcess a pointer to a PCB struct
+ *
+ * @return  Nothing to return (void)
+ */
+void logSchedulability( SimContext *context, PCB *headProcess )
+{
+    char timeString[ 300 ];
+    double time, density;
+    int taskCount, index, responseTime, missCount = 0;
+    char *schedCode = context->cfData->cpuSchedCode;
+    PeriodicTask *tasks = NULL;
+
+    taskCount = getPeriodicTasks( headProcess, &tasks );
+    time = accessTimer( &context->timer, LAP_TIMER, timeString );
+
+    if( taskCount == 0 )
+    {
+        logLine( context,
+                 "Time:%10.6lf, OS: %s schedulability check, " \
+                 "no periodic tasks\n", time, schedCode );
+    }
+    else if( stringCmp( schedCode, "EDF-P" ) == True )
+    {
+        density = getTaskDensity( tasks, taskCount );
+        logLine( context,
+                 "Time:%10.6lf, OS: %s schedulability check, %d periodic " \
+                 "tasks with density: %.3lf, %s\n",
+                 time, schedCode, taskCount, density,
+                 density <= 1 ? "schedulable" : "not schedulable" );
+    }
+    else
+    {
+        qsort( tasks, taskCount, sizeof( PeriodicTask ), comparePeriods );
+
+        for( index = 0; index < taskCount; index++ )
+        {
+            responseTime = getResponseTime( tasks, taskCount, index );
+
+            if( responseTime > tasks[ index ].deadline )
+            {
+                missCount++;
+            }
+
+            logLine( context,
+                     "Time:%10.6lf, OS: %s task with period: %d mSec " \
+                     "has response time: %d mSec of deadline: %d mSec\n",
+                     time, schedCode, tasks[ index ].period,
+                     responseTime, tasks[ index ].deadline );
+        }
+
+        logLine( context,
+                 "Time:%10.6lf, OS: %s schedulability check, %d periodic " \
+                 "tasks with %d that can miss, %s\n",
+                 time, schedCode, taskCount, missCount,
+                 missCount == 0 ? "schedulable" : "not schedulable" );
+    }
+
+    free( tasks );
+}
+//
+// runProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function processes a PCB.
+ *
+ * @details This function processes a PCB from its A(start)0 command to its
+ *          A(end)0 command (or T(start)/T(end) for template instances)
+ *          running all operations inbetween unless the execution of a
+ *          command returns something other than 0. The PCB cursor is kept
+ *          on the op being run so an interupted op is picked back up.
+ *
+ * @pre currentProcess a pointer to a PCB struct
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @post currentProcess, context, and memoryManagementUnit
+ *       remain unchanged at post
+ *
+ * @param[in] currentProcess a pointer to a PCB struct
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit struct
+ *
+ * @return Code for process execution status (int)
+ */
+int runProcess( PCB *currentProcess,
+                SimContext *context,
+                MMU *memoryManagementUnit )
+{
+    char *opPrint = NULL;
+    int executionCode = 0;
+    MetaNode *currentNode = resolveLoopNodes( currentProcess,
+                                              currentProcess->startNode );
+
+    while ( checkProcessEnd( currentNode ) == False )
+    {
+        currentProcess->startNode = currentNode;
+
+        switch ( currentNode->commandLetter )
+        {
+          case 'I':
+            opPrint = "input";
+            executionCode = executeOpIO( currentNode, currentProcess, context,
+                                         opPrint );
+            break;
+
+          case 'O':
+            opPrint = "output";
+            executionCode = executeOpIO( currentNode, currentProcess, context,
+                                         opPrint );
+            break;
+
+          case 'P':
+            opPrint = "Run operation";
+            executionCode = executeOp( currentNode, currentProcess, context,
+                                       opPrint );
+            break;
+
+          case 'M':
+            executionCode = executeOpMem( currentNode,
+                                          currentProcess,
+                                          context,
+                                          memoryManagementUnit );
+            break;
+        }
+
+        if( executionCode == 4 )
+        {
+            currentProcess->startNode = currentNode->nextNode;
+        }
+
+        if( executionCode != 0 )
+        {
+            return executionCode;
+        }
+
+        currentNode = resolveLoopNodes( currentProcess, currentNode->nextNode );
+
+        // The quantum ran out at the end of an op
+        if( checkQuantumCarried( context ) == True
+         && currentProcess->quantumLeft <= 0
+         && checkProcessEnd( currentNode ) == False )
+        {
+            currentProcess->startNode = currentNode;
+            expireQuantum( context, currentProcess );
+
+            return 1;
+        }
+    }
+
+    currentProcess->startNode = currentNode;
+
+    return executionCode;
+}
+//
+// executeOp Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function executes a MetaNode struct
+ *
+ * @details This function executes all MetaNode structs that contain either
+ *          memory allocation operations or process operations by running a timer
+ *          for a number of miliseconds.
+ *
+ * @pre currentNode a pointer to the MetaNode struct being processed
+ *
+ * @pre currentProcess a pointer to a PCB struct
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre opPrint a pointer to a string
+ *
+ * @post currentNode, currentProcess, opPrint, and context
+ *       remain unchanged at post
+ *
+ * @param[in] currentNode a pointer to a MetaNode struct
+ *
+ * @param[in] currentProcess a pointer to a PCB struct
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] opPrint a pointer to a string
+ *
+ * @return Nothing to return (void)
+ */
+int executeOp( MetaNode *currentNode,
+                PCB *currentProcess,
+                SimContext *context,
+                char *opPrint )
+{
+    int newCycleTime, runTime, runCycles;
+    int quantumTime = context->cfData->quantumTime;
+    char *timeString = malloc( sizeof( char ) * 200 );
+
+    TRACE_OP( context,
+              "Time:%10.6lf, Process %d, %s start\n",
+              TRACE_TIME( context, timeString ),
+              currentProcess->processNum, opPrint );
+
+    if( checkPremptive( context->cfData ) )
+    {
+        if( currentProcess->remainingCycles < 0 )
+        {
+            currentProcess->remainingCycles = currentNode->cycleTime;
+        }
+
+        if( checkQuantumCarried( context ) == True )
+        {
+            quantumTime = currentProcess->quantumLeft;
+        }
+
+        newCycleTime  = currentProcess->remainingCycles - quantumTime;
+        runCycles = newCycleTime < 0 ? currentProcess->remainingCycles
+                                     : quantumTime;
+        runTime = runCycles * context->cfData->processorCycleTime;
+
+        if( context->interuptQueueIterator > -1 )
+        {
+            // return of 3 means there is an interupt in the queue
+            free( timeString );
+            return 3;
+        }
+
+        if( context->readyOps != NULL
+         && context->readyOps->chargeProcess != NULL )
+        {
+            context->readyOps->chargeProcess( context, currentProcess,
+                                              runCycles );
+        }
+
+        if( checkQuantumCarried( context ) == True )
+        {
+            currentProcess->quantumLeft -= runCycles;
+        }
+
+        currentProcess->remainingCycles = newCycleTime;
+        currentProcess->processTime -= runTime;
+    }
+    else
+    {
+        runTime = getOpTime( currentNode,  context->cfData );
+        currentProcess->remainingCycles = 0;
+    }
+
+    runSimClock( context, runTime );
+    recordHistogramValue( &context->runMetrics.quantumUsed,
+                          (long long) runTime * 1000 );
+
+    if( checkBurstTracking( context->cfData ) == True )
+    {
+        currentProcess->burstTime += runTime;
+    }
+
+    if( currentProcess->remainingCycles > 0 )
+    {
+        expireQuantum( context, currentProcess );
+
+        free( timeString );
+        return 1;
+    }
+    else
+    {
+        currentProcess->remainingCycles = -1;
+        TRACE_OP( context,
+                  "Time:%10.6lf, Process %d, %s end\n",
+                  TRACE_TIME( context, timeString ),
+                  currentProcess->processNum, opPrint );
+    }
+
+    free( timeString );
+
+    return 0;
+}
+//
+// executeOpIO Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function executes a MetaNode struct
+ *
+ * @details This function executes all MetaNode structs that contain input or
+ *          output operations by running a timer on a pthread for a number of
+ *          milliseconds. When devices have channel counts the op first waits
+ *          for a channel of its device.
+ *
+ * @pre currentNode a pointer to the MetaNode struct being processed
+ *
+ * @pre currentProcess a pointer to a PCB struct
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre opPrint a pointer to a string
+ *
+ * @post currentNode, currentProcess, opPrint, and context
+ *       remain unchanged at post
+ *
+ * @param[in] currentNode a pointer to a MetaNode struct
+ *
+ * @param[in] currentProcess a pointer to a PCB struct
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] opPrint a pointer to a string
+ *
+ * @return Nothing to return (void)
+ */
+int executeOpIO( MetaNode *currentNode,
+                  PCB *currentProcess,
+                  SimContext *context,
+                  char *opPrint )
+{
+    float time;
+    double startTime;
+    pthread_t thread;
+    void *timeInMilliSecPtr;
+    int rc1, timeInMilliSec;
+    char *timeString = malloc( sizeof( char ) * 200 );
+
+    TRACE_OP( context,
+              "Time:%10.6lf, Process %d, %s %s start\n",
+              TRACE_TIME( context, timeString ),
+              currentProcess->processNum, currentNode->opString, opPrint );
+
+    if( checkBurstTracking( context->cfData ) == True )
+    {
+        endCpuBurst( context, currentProcess );
+    }
+
+    timeInMilliSec = getOpTime( currentNode, context->cfData );
+    timeInMilliSecPtr = &timeInMilliSec;
+
+    if( checkPremptive(context->cfData) == False )
+    {
+        // Nothing else runs until the I/O is done, so there is no need
+        // for a thread under the virtual clock
+        if( checkVirtualClock( &context->timer ) == True )
+        {
+            if( context->devices != NULL )
+            {
+                startTime = accessTimer( &context->timer, LAP_TIMER,
+                                         timeString );
+                advanceClock( &context->timer,
+                              ( reserveDevice( context->devices,
+                                               currentNode->opString,
+                                               startTime, timeInMilliSec )
+                                - startTime ) * 1000 );
+            }
+
+            runSimClock( context, timeInMilliSec );
+        }
+        else
+        {
+            if( context->devices != NULL )
+            {
+                acquireDevice( context->devices, currentNode->opString,
+                               &context->timer );
+            }
+
+            if( (rc1 = pthread_create( &thread, NULL, &runTimerIO, timeInMilliSecPtr)) )
+            {
+                logLine( context, "Thread creation failed\n" );
+
+                if( context->devices != NULL )
+                {
+                    releaseDevice( context->devices, currentNode->opString,
+                                   0 );
+                }
+
+                return 1;
+            }
+
+            countEvent( &context->counters, THREAD_CREATED_COUNTER, 1 );
+            pthread_join( thread, NULL );
+
+            if( context->devices != NULL )
+            {
+                releaseDevice( context->devices, currentNode->opString,
+                               timeInMilliSec );
+            }
+        }
+
+        time = accessTimer( &context->timer, LAP_TIMER, timeString );
+
+        TRACE_OP( context,
+                  "Time:%10.6lf, Process %d, %s %s end\n",
+                  time, currentProcess->processNum, currentNode->opString,
+                  opPrint );
+
+        traceDeviceSlice( context, currentProcess, currentNode->opString,
+                          opPrint, time, timeInMilliSec );
+
+        free( timeString );
+
+        return 0;
+    }
+    else
+    {
+        Interupt *interupt = createInterupt( context,
+                                             currentProcess,
+                                             timeInMilliSec,
+                                             currentNode->opString,
+                                             opPrint );
+
+        if( checkVirtualClock( &context->timer ) == True )
+        {
+            queueInterupt( interupt );
+        }
+        else
+        {
+            pthread_create( &thread, NULL, &controllerThread, (void *)interupt);
+            pthread_detach( thread );
+            countEvent( &context->counters, THREAD_CREATED_COUNTER, 1 );
+        }
+
+        free( timeString );
+
+        return 4;
+    }
+}
+//
+// executeOpMem Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function executes a MetaNode struct
+ *
+ * @details This function executes all MetaNode structs that contain memory
+ *          operations by running a either an allocation or access operation
+ *          using a memoryManagementUnit and a new memory segment
+ *
+ * @pre currentNode a pointer to the MetaNode struct being processed
+ *
+ * @pre currentProcess a pointer to a PCB struct
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre memoryManagementUnit a pointer to a memoryManagementUnit
+ *
+ * @post currentNode, currentProcess, memoryManagementUnit,
+ *       and context remain unchanged at post
+ *
+ * @param[in] currentNode a pointer to a MetaNode struct
+ *
+ * @param[in] currentProcess a pointer to a PCB struct
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit
+ *
+ * @return  Code for execution status (int)
+ */
+int executeOpMem( MetaNode *currentNode,
+                  PCB *currentProcess,
+                  SimContext *context,
+                  MMU *memoryManagementUnit )
+{
+  float time;
+  int memoryOpCode = 0;
+  long long startTime;
+  char traceName[ 100 ];
+  char *timeString = malloc( sizeof( char ) * 200 );
+  char *operation = NULL, *memoryOpStatus = "Success";
+  Memory *memory = NULL;
+
+  if( stringCmp(currentNode->opString, "access") == True )
+  {
+      operation = "MMU Access:";
+  }
+  else if( stringCmp(currentNode->opString, "allocate") == True )
+  {
+      operation = "MMU Allocation:";
+  }
+
+  memory = malloc( sizeof( *memory ) );
+  createMemory(currentNode, memory, currentProcess->processNum);
+
+  TRACE_OP( context,
+            "Time:%10.6lf, Process %d, %s %d/%d/%d\n",
+            TRACE_TIME( context, timeString ),
+            currentProcess->processNum, operation,
+            memory->segment, memory->startPosition, memory->offset );
+
+  sprintf( traceName, "%s %d/%d/%d", operation,
+           memory->segment, memory->startPosition, memory->offset );
+
+  // MMU ops take no simulated time, so the host time they take is kept
+  startTime = getHostNanoSec();
+
+  if( stringCmp(currentNode->opString, "access") == True )
+  {
+      memoryOpCode = accessMemory( memoryManagementUnit, memory );
+      countEvent( &context->counters, MMU_ACCESS_COUNTER, 1 );
+  }
+  else if( stringCmp(currentNode->opString, "allocate") == True )
+  {
+      memoryOpCode = allocate( memoryManagementUnit, memory );
+      countEvent( &context->counters, MMU_ALLOCATE_COUNTER, 1 );
+  }
+
+  recordHistogramValue( &context->runMetrics.mmuLatency,
+                        getHostNanoSec() - startTime );
+
+  setLiveMemory( &context->liveStats, memoryManagementUnit->totalMemory,
+                 memoryManagementUnit->memAvailable );
+
+  if( memoryOpCode != 0 )
+  {
+      memoryOpStatus = "Failed";
+      countEvent( &context->counters, MMU_FAIL_COUNTER, 1 );
+      free( memory );
+  }
+  else if( stringCmp(currentNode->opString, "access") == True )
+  {
+      free( memory );
+  }
+
+  time = accessTimer( &context->timer, LAP_TIMER, timeString );
+  TRACE_OP( context,
+            "Time:%10.6lf, Process %d, %s %s\n",
+            time, currentProcess->processNum, operation, memoryOpStatus );
+
+  if( checkTracing( &context->trace ) == True )
+  {
+      sprintf( timeString, "%s %s", traceName, memoryOpStatus );
+      traceInstant( &context->trace, TRACE_PROCESS_PID,
+                    currentProcess->processNum, timeString, "mmu", time );
+  }
+
+  free( timeString );
+
+  return memoryOpCode;
+}
+//
+// getOpTime Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function estimates the run time in milliseconds for a given
+ *        MetaNode
+ *
+ * @details This function estimates the run time in milliseconds for a given MetaNode
+ *          by multiplying the ioCycleTime by the MetaNodes cycleTime for I/O
+ *          operations or by multiplying the processorCycleTime by the MetaNode
+ *          cycleTime which is then returned. A device with its own cycle
+ *          time uses it instead of the ioCycleTime.
+ *
+ * @pre currentNode a pointer to the MetaNode struct being estimated
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @post currentNode, and cfData remain unchanged at post
+ *
+ * @param[in] currentNode a pointer to a MetaNode struct
+ *
+ * @param[in] cfData a pointer to a ConfigData struct
+ *
+ * @return the estimated time of a MetaNode operation runtime in
+ *         milliseconds (int)
+ */
+int getOpTime( MetaNode *currentNode, ConfigData *cfData )
+{
+    int runTime = 0, device;
+
+    switch ( currentNode->commandLetter )
+    {
+      case 'I':
+      case 'O':
+        runTime = cfData->ioCycleTime * currentNode->cycleTime;
+        device = getDeviceIndex( currentNode->opString );
+
+        if( device != -1 && cfData->deviceCycleTimes[ device ] > 0 )
+        {
+            runTime = cfData->deviceCycleTimes[ device ]
+                    * currentNode->cycleTime;
+        }
+        break;
+
+      case 'S':
+      case 'A':
+      case 'P':
+        runTime = cfData->processorCycleTime * currentNode->cycleTime;
+        break;
+
+      case 'M':
+        runTime = 0;
+        break;
+    }
+
+    return runTime;
+}
+//
+// setState Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function sets the state of a given PCB to the given state
+ *
+ * @details This function sets the state of a given PCB to the given state where
+ *          the state is defined in the STATE enumeration
+ *
+ * @par Algorithm
+ *      The time spent in the old state is added to the metrics of the PCB
+ *      by updateProcessMetrics before the new state is logged. A dispatch
+ *      runs the clock for its context switch by chargeContextSwitch, and
+ *      the old state ends before it while the Running state starts after
+ *      it, so the switch is neither waiting nor busy time.
+ *
+ * @pre currentPCB a pointer to a PCB struct
+ *
+ * @pre state a state value defined in the STATE enum
+ *
+ * @post currentPCB has its state set to the state variable
+ *
+ * @post context holds the updated run totals at post
+ *
+ * @param[in] currentPCB a pointer to a PCB struct
+ *
+ * @param[in] state a state value
+ *
+ * @return  Nothing to return (void)
+ */
+void setState( SimContext *context, PCB *currentPCB, STATE state )
+{
+  STATE oldState = currentPCB->state;
+  currentPCB->state = state;
+  char timeString[300];
+  double metricTime, switchEnd;
+  float time;
+  int switchTime = 0;
+
+  metricTime = accessTimer( &context->timer, LAP_TIMER, timeString );
+
+  if( oldState == READY && state == RUNNING )
+  {
+      switchTime = chargeContextSwitch( context, currentPCB );
+  }
+
+  switchEnd = metricTime;
+
+  if( switchTime > 0 )
+  {
+      switchEnd = accessTimer( &context->timer, LAP_TIMER, timeString );
+  }
+
+  time = switchEnd;
+
+  if( switchTime > 0 )
+  {
+      TRACE_EVENT( context,
+                   "Time:%10.6lf, OS: Process %d, context switch took " \
+                   "%d mSec\n",
+                   time, currentPCB->processNum, switchTime );
+  }
+
+  // Settled before the metrics of an exiting process are recorded
+  if( context->share != NULL && oldState == RUNNING && state != READY )
+  {
+      leaveShareQueue( context->share, currentPCB );
+  }
+
+  if( checkBurstTracking( context->cfData ) == True && state == EXIT )
+  {
+      endCpuBurst( context, currentPCB );
+  }
+
+  traceProcessState( context, currentPCB, oldState, metricTime );
+  updateProcessMetrics( context, currentPCB, oldState, metricTime * 1000 );
+  currentPCB->metrics.stateTime = switchEnd * 1000;
+  setLiveState( &context->liveStats, oldState, state, 1 );
+
+  if( oldState == RUNNING )
+  {
+      currentPCB->cacheMark = context->runMetrics.busyTime;
+  }
+
+  if( context->readyOps != NULL && state == READY && oldState != READY )
+  {
+      context->readyOps->queueProcess( context, currentPCB,
+                                       oldState != RUNNING );
+  }
+
+  if( context->aging != NULL && state == READY && oldState != READY )
+  {
+      queueAgingProcess( context->aging, currentPCB );
+  }
+
+  setLiveProgress( &context->liveStats, switchEnd,
+                   context->interuptQueueIterator + 1,
+                   context->pendingInteruptCount );
+
+  TRACE_EVENT( context,
+               "Time:%10.6lf, OS: Process %d set in %s state\n",
+               time, currentPCB->processNum, stateNames[ state ] );
+
+  if( state == EXIT )
+  {
+      context->workload.activeProcesses--;
+      context->workload.exitedProcesses++;
+  }
+  else if( state == RUNNING )
+  {
+      context->runSummary.dispatches++;
+  }
+  else if( state == BLOCKED )
+  {
+      context->runSummary.ioBlocks++;
+  }
+
+  checkCounterDump( context );
+}
+
+//
+// chargeContextSwitch Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function runs the clock for the cost of dispatching a process
+ *
+ * @details This function charges the Context Switch cycles of every
+ *          dispatch, plus the cycles the process needs to refill its cache
+ *          if other processes ran since it last did. The time is spent
+ *          before the process is set in the Running state, so it counts as
+ *          neither waiting nor CPU busy time, only as switch time.
+ *
+ * @par Algorithm
+ *      The cache of a process cools in step with the CPU time others run
+ *      after it stops, so the refill is the Cache Refill cycles times the
+ *      share of the Cache Decay cycles others ran, at most all of them. A
+ *      process that never ran has a cold cache.
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre currentPCB a pointer to a PCB leaving the Ready state
+ *
+ * @param[in,out] context a pointer to a SimContext struct
+ *
+ * @param[in] currentPCB a pointer to a PCB struct
+ *
+ * @return the msec charged (int)
+ */
+int chargeContextSwitch( SimContext *context, PCB *currentPCB )
+{
+    ConfigData *cfData = context->cfData;
+    double coldShare = 1, decayTime, otherTime;
+    int switchTime = cfData->contextSwitchCycles * cfData->processorCycleTime;
+
+    if( cfData->cacheRefillCycles > 0 && currentPCB->cacheMark >= 0 )
+    {
+        decayTime = (double) cfData->cacheDecayCycles
+                  * cfData->processorCycleTime;
+        otherTime = context->runMetrics.busyTime - currentPCB->cacheMark;
+
+        if( otherTime <= 0 )
+        {
+            coldShare = 0;
+        }
+        else if( otherTime < decayTime )
+        {
+            coldShare = otherTime / decayTime;
+        }
+    }
+
+    if( cfData->cacheRefillCycles > 0 )
+    {
+        switchTime += (int) ( coldShare * cfData->cacheRefillCycles
+                                         * cfData->processorCycleTime + 0.5 );
+    }
+
+    if( switchTime > 0 )
+    {
+        runSimClock( context, switchTime );
+        context->runMetrics.switchTime += switchTime;
+    }
+
+    return switchTime;
+}
+//
+// setStateRecursive Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function sets the state of a given PCB linked list to the given
+ *        state recruvisely
+ *
+ * @details This function sets the state of a all PCBs in a linked list to the
+ *          given state where the state is defined in the STATE enumeration
+ *
+ * @par Algorithm
+ *      PCBs with a later arrival time are skipped, they are left in the New
+ *      state until admitArrivals sees simulated time reach them.
+ *
+ * @pre currentPCB a pointer to a PCB struct
+ *
+ * @pre state a state value defined in the STATE enum
+ *
+ * @post currentPCB has its state set to the state variable
+ *
+ * @post cfData remains unchanged at post
+ *
+ * @param[in] currentPCB a pointer to a PCB struct
+ *
+ * @param[in] state a state value
+ *
+ * @return the number of PCBs set (int)
+ */
+int setStateRecursive( PCB *currentPCB, STATE state )
+{
+  int setCount = 0;
+
+  while( currentPCB != NULL )
+  {
+    if( currentPCB->arrivalTime <= 0 )
+    {
+        currentPCB->state = state;
+        setCount++;
+    }
+
+    currentPCB = currentPCB->nextProcess;
+  }
+
+  return setCount;
+}
+//
+// updateProcessMetrics Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function updates the metrics of a PCB that changed state
+ *
+ * @details This function adds the time a PCB spent in its old state to its
+ *          waiting, blocked or CPU busy time, and keeps the metrics of the
+ *          run up to date with dispatches and exits. The time from Ready to
+ *          Running is also recorded as the dispatch latency.
+ *
+ * @par Algorithm
+ *      Time in the New state only counts as waiting once the PCB has
+ *      arrived, as stateTime starts at its arrival time. A dispatch counts
+ *      as a context switch when a different process ran last.
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre currentPCB a pointer to a PCB struct already set in its new state
+ *
+ * @post currentPCB holds the start time of its new state at post
+ *
+ * @param[in,out] context a pointer to a SimContext struct
+ *
+ * @param[in,out] currentPCB a pointer to a PCB struct
+ *
+ * @param[in] oldState the state the PCB was in
+ *
+ * @param[in] time the simulated time of the change in msec
+ *
+ * @return  Nothing to return (void)
+ */
+void updateProcessMetrics( SimContext *context,
+                           PCB *currentPCB,
+                           STATE oldState,
+                           double time )
+{
+  ProcessMetrics *metrics = &currentPCB->metrics;
+  RunMetrics *runMetrics = &context->runMetrics;
+  double stateLength = time - metrics->stateTime;
+
+  if( stateLength < 0 )
+  {
+      stateLength = 0;
+  }
+
+  if( oldState == NEW || oldState == READY )
+  {
+      metrics->waitTime += stateLength;
+
+      if( stateLength > metrics->maxWait )
+      {
+          metrics->maxWait = stateLength;
+      }
+  }
+
+  if( oldState == READY && currentPCB->state == RUNNING )
+  {
+      recordHistogramValue( &runMetrics->dispatchLatency,
+                            (long long) ( stateLength * 1000 ) );
+  }
+  else if( oldState == BLOCKED )
+  {
+      metrics->blockedTime += stateLength;
+  }
+  else if( oldState == RUNNING )
+  {
+      runMetrics->busyTime += stateLength;
+      metrics->runTime += stateLength;
+  }
+
+  metrics->stateTime = time;
+
+  if( currentPCB->state == RUNNING )
+  {
+      if( metrics->firstRunTime < 0 )
+      {
+          metrics->firstRunTime = time;
+      }
+
+      if( runMetrics->lastProcessNum != -1
+       && runMetrics->lastProcessNum != currentPCB->processNum )
+      {
+          runMetrics->contextSwitches++;
+          countEvent( &context->counters, CONTEXT_SWITCH_COUNTER, 1 );
+      }
+
+      runMetrics->lastProcessNum = currentPCB->processNum;
+  }
+  else if( currentPCB->state == EXIT )
+  {
+      metrics->completionTime = time;
+      recordProcessMetrics( runMetrics, metrics );
+  }
+}
+//
+// logRunMetrics Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function logs the summary of the scheduling metrics of a run
+ *
+ * @details This function logs a table of the mean and percentile
+ *          turnaround, waiting and response times of every exited process,
+ *          followed by the CPU utilization, context switches and throughput.
+ *
+ * @pre context a pointer to the SimContext of a finished run
+ *
+ * @post context remains unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return  Nothing to return (void)
+ */
+void logRunMetrics( SimContext *context )
+{
+  const char *metricNames[] = { "Turnaround", "Waiting", "Response" };
+  RunMetrics *runMetrics = &context->runMetrics;
+  double totalTime = context->runSummary.totalTime;
+  double utilization = 0, throughput = 0;
+  MetricStats stats;
+  int type;
+
+  if( totalTime > 0 )
+  {
+      utilization = runMetrics->busyTime / totalTime * 100;
+      throughput = runMetrics->processCount / ( totalTime / 1000 );
+  }
+
+  logLine( context, "\nScheduling Metrics (%d processes)\n",
+           runMetrics->processCount );
+  logLine( context, "=================================\n" );
+  logLine( context, "%-17s %12s %12s %12s %12s\n",
+           "(mSec)", "Mean", "p50", "p95", "p99" );
+
+  for( type = TURNAROUND_METRIC; type <= RESPONSE_METRIC; type++ )
+  {
+      getMetricStats( runMetrics, type, &stats );
+      logLine( context, "%-17s %12.3lf %12.3lf %12.3lf %12.3lf\n",
+               metricNames[ type ], stats.mean, stats.p50, stats.p95,
+               stats.p99 );
+  }
+
+  logLine( context, "%-17s %11.2lf%%\n", "CPU Utilization", utilization );
+  logLine( context, "%-17s %12d\n", "Context Switches",
+           runMetrics->contextSwitches );
+
+  if( runMetrics->switchTime > 0 )
+  {
+      logLine( context, "%-17s %12.3lf mSec\n", "Switch Overhead",
+               runMetrics->switchTime );
+  }
+  logLine( context, "%-17s %12.3lf processes/sec\n", "Throughput",
+           throughput );
+}
+//
+// logShareMetrics Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function logs the CPU share of each process of a LOTTERY-P or
+ *        STRIDE-P run
+ *
+ * @details This function logs the CPU time the tickets of every exited
+ *          process were owed next to the CPU time it got, both in msec and
+ *          as a share of the time the process could run, from its arrival
+ *          to its exit less the time it was blocked.
+ *
+ * @pre context a pointer to the SimContext of a finished run
+ *
+ * @post context remains unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return  Nothing to return (void)
+ */
+void logShareMetrics( SimContext *context )
+{
+  RunMetrics *runMetrics = &context->runMetrics;
+  ProcessMetrics *metrics;
+  double runnableTime;
+  int index;
+
+  logLine( context, "\nCPU Shares (%d processes)\n",
+           runMetrics->processCount );
+  logLine( context, "=================================\n" );
+  logLine( context, "%-10s %12s %12s %12s %12s\n",
+           "Process", "Target mSec", "Got mSec", "Target %", "Got %" );
+
+  for( index = 0; index < runMetrics->processCount; index++ )
+  {
+      metrics = &runMetrics->processes[ index ];
+      runnableTime = metrics->completionTime - metrics->arrivalTime
+                   - metrics->blockedTime;
+
+      if( runnableTime <= 0 )
+      {
+          runnableTime = 1;
+      }
+
+      logLine( context, "%-10d %12.3lf %12.3lf %11.2lf%% %11.2lf%%\n",
+               metrics->processNum, metrics->shareTime, metrics->runTime,
+               metrics->shareTime / runnableTime * 100,
+               metrics->runTime / runnableTime * 100 );
+  }
+}
+//
+// logWaitMetrics Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function logs the waits of each process of an aged SJF-N or
+ *        SRTF-P run
+ *
+ * @details This function logs the total time every exited process spent
+ *          waiting in the Ready state and its longest single wait, which
+ *          aging keeps from growing without bound, followed by the longest
+ *          wait of the run.
+ *
+ * @pre context a pointer to the SimContext of a finished run
+ *
+ * @post context remains unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return  Nothing to return (void)
+ */
+void logWaitMetrics( SimContext *context )
+{
+  RunMetrics *runMetrics = &context->runMetrics;
+  ProcessMetrics *metrics;
+  double longestWait = 0;
+  int index, longestProcess = -1;
+
+  logLine( context, "\nReady Waits (%d processes)\n",
+           runMetrics->processCount );
+  logLine( context, "=================================\n" );
+  logLine( context, "%-10s %12s %12s\n", "Process", "Wait mSec", "Max mSec" );
+
+  for( index = 0; index < runMetrics->processCount; index++ )
+  {
+      metrics = &runMetrics->processes[ index ];
+
+      logLine( context, "%-10d %12.3lf %12.3lf\n",
+               metrics->processNum, metrics->waitTime, metrics->maxWait );
+
+      if( metrics->maxWait > longestWait || longestProcess == -1 )
+      {
+          longestWait = metrics->maxWait;
+          longestProcess = metrics->processNum;
+      }
+  }
+
+  logLine( context, "%-17s %12.3lf mSec by Process %d\n", "Longest Wait",
+           longestWait, longestProcess );
+}
+//
+// logDeadlineMetrics Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function logs the deadlines met and missed in a run
+ *
+ * @details This function logs how many of the exited processes with a
+ *          deadline missed it, how late the ones that missed were and how
+ *          much time the ones that met it had to spare. Nothing is logged
+ *          if no process had a deadline.
+ *
+ * @pre context a pointer to the SimContext of a finished run
+ *
+ * @post context remains unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return  Nothing to return (void)
+ */
+void logDeadlineMetrics( SimContext *context )
+{
+  RunMetrics *runMetrics = &context->runMetrics;
+  ProcessMetrics *metrics;
+  double lateness, slack, totalLateness = 0, maxLateness = 0;
+  double totalSlack = 0, minSlack = 0;
+  int index, deadlineCount = 0, missCount = 0;
+
+  for( index = 0; index < runMetrics->processCount; index++ )
+  {
+      metrics = &runMetrics->processes[ index ];
+
+      if( metrics->deadline < 0 )
+      {
+          continue;
+      }
+
+      lateness = metrics->completionTime - metrics->deadline;
+
+      if( lateness > DEADLINE_TOLERANCE )
+      {
+          totalLateness += lateness;
+
+          if( missCount == 0 || lateness > maxLateness )
+          {
+              maxLateness = lateness;
+          }
+
+          missCount++;
+      }
+      else
+      {
+          slack = lateness < 0 ? -lateness : 0;
+          totalSlack += slack;
+
+          if( deadlineCount == missCount || slack < minSlack )
+          {
+              minSlack = slack;
+          }
+      }
+
+      deadlineCount++;
+  }
+
+  if( deadlineCount == 0 )
+  {
+      return;
+  }
+
+  logLine( context, "\nDeadlines (%d processes)\n", deadlineCount );
+  logLine( context, "=================================\n" );
+  logLine( context, "%-17s %12d\n", "Met", deadlineCount - missCount );
+  logLine( context, "%-17s %12d\n", "Missed", missCount );
+  logLine( context, "%-17s %11.2lf%%\n", "Miss Rate",
+           (double) missCount / deadlineCount * 100 );
+
+  if( missCount > 0 )
+  {
+      logLine( context, "%-17s %12.3lf mSec\n", "Mean Lateness",
+               totalLateness / missCount );
+      logLine( context, "%-17s %12.3lf mSec\n", "Max Lateness",
+               maxLateness );
+  }
+
+  if( missCount < deadlineCount )
+  {
+      logLine( context, "%-17s %12.3lf mSec\n", "Mean Slack",
+               totalSlack / ( deadlineCount - missCount ) );
+      logLine( context, "%-17s %12.3lf mSec\n", "Min Slack", minSlack );
+  }
+}
+//
+// logDeviceMetrics Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function logs the request queue of each I/O device of a run
+ *
+ * @details This function logs the I/O ops every device served, the mean
+ *          and longest msec they waited for a channel, the mean and peak
+ *          number of ops waiting and the share of the channel time that was
+ *          busy. A device without a channel count shows the busy time of
+ *          all its ops over the run instead, which can be over 100%.
+ *
+ * @par Algorithm
+ *      The mean number of ops waiting is the total wait over the run time,
+ *      as each op adds one waiting op for the time it waits.
+ *
+ * @pre context a pointer to the SimContext of a finished run with devices
+ *
+ * @post context remains unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return  Nothing to return (void)
+ */
+void logDeviceMetrics( SimContext *context )
+{
+  double totalTime = context->runSummary.totalTime;
+  double meanWait, meanDepth, utilization;
+  char channels[ 20 ];
+  Device *device;
+  int index;
+
+  logLine( context, "\nDevice Queues (%d devices)\n", DEVICE_COUNT );
+  logLine( context, "=================================\n" );
+  logLine( context, "%-12s %8s %8s %10s %10s %10s %10s %9s\n", "Device",
+           "Channels", "Ops", "Wait mSec", "Max mSec", "Mean Depth",
+           "Peak Depth", "Util %" );
+
+  for( index = 0; index < DEVICE_COUNT; index++ )
+  {
+      device = &context->devices->devices[ index ];
+      meanWait = 0;
+      meanDepth = 0;
+      utilization = 0;
+
+      if( device->requestCount > 0 )
+      {
+          meanWait = device->totalWait / device->requestCount;
+      }
+
+      if( totalTime > 0 )
+      {
+          meanDepth = device->totalWait / totalTime;
+          utilization = device->busyTime / totalTime * 100;
+
+          if( device->channels > 0 )
+          {
+              utilization /= device->channels;
+          }
+      }
+
+      sprintf( channels, "%d", device->channels );
+
+      logLine( context, "%-12s %8s %8d %10.3lf %10.3lf %10.3lf %10d %8.2lf%%\n",
+               deviceNameLookUp[ index ],
+               device->channels > 0 ? channels : "-",
+               device->requestCount, meanWait, device->maxWait, meanDepth,
+               device->peakDepth, utilization );
+  }
+}
+//
+// logBurstPrediction Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function logs how well the CPU bursts of a run were predicted
+ *
+ * @details This function logs the mean CPU burst next to the mean
+ *          prediction, the mean error of the predictions and their bias,
+ *          which is positive when bursts were predicted to be longer than
+ *          they were.
+ *
+ * @pre context a pointer to the SimContext of a finished run
+ *
+ * @post context remains unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return  Nothing to return (void)
+ */
+void logBurstPrediction( SimContext *context )
+{
+  RunMetrics *runMetrics = &context->runMetrics;
+  int burstCount = runMetrics->burstCount > 0 ? runMetrics->burstCount : 1;
+
+  logLine( context, "\nBurst Prediction (%d bursts, alpha %d%%)\n",
+           runMetrics->burstCount, context->cfData->burstAlpha );
+  logLine( context, "=================================\n" );
+  logLine( context, "%-17s %12.3lf mSec\n", "Mean Burst",
+           runMetrics->burstTime / burstCount );
+  logLine( context, "%-17s %12.3lf mSec\n", "Mean Predicted",
+           runMetrics->predictedTime / burstCount );
+  logLine( context, "%-17s %12.3lf mSec\n", "Mean Abs Error",
+           runMetrics->burstError / burstCount );
+  logLine( context, "%-17s %12.3lf mSec\n", "Bias",
+           ( runMetrics->predictedTime - runMetrics->burstTime )
+           / burstCount );
+}
+//
+// dumpCounters Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes the runtime counters of a run to stderr
+ *
+ * @details This function writes the counters to stderr and not through
+ *          logLine, so that dumping them leaves the log of the run as it was.
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @post context remains unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return  Nothing to return (void)
+ */
+void dumpCounters( SimContext *context )
+{
+    writeCounters( &context->counters, stderr,
+                   getTimerAccessCount( &context->timer ) );
+}
+//
+// checkCounterDump Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function dumps the runtime counters if SIGUSR1 asked for it
+ *
+ * @details This function is called by the processing thread wherever it
+ *          changes the state of a process or waits, so a long run answers
+ *          a signal within a step.
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return  Nothing to return (void)
+ */
+void checkCounterDump( SimContext *context )
+{
+    if( checkCounterDumpRequest( &context->counters ) == True )
+    {
+        dumpCounters( context );
+    }
+}
+//
+// traceProcessState Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function traces the state a PCB is leaving
+ *
+ * @details This function writes the time a PCB spent Ready, Blocked or
+ *          Running as a slice on its process track. Running slices are
+ *          also written on the core track, and an exit is marked on the
+ *          process track.
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre currentPCB a pointer to a PCB already set in its new state, whose
+ *                 metrics still hold the start of its old state
+ *
+ * @post currentPCB and context remain unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] currentPCB a pointer to a PCB struct
+ *
+ * @param[in] oldState the state the PCB was in
+ *
+ * @param[in] time the simulated time of the change in sec
+ *
+ * @return  Nothing to return (void)
+ */
+void traceProcessState( SimContext *context,
+                        PCB *currentPCB,
+                        STATE oldState,
+                        double time )
+{
+  char processName[ 30 ];
+  double stateStart = currentPCB->metrics.stateTime / 1000;
+  TraceWriter *trace = &context->trace;
+
+  if( checkTracing( trace ) == False )
+  {
+      return;
+  }
+
+  if( oldState == READY )
+  {
+      traceSlice( trace, TRACE_PROCESS_PID, currentPCB->processNum,
+                  "Ready", "ready", stateStart, time );
+  }
+  else if( oldState == BLOCKED )
+  {
+      traceSlice( trace, TRACE_PROCESS_PID, currentPCB->processNum,
+                  "Blocked", "blocked", stateStart, time );
+  }
+  else if( oldState == RUNNING )
+  {
+      sprintf( processName, "Process %d", currentPCB->processNum );
+
+      traceSlice( trace, TRACE_PROCESS_PID, currentPCB->processNum,
+                  "Running", "running", stateStart, time );
+      traceSlice( trace, TRACE_CPU_PID, TRACE_CORE_TID,
+                  processName, "running", stateStart, time );
+  }
+
+  if( currentPCB->state == EXIT )
+  {
+      traceInstant( trace, TRACE_PROCESS_PID, currentPCB->processNum,
+                    "Exit", "exit", time );
+  }
+}
+//
+// traceDeviceSlice Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function traces an I/O op on the track of its device
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre currentPCB a pointer to the PCB that ran the op
+ *
+ * @post currentPCB remains unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] currentPCB a pointer to a PCB struct
+ *
+ * @param[in] opString a pointer to the device name of the op
+ *
+ * @param[in] opPrint a pointer to "input" or "output"
+ *
+ * @param[in] endTime the simulated time the op ended in sec
+ *
+ * @param[in] runTime the length of the op in msec
+ *
+ * @return  Nothing to return (void)
+ */
+void traceDeviceSlice( SimContext *context,
+                       PCB *currentPCB,
+                       char *opString,
+                       char *opPrint,
+                       double endTime,
+                       int runTime )
+{
+  char sliceName[ 100 ];
+  int device;
+
+  if( checkTracing( &context->trace ) == False )
+  {
+      return;
+  }
+
+  device = getTraceDeviceTrack( &context->trace, opString );
+  sprintf( sliceName, "Process %d %s", currentPCB->processNum, opPrint );
+
+  traceSlice( &context->trace, TRACE_DEVICE_PID, device, sliceName, "io",
+              endTime - runTime / 1000.0, endTime );
+}
+//
+// checkPcbCreation Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if the PCBs built correctly
+ *
+ * @details This function checks if the return from buildPcbList function resulted
+ *          in an error or was successful
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre pcbCode the value of a buildPcbList return
+ *
+ * @post context and pcbCode remain unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] pcbCode the value of a buildPcbList return
+ *
+ * @return  Nothing to return (void)
+ */
+void checkPcbCreation( SimContext *context, int pcbCode)
+{
+  switch ( pcbCode ) {
+    case 0:
+      break;
+
+    case 1:
+      logLine( context,
+               "No S(start) command at the beginning of metadata.\n" );
+      break;
+
+    case 2:
+      logLine( context,
+               "Not S(end) command at the end of metadata.\n" );
+      break;
+
+    case 3:
+      logLine( context,
+               "Seen two A(start)/T(start) commands without seeing an end.\n" );
+      break;
+
+    case 4:
+      logLine( context,
+               "Seen an A(end)/T(end) command without a matching start.\n" );
+      break;
+
+    case 5:
+      logLine( context,
+               "Seen an A(start) command with no associated A(end).\n" );
+      break;
+
+    case 6:
+      logLine( context,
+               "No A(start) or T(start) processes found in metadata.\n" );
+      break;
+
+    case 7:
+      logLine( context,
+               "Unbalanced, empty or too deeply nested R(count) block.\n" );
+      break;
+  }
+}
+//
+// displayProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function displays a PCB struct
+ *
+ * @details This function displays a the process number, state, and the
+ *          current MetaNode associated with a given PCB struct
+ *
+ * @pre currentPCB a pointer to a PCB struct
+ *
+ * @post currentPCB remains unchanged at post
+ *
+ * @param[in] currentPCB a pointer to a PCB struct
+ *
+ * @return Nothing to return (void)
+ */
+void displayProcess(PCB *currentPCB)
+{
+  if( currentPCB != NULL )
+  {
+    printf( "Process number: %d\n", currentPCB->processNum );
+
+    printf( "Process time: %d\n", currentPCB->processTime );
+
+    switch( currentPCB->state ) {
+      case 0:
+        printf( "Process state: NEW\n" );
+        break;
+
+      case 1:
+        printf( "Process state: READY\n" );
+        break;
+
+      case 2:
+        printf( "Process state: BLOCKED\n" );
+        break;
+
+      case 3:
+        printf( "Process state: EXIT\n" );
+        break;
+
+      case 4:
+        printf( "Process state: RUNNING\n" );
+        break;
+    }
+
+    displayNode( currentPCB->startNode );
+  }
+  else
+  {
+    printf( "PROCESS IS NULL\n" );
+  }
+}
+//
+// logLine Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function logs a given string
+ *
+ * @details This function logs a given string to either a StringNode linked list
+ *          to be logged to a file later, or prints directly to the monitor
+ *          during process execution. If the context has a log sink, the
+ *          string is only given to the sink.
+ *
+ * @pre context a pointer to a SimContext struct
+ *
+ * @pre format a pointer to a string with formating characters (%s, %d, etc.)
+ *
+ * @pre ... a list of variable arguments to use in the function
+ *
+ * @post format, ..., and context remain unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] format a pointer to a string with formating characters (%s, %d, etc.)
+ *
+ * @param[in] ... a list of variable arguments to use in the function
+ *
+ * @return Nothing to return (void)
+ */
+void logLine( SimContext *context, char* format, ... )
+{
+    char *outputBuffer = malloc(sizeof(char *) * 200);
+    int lineLength;
+
+    va_list argptr;
+    va_start( argptr, format );
+    lineLength = vsprintf( outputBuffer, format, argptr );
+    va_end( argptr );
+
+    countEvent( &context->counters, LOG_LINE_COUNTER, 1 );
+    countEvent( &context->counters, LOG_BYTE_COUNTER, lineLength );
+
+    if( context->logSink != NULL )
+    {
+        context->logSink( outputBuffer, context->logUserData );
+        free( outputBuffer );
+        return;
+    }
+
+    if( stringCmp( context->cfData->logTo, "Monitor" ) == True
+     || stringCmp( context->cfData->logTo, "Both" ) == True )
+    {
+        printf( "%s", outputBuffer );
+    }
+
+    if( stringCmp( context->cfData->logTo, "File" ) == True
+     || stringCmp( context->cfData->logTo, "Both" ) == True )
+    {
+        pthread_mutex_lock(&context->stringMutex);
+
+        if( context->logNode->string == NULL )
+        {
+            context->logNode->string = outputBuffer;
+            pthread_mutex_unlock(&context->stringMutex);
+            return;
+        }
+
+        StringNode *newNode = malloc( sizeof( *newNode ) );
+        newNode->string = outputBuffer;
+        newNode->nextNode = NULL;
+        addStringNode( context->logNode, newNode );
 
+        pthread_mutex_unlock(&context->stringMutex);
+    }
+    else
+    {
+        free( outputBuffer );
     }
-
-    return executionCode;
 }
 //
-// executeOp Function Implementation ///////////////////////////////////
+// createPCB Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function executes a MetaNode struct
+ * @brief This function creates a new PCB
  *
- * @details This function executes all MetaNode structs that contain either
- *          memory allocation operations or process operations by running a timer
- *          for a number of miliseconds.
+ * @details This function allocates memory for a PCB, initializes all values
+ *          and then return said PCB.
  *
- * @pre currentNode a pointer to the MetaNode struct being processed
+ * @return new pointer to a process control block struct (PCB *)
+ */
+PCB *createPCB()
+{
+    PCB *newProcess = malloc( sizeof( *newProcess ) );
+    newProcess->processNum = 0;
+    newProcess->processTime = 0;
+    newProcess->arrivalTime = 0;
+    newProcess->remainingCycles = -1;
+    newProcess->startNode = NULL;
+    newProcess->loopStack = NULL;
+    newProcess->loopDepth = 0;
+    newProcess->image = NULL;
+    initProcessMetrics( &newProcess->metrics, 0, 0 );
+    newProcess->mlfqLevel = 0;
+    newProcess->mlfqEpoch = 0;
+    newProcess->nextQueued = NULL;
+    newProcess->nice = 0;
+    newProcess->vruntime = 0;
+    newProcess->treeParent = NULL;
+    newProcess->treeLeft = NULL;
+    newProcess->treeRight = NULL;
+    newProcess->treeRed = False;
+    newProcess->tickets = DEFAULT_TICKETS;
+    newProcess->pass = 0;
+    newProcess->shareMark = 0;
+    newProcess->period = 0;
+    newProcess->deadline = -1;
+    newProcess->burstTau = 0;
+    newProcess->burstTime = 0;
+    newProcess->quantumLeft = 0;
+    newProcess->agingKey = 0;
+    newProcess->cacheMark = -1;
+    newProcess->nextProcess = NULL;
+    newProcess->state = NEW;
+
+    return newProcess;
+}
+//
+// getFinalProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief Gets the last process in the system.
+ *
+ * @details This function runs until the end of the list and returns the final
+ *          PCB in the system. If the list is already a ring, the PCB before
+ *          the given one is returned.
  *
  * @pre currentProcess a pointer to a PCB struct
  *
- * @pre cfData a pointer to a ConfigData struct
+ * @post currentProcess remains unchanged at post
  *
- * @pre opPrint a pointer to a string
+ * @param[in] currentProcess a pointer to a PCB struct
  *
- * @pre startNode a pointer to the head of a StringNode linked list
+ * @return a pointer to a process control block (PCB *)
+ */
+PCB *getFinalProcess(PCB *currentProcess)
+{
+    PCB *headProcess = currentProcess;
+
+    while( currentProcess->nextProcess != NULL
+        && currentProcess->nextProcess != headProcess )
+    {
+        currentProcess = currentProcess->nextProcess;
+    }
+
+    return currentProcess;
+}
+//
+// checkState Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief Checks if all processes in the system are in a specified state.
  *
- * @post currentNode, currentProcess, startNode, opPrint, and cfData
- *       remain unchanged at post
+ * @details This function checks if all processes are in a given state ignoring
+ *          processes in the exit state unless looking to see if all processses
+ *          are in said state.
  *
- * @param[in] currentNode a pointer to a MetaNode struct
+ * @pre currentProcess a pointer to a PCB struct
  *
- * @param[in] currentProcess a pointer to a PCB struct
+ * @pre state a state defined in process.h
  *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @post currentProcess, and state remain unchanged at post
  *
- * @param[in] opPrint a pointer to a string
+ * @param[in] currentProcess a pointer to a PCB struct
  *
- * @param[in] startNode a pointer to a StringNode struct
+ * @param[in] state a code that defines a given state
  *
- * @return Nothing to return (void)
+ * @return True if all processes in state, False otherwise (Boolean)
  */
-int executeOp( MetaNode *currentNode,
-                PCB *currentProcess,
-                ConfigData *cfData,
-                char *opPrint,
-                StringNode *startNode )
+Boolean checkState( PCB *currentProcess, STATE state )
 {
-    int newCycleTime, runTime;
-    float time;
-    char *timeString = malloc( sizeof( char ) * 200 );
-
-    time = accessTimer( LAP_TIMER, timeString );
-    logLine( cfData, startNode,
-             "Time:%10.6lf, Process %d, %s start\n",
-             time, currentProcess->processNum, opPrint );
+    int numLoops = 0, initialProcess = currentProcess->processNum;
+    Boolean allExit = True;
 
-    if( checkPremptive( cfData ) )
+    while( True )
     {
-        newCycleTime  = currentNode->cycleTime - cfData->quantumTime;
-        if( newCycleTime < 0 )
-        {
-            runTime = currentNode->cycleTime * cfData->processorCycleTime;
-        }
-        else
+        if( currentProcess->processNum == initialProcess && numLoops > 0 )
         {
-            runTime = cfData->quantumTime * cfData->processorCycleTime;
+            return allExit;
         }
 
-        if( interuptQueueIterator > -1 )
+        if( currentProcess->state != state
+         && currentProcess->state != EXIT )
         {
-            // return of 3 means there is an interupt in the queue
-            return 3;
+            allExit = False;
         }
 
-        currentNode->cycleTime = newCycleTime;
-        currentProcess->processTime -= runTime;
-    }
-    else
-    {
-        runTime = getOpTime( currentNode,  cfData );
-        currentNode->cycleTime = 0;
+        currentProcess = currentProcess->nextProcess;
+        numLoops++;
     }
+}
+//
+// getPredictedTime Function Implementation ///////////////////////////////////
+//
 
-    runTimer( runTime );
-
-    time = accessTimer( LAP_TIMER, timeString );
-
-    if( currentNode->cycleTime > 0 )
-    {
-        logLine( cfData, startNode,
-                 "Time:%10.6lf, Process %d, quantum time out\n",
-                 time, currentProcess->processNum);
-
-        return 1;
-    }
-    else
+/**
+ * @brief This function gets the predicted time left in a CPU burst
+ *
+ * @param[in] currentPCB a pointer to a PCB struct
+ *
+ * @return the predicted burst less the time it has run, at least 0, in
+ *         msec (double)
+ */
+double getPredictedTime( PCB *currentPCB )
+{
+    if( currentPCB->burstTime >= currentPCB->burstTau )
     {
-        logLine( cfData, startNode,
-                 "Time:%10.6lf, Process %d, %s end\n",
-                 time, currentProcess->processNum, opPrint );
+        return 0;
     }
 
-    free( timeString );
-
-    return 0;
+    return currentPCB->burstTau - currentPCB->burstTime;
 }
 //
-// executeOpIO Function Implementation ///////////////////////////////////
+// endCpuBurst Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function executes a MetaNode struct
+ * @brief This function ends the CPU burst of a process and predicts the next
  *
- * @details This function executes all MetaNode structs that contain input or
- *          output operations by running a timer on a pthread for a number of
- *          milliseconds.
+ * @details This function is called when a process starts an I/O op or
+ *          exits. The error of the prediction is added to the run metrics.
  *
- * @pre currentNode a pointer to the MetaNode struct being processed
+ * @par Algorithm
+ *      The next prediction is the exponential average
+ *      tau = alpha * burst + ( 1 - alpha ) * tau, so older bursts count for
+ *      less and less.
  *
- * @pre currentProcess a pointer to a PCB struct
+ * @pre context a pointer to a SimContext struct
  *
- * @pre cfData a pointer to a ConfigData struct
+ * @pre currentPCB a pointer to a PCB struct
  *
- * @pre opPrint a pointer to a string
+ * @post currentPCB holds the next prediction and no burst time at post
  *
- * @pre startNode a pointer to the head of a StringNode linked list
+ * @param[in] context a pointer to a SimContext struct
  *
- * @post currentNode, currentProcess, startNode, opPrint, and cfData
- *       remain unchanged at post
+ * @param[in,out] currentPCB a pointer to a PCB struct
  *
- * @param[in] currentNode a pointer to a MetaNode struct
+ * @return  Nothing to return (void)
+ */
+void endCpuBurst( SimContext *context, PCB *currentPCB )
+{
+    RunMetrics *runMetrics = &context->runMetrics;
+    double error = currentPCB->burstTau - currentPCB->burstTime;
+    int alpha = context->cfData->burstAlpha;
+
+    if( currentPCB->burstTime <= 0 )
+    {
+        return;
+    }
+
+    runMetrics->burstCount++;
+    runMetrics->burstTime += currentPCB->burstTime;
+    runMetrics->predictedTime += currentPCB->burstTau;
+    runMetrics->burstError += error < 0 ? -error : error;
+
+    currentPCB->burstTau = ( alpha * currentPCB->burstTime
+                           + ( 100 - alpha ) * currentPCB->burstTau ) / 100;
+    currentPCB->burstTime = 0;
+}
+//
+// freePcbList Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function deallocates a PCB linked list
  *
- * @param[in] currentProcess a pointer to a PCB struct
+ * @details This function deallocates a PCB linked list by iterating
+ *          over the nodes in the list and deallocating the appropriate fields
  *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @pre startProcess a pointer to a PCB struct. Ideally the head of the
+ *                   linked list
  *
- * @param[in] opPrint a pointer to a string
+ * @post startProcess is now a NULL pointer
  *
- * @param[in] startNode a pointer to a StringNode struct
+ * @param[in] startProcess a pointer to a StringNode struct
  *
  * @return Nothing to return (void)
  */
-int executeOpIO( MetaNode *currentNode,
-                  PCB *currentProcess,
-                  ConfigData *cfData,
-                  char *opPrint,
-                  StringNode *startNode )
+void freePcbList( PCB *startProcess )
 {
-    float time;
-    pthread_t thread;
-    void *timeInMilliSecPtr;
-    int rc1, timeInMilliSec;
-    char *timeString = malloc( sizeof( char ) * 200 );
+    PCB *currentProcess = NULL, *nextProcess = NULL;
 
-    time = accessTimer( LAP_TIMER, timeString );
-    logLine( cfData, startNode,
-             "Time:%10.6lf, Process %d, %s %s start\n",
-             time, currentProcess->processNum, currentNode->opString, opPrint );
+    if( startProcess == NULL )
+    {
+        return;
+    }
 
-    timeInMilliSec = getOpTime( currentNode, cfData );
-    timeInMilliSecPtr = &timeInMilliSec;
+    currentProcess = startProcess->nextProcess;
 
-    if( checkPremptive(cfData) == False )
+    // Handle preemptive processing, where the list has been made circular
+    while( currentProcess != NULL && currentProcess != startProcess )
     {
-        if( (rc1 = pthread_create( &thread, NULL, &runTimerIO, timeInMilliSecPtr)) )
-        {
-            logLine( cfData, startNode, "Thread creation failed\n" );
-            return 1;
-        }
+        nextProcess = currentProcess->nextProcess;
+        freePCB( currentProcess );
+        currentProcess = nextProcess;
+    }
 
-        pthread_join( thread, NULL );
+    freePCB( startProcess );
+}
+//
+// writeToLog Function Implementation ///////////////////////////////////
+//
 
-        time = accessTimer( LAP_TIMER, timeString );
+/**
+ * @brief This function writes a StringNode struct linked list to a file
+ *
+ * @details This function iterates over a StringNode struct linked list writing
+ *          each structs string value to a givem file
+ *
+ * @pre startNode a pointer to a StringNode struct. Ideally the head of the
+ *                linked list
+ *
+ * @pre filename a pointer to a string
+ *
+ * @post startNode is now a NULL pointer
+ *
+ * @post filename remains unchanged
+ *
+ * @param[in] startNode a pointer to a StringNode struct
+ *
+ * @param[in] filename a pointer to a string
+ *
+ * @return Nothing to return (void)
+ */
+void writeToLog( StringNode *startNode, char *filename )
+{
+    FILE *logFilePointer;
+    logFilePointer = fopen( filename, "w" );
 
-        logLine( cfData, startNode,
-                 "Time:%10.6lf, Process %d, %s %s end\n",
-                 time, currentProcess->processNum, currentNode->opString, opPrint );
+    while( startNode != NULL )
+    {
+        fprintf( logFilePointer, "%s", startNode->string );
+        startNode = startNode->nextNode;
+    }
 
-        free( timeString );
+    fclose( logFilePointer );
+}
+//
+// checkPremptive Function Implementation ///////////////////////////////////
+//
 
-        return 0;
+/**
+ * @brief This function processes a PCB linked list using a First Come First
+ *        Serve algorithm.
+ *
+ * @details This function processes a PCB linked list using a First Come First
+ *          Serve algorithm, where the first PCB to come in is the first PCB
+ *          that is processed by the system.
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @post cfData remains unchanged at post
+ *
+ * @param[in] cfData a pointer to a ConfigData struct
+ *
+ * @return True if the current setup is preemptive, False otherwise (Boolean)
+ */
+Boolean checkPremptive(ConfigData *cfData)
+{
+    if( stringCmp(cfData->cpuSchedCode, "SRTF-P")
+     || stringCmp(cfData->cpuSchedCode, "FCFS-P")
+     || stringCmp(cfData->cpuSchedCode, "RR-P")
+     || stringCmp(cfData->cpuSchedCode, "MLFQ-P")
+     || stringCmp(cfData->cpuSchedCode, "CFS-P")
+     || stringCmp(cfData->cpuSchedCode, "LOTTERY-P")
+     || stringCmp(cfData->cpuSchedCode, "STRIDE-P")
+     || stringCmp(cfData->cpuSchedCode, "EDF-P")
+     || stringCmp(cfData->cpuSchedCode, "RM-P"))
+    {
+        return True;
     }
     else
     {
-        Interupt *interupt = createInterupt( currentProcess,
-                                             timeInMilliSec,
-                                             currentNode->opString,
-                                             opPrint );
-
-        pthread_create( &thread, NULL, &controllerThread, (void *)interupt);
-
-        free( timeString );
-
-        return 4;
+        return False;
     }
 }
 //
-// executeOpMem Function Implementation ///////////////////////////////////
+// checkQuantumCarried Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function executes a MetaNode struct
+ * @brief This function checks if the quantum of the running process lasts
+ *        across its ops
  *
- * @details This function executes all MetaNode structs that contain memory
- *          operations by running a either an allocation or access operation
- *          using a memoryManagementUnit and a new memory segment
+ * @details Under these policies the quantum is given when a process is
+ *          picked and kept in quantumLeft, so a process with ops shorter
+ *          than its quantum is still switched out once it has run it all.
  *
- * @pre currentNode a pointer to the MetaNode struct being processed
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @return True for RR-P and the policies run by dispatchReadyQueue, False
+ *         otherwise (Boolean)
+ */
+Boolean checkQuantumCarried( SimContext *context )
+{
+    return stringCmp( context->cfData->cpuSchedCode, "RR-P" )
+        || context->readyOps != NULL;
+}
+//
+// expireQuantum Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function ends the turn of a process that used its quantum
  *
- * @pre currentProcess a pointer to a PCB struct
+ * @details This function logs the time out and gives it to the expire hook
+ *          of the policy, if it has one, before the process is made ready.
  *
- * @pre cfData a pointer to a ConfigData struct
+ * @param[in] context a pointer to a SimContext struct
  *
- * @pre memoryManagementUnit a pointer to a memoryManagementUnit
+ * @param[in,out] currentProcess a pointer to the running PCB
  *
- * @pre startNode a pointer to the head of a StringNode linked list
+ * @return nothing to return (void)
+ */
+void expireQuantum( SimContext *context, PCB *currentProcess )
+{
+    char timeString[ 300 ];
+
+    TRACE_OP( context,
+              "Time:%10.6lf, Process %d, quantum time out\n",
+              TRACE_TIME( context, timeString ),
+              currentProcess->processNum );
+    countEvent( &context->counters, QUANTUM_EXPIRED_COUNTER, 1 );
+
+    if( context->readyOps != NULL
+     && context->readyOps->expireProcess != NULL )
+    {
+        context->readyOps->expireProcess( context, currentProcess );
+    }
+}
+//
+// getRoundRobinQuantum Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the RR-P quantum of a process being dispatched
  *
- * @post currentNode, currentProcess, startNode, memoryManagementUnit,
- *       and cfData remain unchanged at post
+ * @details With a fixed quantum every process gets the Quantum Time. With
+ *          an adaptive one a process gets enough cycles to finish its
+ *          predicted CPU burst, so CPU bound processes are switched out
+ *          less often, but never less than the Quantum Time, so short
+ *          bursts are served as before.
  *
- * @param[in] currentNode a pointer to a MetaNode struct
+ * @par Algorithm
+ *      The longest quantum is the RR Target Latency shared between the
+ *      ready processes, so a process that becomes ready waits about that
+ *      long at most, or RR_ADAPTIVE_MAX_SCALE Quantum Times without one.
+ *      The ready count is kept by the live stats on every state change.
  *
- * @param[in] currentProcess a pointer to a PCB struct
+ * @pre context a pointer to a SimContext struct
  *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @pre currentPCB a pointer to a PCB in the Ready state
  *
- * @param[in] memoryManagementUnit a pointer to a memoryManagementUnit
+ * @param[in] context a pointer to a SimContext struct
  *
- * @param[in] startNode a pointer to a StringNode struct
+ * @param[in] currentPCB a pointer to a PCB struct
  *
- * @return  Code for execution status (int)
+ * @return the quantum in cycles (int)
  */
-int executeOpMem( MetaNode *currentNode,
-                  PCB *currentProcess,
-                  ConfigData *cfData,
-                  StringNode *startNode,
-                  MMU *memoryManagementUnit )
+int getRoundRobinQuantum( SimContext *context, PCB *currentPCB )
 {
-  float time;
-  int memoryOpCode = 0;
-  char *timeString = malloc( sizeof( char ) * 200 );
-  char *operation = NULL, *memoryOpStatus = "Success";
-  Memory *memory = NULL;
+    ConfigData *cfData = context->cfData;
+    int quantum, longest, readyCount;
 
-  if( stringCmp(currentNode->opString, "access") == True )
-  {
-      operation = "MMU Access:";
-  }
-  else if( stringCmp(currentNode->opString, "allocate") == True )
-  {
-      operation = "MMU Allocation:";
-  }
+    if( cfData->rrAdaptive == False )
+    {
+        return cfData->quantumTime;
+    }
 
-  memory = malloc( sizeof( *memory ) );
-  createMemory(currentNode, memory, currentProcess->processNum);
+    quantum = (int) ( currentPCB->burstTau / cfData->processorCycleTime );
 
-  time = accessTimer( LAP_TIMER, timeString );
-  logLine( cfData, startNode,
-           "Time:%10.6lf, Process %d, %s %d/%d/%d\n",
-           time, currentProcess->processNum, operation,
-           memory->segment, memory->startPosition, memory->offset);
+    if( quantum * cfData->processorCycleTime < currentPCB->burstTau )
+    {
+        quantum++;
+    }
 
-  if( stringCmp(currentNode->opString, "access") == True )
-  {
-      memoryOpCode = access( memoryManagementUnit, memory );
-  }
-  else if( stringCmp(currentNode->opString, "allocate") == True )
-  {
-      memoryOpCode = allocate( memoryManagementUnit, memory );
-  }
+    longest = cfData->quantumTime * RR_ADAPTIVE_MAX_SCALE;
 
-  if( memoryOpCode != 0 )
-  {
-      memoryOpStatus = "Failed";
-      free( memory );
-  }
-  else if( stringCmp(currentNode->opString, "access") == True )
-  {
-      free( memory );
-  }
+    if( cfData->rrTargetLatency > 0 )
+    {
+        readyCount = context->liveStats.stateCounts[ READY ];
+        longest = cfData->rrTargetLatency
+                / ( cfData->processorCycleTime
+                  * ( readyCount > 0 ? readyCount : 1 ) );
+    }
 
-  time = accessTimer( LAP_TIMER, timeString );
-  logLine( cfData, startNode,
-           "Time:%10.6lf, Process %d, %s %s\n",
-           time, currentProcess->processNum, operation, memoryOpStatus );
+    if( quantum > longest )
+    {
+        quantum = longest;
+    }
 
-  free( timeString );
+    if( quantum < cfData->quantumTime )
+    {
+        quantum = cfData->quantumTime;
+    }
 
-  return memoryOpCode;
+    return quantum;
 }
 //
-// getOpTime Function Implementation ///////////////////////////////////
+// checkBurstTracking Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function estimates the run time in milliseconds for a given
- *        MetaNode
+ * @brief This function checks if the CPU bursts of processes are tracked
  *
- * @details This function estimates the run time in milliseconds for a given MetaNode
- *          by multiplying the ioCycleTime by the MetaNodes cycleTime for I/O
- *          operations or by multiplying the processorCycleTime by the MetaNode
- *          cycleTime which is then returned
+ * @param[in] cfData a pointer to a ConfigData struct
  *
- * @pre currentNode a pointer to the MetaNode struct being estimated
+ * @return True if bursts are predicted or size adaptive RR-P quanta,
+ *         False otherwise (Boolean)
+ */
+Boolean checkBurstTracking( ConfigData *cfData )
+{
+    if( cfData->burstPrediction == True || cfData->rrAdaptive == True )
+    {
+        return True;
+    }
+
+    return False;
+}
+//
+// checkProcessEnd Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if a MetaNode ends a process.
  *
- * @pre cfData a pointer to a ConfigData struct
+ * @details This function checks if the given MetaNode is the A(end) command
+ *          of a process or the T(end) command of a process template.
  *
- * @post currentNode, and cfData remain unchanged at post
+ * @pre currentNode a pointer to a MetaNode struct
  *
- * @param[in] currentNode a pointer to a MetaNode struct
+ * @post currentNode remains unchanged at post
  *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @param[in] currentNode a pointer to a MetaNode struct
  *
- * @return the estimated time of a MetaNode operation runtime in
- *         milliseconds (int)
+ * @return True if the node ends a process, False otherwise (Boolean)
  */
-int getOpTime( MetaNode *currentNode, ConfigData *cfData )
+Boolean checkProcessEnd( MetaNode *currentNode )
 {
-    int runTime = 0;
-
-    switch ( currentNode->commandLetter )
+    if( ( currentNode->commandLetter == 'A'
+       || currentNode->commandLetter == 'T' )
+     && stringCmp( currentNode->opString, "end" ) == True )
     {
-      case 'I':
-      case 'O':
-        runTime = cfData->ioCycleTime * currentNode->cycleTime;
-        break;
-
-      case 'S':
-      case 'A':
-      case 'P':
-        runTime = cfData->processorCycleTime * currentNode->cycleTime;
-        break;
-
-      case 'M':
-        runTime = 0;
-        break;
+        return True;
     }
 
-    return runTime;
+    return False;
 }
 //
-// setState Function Implementation ///////////////////////////////////
+// resolveLoopNodes Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function sets the state of a given PCB to the given state
+ * @brief This function moves a PCB cursor past any repeat block nodes.
  *
- * @details This function sets the state of a given PCB to the given state where
- *          the state is defined in the STATE enumeration
+ * @details This function lazily expands R(count){ ... } blocks as a process
+ *          runs. Starting from the given node it walks over R(start) and
+ *          R(end) nodes, updating the loop stack of the PCB, and returns the
+ *          first node that is an actual operation (or the end of the process).
  *
- * @pre currentPCB a pointer to a PCB struct
+ * @par Algorithm
+ *      An R(start) node pushes a frame holding the first node of the body and
+ *      the number of repeats left after the current pass.
  *
- * @pre state a state value defined in the STATE enum
+ * @par Algorithm
+ *      An R(end) node either jumps back to the body of the innermost frame
+ *      or, once no repeats are left, pops that frame and moves on. Only the
+ *      frame stack is stored, so a block repeated any number of times takes
+ *      the same memory.
  *
- * @post currentPCB has its state set to the state variable
+ * @pre currentProcess a pointer to a PCB struct
  *
- * @post cfData remains unchanged at post
+ * @pre currentNode a pointer to a MetaNode in the process op list
  *
- * @param[in] currentPCB a pointer to a PCB struct
+ * @post currentProcess has its loop stack updated at post
  *
- * @param[in] state a state value
+ * @param[in] currentProcess a pointer to a PCB struct
  *
- * @return  Nothing to return (void)
+ * @param[in] currentNode a pointer to a MetaNode struct
+ *
+ * @return the next operation node for the process (MetaNode *)
  */
-void setState( ConfigData *cfData, StringNode *startNode, PCB *currentPCB, STATE state )
+MetaNode *resolveLoopNodes( PCB *currentProcess, MetaNode *currentNode )
 {
-  currentPCB->state = state;
-  char timeString[300], currentState[10];
-  float time;
-
-  time = accessTimer( LAP_TIMER, timeString );
-
-  switch( currentPCB->state ) {
-    case 0:
-      sprintf(currentState, "New");
-      break;
-
-    case 1:
-      sprintf(currentState, "Ready");
-      break;
+    LoopFrame *frame = NULL;
 
-    case 2:
-      sprintf(currentState, "Blocked");
-      break;
+    while( currentNode->commandLetter == 'R' )
+    {
+        if( stringCmp( currentNode->opString, "start" ) == True )
+        {
+            frame = &currentProcess->loopStack[ currentProcess->loopDepth ];
+            frame->bodyNode = currentNode->nextNode;
+            frame->repeatsLeft = currentNode->cycleTime - 1;
+            currentProcess->loopDepth++;
 
-    case 3:
-      sprintf(currentState, "Exit");
-      break;
+            currentNode = currentNode->nextNode;
+        }
+        else
+        {
+            frame = &currentProcess->loopStack[ currentProcess->loopDepth - 1 ];
 
-    case 4:
-      sprintf(currentState, "Running");
-      break;
-  }
+            if( frame->repeatsLeft > 0 )
+            {
+                frame->repeatsLeft--;
+                currentNode = frame->bodyNode;
+            }
+            else
+            {
+                currentProcess->loopDepth--;
+                currentNode = currentNode->nextNode;
+            }
+        }
+    }
 
-  logLine( cfData, startNode,
-           "Time:%10.6lf, OS: Process %d set in %s state\n",
-           time, currentPCB->processNum, currentState);
+    return currentNode;
 }
-
 //
-// setStateRecursive Function Implementation ///////////////////////////////////
+// admitArrivals Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function sets the state of a given PCB linked list to the given
- *        state recruvisely
+ * @brief This function admits every process whose arrival time has passed
  *
- * @details This function sets the state of a all PCBs in a linked list to the
- *          given state where the state is defined in the STATE enumeration
+ * @details This function moves processes from the New state to the Ready
+ *          state once simulated time reaches their arrival time. When the
+ *          workload is streamed, the PCBs are created here from the next
+ *          blocks of the MetaStream and exited PCBs are freed.
  *
- * @pre currentPCB a pointer to a PCB struct
+ * @par Algorithm
+ *      The next arrival time is cached, so when nothing is due the check
+ *      costs a single timer lap.
  *
- * @pre state a state value defined in the STATE enum
+ * @pre context a pointer to a SimContext struct
  *
- * @post currentPCB has its state set to the state variable
+ * @pre headProcess a pointer to the head of the PCB list or ring
  *
- * @post cfData remains unchanged at post
+ * @pre keepProcess a PCB that must not be freed, or NULL
  *
- * @param[in] currentPCB a pointer to a PCB struct
+ * @post arrived PCBs are in the Ready state at post
  *
- * @param[in] state a state value
+ * @param[in] context a pointer to a SimContext struct
  *
- * @return  Nothing to return (void)
+ * @param[in] headProcess a pointer to a PCB struct
+ *
+ * @param[in] keepProcess a pointer to a PCB struct
+ *
+ * @return the number of processes admitted (int)
  */
-void setStateRecursive( PCB *currentPCB, STATE state )
+int admitArrivals( SimContext *context,
+                   PCB *headProcess,
+                   PCB *keepProcess )
 {
-  while( currentPCB != NULL )
-  {
-    currentPCB->state = state;
-    currentPCB = currentPCB->nextProcess;
-  }
+    char timeString[ 300 ];
+    int admitted = 0;
+    double time;
+    PCB *currentProcess = headProcess;
+
+    if( context->workload.stream != NULL
+     && context->workload.exitedProcesses > 0 )
+    {
+        reapExitedProcesses( context, headProcess, keepProcess );
+    }
+
+    if( context->workload.nextArrival == INT_MAX )
+    {
+        return 0;
+    }
+
+    time = accessTimer( &context->timer, LAP_TIMER, timeString ) * 1000;
+
+    if( time < context->workload.nextArrival )
+    {
+        return 0;
+    }
+
+    if( context->workload.stream != NULL )
+    {
+        while( context->workload.stream->pendingBlock != NULL
+            && context->workload.stream->pendingBlock->arrivalTime <= time )
+        {
+            admitted += admitStreamBlock( context );
+        }
+
+        if( context->workload.stream->failed == True
+         && context->workload.streamError == False )
+        {
+            logLine( context,
+                     "Time:%10.6lf, OS: Bad process in metadata stream, " \
+                     "no further processes admitted\n",
+                     accessTimer( &context->timer, LAP_TIMER, timeString ) );
+            context->workload.streamError = True;
+        }
+    }
+
+    if( context->workload.stream == NULL
+     || context->workload.heldProcesses > 0 )
+    {
+        do
+        {
+            if( currentProcess->state == NEW
+             && currentProcess->arrivalTime <= time )
+            {
+                setState( context, currentProcess, READY );
+                admitted++;
+
+                if( context->workload.stream != NULL )
+                {
+                    context->workload.heldProcesses--;
+                }
+            }
+
+            currentProcess = currentProcess->nextProcess;
+        }
+        while( currentProcess != NULL && currentProcess != headProcess );
+    }
+
+    context->workload.nextArrival = getNextArrival( context, headProcess );
+    return admitted;
 }
 //
-// checkPcbCreation Function Implementation ///////////////////////////////////
+// admitStreamBlock Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function checks if the PCBs built correctly
+ * @brief This function admits the pending block of a streamed workload
  *
- * @details This function checks if the return from buildPcbList function resulted
- *          in an error or was successful
- *
- * @pre cfData a pointer to a ConfigData struct
+ * @details This function takes the pending process block from the
+ *          MetaStream, creates its PCBs at the end of the ring and sets them
+ *          in the Ready state, then reads ahead the next block. Instances
+ *          of a periodic template that are not due yet are held in the New
+ *          state for admitArrivals to release.
  *
- * @pre startNode a pointer to a StringNode struct
+ * @pre context a pointer to a SimContext struct
  *
- * @pre pcbCode the value of a buildPcbList return
- *
- * @post cfData, startNode, and pcbCode remain unchanged at post
- *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @post the PCBs of the block are in the ring at post
  *
- * @param[in] startNode a pointer to a StringNode struct
+ * @exception badBlock
+ *            If the block fails the buildPcbList checks, the error is logged
+ *            and the stream is marked failed.
  *
- * @param[in] pcbCode the value of a buildPcbList return
+ * @param[in] context a pointer to a SimContext struct
  *
- * @return  Nothing to return (void)
+ * @return the number of processes admitted (int)
  */
-void checkPcbCreation( ConfigData *cfData, StringNode *startNode, int pcbCode)
+int admitStreamBlock( SimContext *context )
 {
-  switch ( pcbCode ) {
-    case 0:
-      break;
+    int processTime, maxLoopDepth, pcbCode, admitted = 0;
+    char timeString[ 300 ];
+    double time;
+    MetaNode *blockNode = context->workload.stream->pendingBlock;
+    MetaNode *endNode = NULL;
+    PCB *blockHead = NULL, *blockTail = NULL, *currentProcess = NULL;
+    ProcessImage *image = NULL;
 
-    case 1:
-      logLine( cfData, startNode,
-               "No S(start) command at the beginning of metadata.\n" );
-      break;
+    pcbCode = measurePcbBlock( blockNode,
+                               context->cfData,
+                               &processTime,
+                               &maxLoopDepth,
+                               &endNode );
 
-    case 2:
-      logLine( cfData, startNode,
-               "Not S(end) command at the end of metadata.\n" );
-      break;
+    if( pcbCode != 0 )
+    {
+        checkPcbCreation( context, pcbCode );
+        freeList( blockNode );
+        context->workload.stream->pendingBlock = NULL;
+        context->workload.stream->failed = True;
+        return 0;
+    }
 
-    case 3:
-      logLine( cfData, startNode,
-               "Seen two A(start) commands without seeing an A(end).\n" );
-      break;
+    readProcessBlock( context->workload.stream );
 
-    case 4:
-      logLine(cfData, startNode, "Seen two A(end) commands \
-                                  without seeing an A(start).\n");
-      break;
+    blockHead = createPcbBlock( context,
+                                blockNode,
+                                processTime,
+                                maxLoopDepth,
+                                &blockTail );
+
+    if( blockHead == NULL )
+    {
+        freeList( blockNode );
+        return 0;
+    }
+
+    image = malloc( sizeof( ProcessImage ) );
+    image->blockNode = blockNode;
+    image->users = 0;
+
+    for( currentProcess = blockHead;
+         currentProcess != NULL;
+         currentProcess = currentProcess->nextProcess )
+    {
+        currentProcess->image = image;
+        image->users++;
+    }
+
+    blockTail->nextProcess = context->workload.tailProcess->nextProcess;
+    context->workload.tailProcess->nextProcess = blockHead;
+    context->workload.tailProcess = blockTail;
+
+    currentProcess = blockHead;
+    time = accessTimer( &context->timer, LAP_TIMER, timeString ) * 1000;
+
+    do
+    {
+        if( currentProcess->arrivalTime <= time )
+        {
+            setState( context, currentProcess, READY );
+            admitted++;
+        }
+        else
+        {
+            context->workload.heldProcesses++;
+        }
+
+        currentProcess = currentProcess->nextProcess;
+    }
+    while( currentProcess != blockTail->nextProcess );
 
-    case 5:
-      logLine( cfData, startNode,
-               "Seen an A(start) command with no associated A(end).\n" );
-      break;
-  }
+    return admitted;
 }
 //
-// displayProcess Function Implementation ///////////////////////////////////
+// getNextArrival Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function displays a PCB struct
+ * @brief This function finds the next time a process will arrive
  *
- * @details This function displays a the process number, state, and the
- *          current MetaNode associated with a given PCB struct
+ * @details This function returns the arrival time of the pending stream
+ *          block, or the earliest arrival time of any PCB still in the New
+ *          state.
  *
- * @pre currentPCB a pointer to a PCB struct
+ * @pre context a pointer to a SimContext struct
  *
- * @post currentPCB remains unchanged at post
+ * @pre headProcess a pointer to the head of the PCB list or ring
  *
- * @param[in] currentPCB a pointer to a PCB struct
+ * @post headProcess remains unchanged at post
  *
- * @return Nothing to return (void)
+ * @param[in] context a pointer to a SimContext struct
+ *
+ * @param[in] headProcess a pointer to a PCB struct
+ *
+ * @return the next arrival time in mSec, INT_MAX if there is none (double)
  */
-void displayProcess(PCB *currentPCB)
+double getNextArrival( SimContext *context, PCB *headProcess )
 {
-  if( currentPCB != NULL )
-  {
-    printf( "Process number: %d\n", currentPCB->processNum );
-
-    printf( "Process time: %d\n", currentPCB->processTime );
-
-    switch( currentPCB->state ) {
-      case 0:
-        printf( "Process state: NEW\n" );
-        break;
+    double nextArrival = INT_MAX;
+    PCB *currentProcess = headProcess;
 
-      case 1:
-        printf( "Process state: READY\n" );
-        break;
+    if( context->workload.stream != NULL )
+    {
+        if( context->workload.stream->pendingBlock != NULL )
+        {
+            nextArrival = context->workload.stream->pendingBlock->arrivalTime;
+        }
 
-      case 2:
-        printf( "Process state: BLOCKED\n" );
-        break;
+        if( context->workload.heldProcesses == 0 )
+        {
+            return nextArrival;
+        }
+    }
 
-      case 3:
-        printf( "Process state: EXIT\n" );
-        break;
+    do
+    {
+        if( currentProcess->state == NEW
+         && currentProcess->arrivalTime < nextArrival )
+        {
+            nextArrival = currentProcess->arrivalTime;
+        }
 
-      case 4:
-        printf( "Process state: RUNNING\n" );
-        break;
+        currentProcess = currentProcess->nextProcess;
     }
+    while( currentProcess != NULL && currentProcess != headProcess );
 
-    displayNode( currentPCB->startNode );
-  }
-  else
-  {
-    printf( "PROCESS IS NULL\n" );
-  }
+    return nextArrival;
 }
 //
-// logLine Function Implementation ///////////////////////////////////
+// reapExitedProcesses Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function logs a given string
- *
- * @details This function logs a given string to either a StringNode linked list
- *          to be logged to a file later, or prints directly to the monitor
- *          during process execution
- *
- * @pre cfData a pointer to a ConfigData struct
+ * @brief This function frees exited PCBs of a streamed workload
  *
- * @pre startNode a pointer to the head of a StringNode linked list
+ * @details This function unlinks and frees every PCB in the Exit state
+ *          from the ring, so memory only grows with the processes that are
+ *          still live.
  *
- * @pre format a pointer to a string with formating characters (%s, %d, etc.)
+ * @pre context a pointer to a SimContext struct
  *
- * @pre ... a list of variable arguments to use in the function
+ * @pre headProcess a pointer to the placeholder head of the ring
  *
- * @post startNode, format, ..., and cfData remain unchanged at post
+ * @pre keepProcess a PCB a scheduler still points at, or NULL
  *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @post only the head, keepProcess and live PCBs are left in the ring
  *
- * @param[in] startNode a pointer to a StringNode struct
+ * @param[in] context a pointer to a SimContext struct
  *
- * @param[in] format a pointer to a string with formating characters (%s, %d, etc.)
+ * @param[in] headProcess a pointer to a PCB struct
  *
- * @param[in] ... a list of variable arguments to use in the function
+ * @param[in] keepProcess a pointer to a PCB struct
  *
  * @return Nothing to return (void)
  */
-void logLine( ConfigData *cfData, StringNode *startNode, char* format, ... )
+void reapExitedProcesses( SimContext *context,
+                          PCB *headProcess,
+                          PCB *keepProcess )
 {
-    char *outputBuffer = malloc(sizeof(char *) * 200);
-
-    va_list argptr;
-    va_start( argptr, format );
-    vsprintf( outputBuffer, format, argptr );
-    va_end( argptr );
+    PCB *previousProcess = headProcess;
+    PCB *currentProcess = headProcess->nextProcess;
 
-    if( stringCmp( cfData->logTo, "Monitor" ) == True
-     || stringCmp( cfData->logTo, "Both" ) == True )
+    while( currentProcess != headProcess )
     {
-        printf( "%s", outputBuffer );
-    }
+        if( currentProcess->state == EXIT && currentProcess != keepProcess )
+        {
+            previousProcess->nextProcess = currentProcess->nextProcess;
 
-    if( stringCmp( cfData->logTo, "File" ) == True
-     || stringCmp( cfData->logTo, "Both" ) == True )
-    {
-        pthread_mutex_lock(&stringMutex);
+            if( currentProcess == context->workload.tailProcess )
+            {
+                context->workload.tailProcess = previousProcess;
+            }
 
-        if( startNode->string == NULL )
+            freePCB( currentProcess );
+            context->workload.exitedProcesses--;
+        }
+        else
         {
-            startNode->string = outputBuffer;
-            pthread_mutex_unlock(&stringMutex);
-            return;
+            previousProcess = currentProcess;
         }
 
-        StringNode *newNode = malloc( sizeof( *newNode ) );
-        newNode->string = outputBuffer;
-        newNode->nextNode = NULL;
-        addStringNode( startNode, newNode );
-
-        pthread_mutex_unlock(&stringMutex);
-    }
-    else
-    {
-        free( outputBuffer );
+        currentProcess = previousProcess->nextProcess;
     }
 }
 //
-// createPCB Function Implementation ///////////////////////////////////
-//
-
-/**
- * @brief This function creates a new PCB
- *
- * @details This function allocates memory for a PCB, initializes all values
- *          and then return said PCB.
- *
- * @return new pointer to a process control block struct (PCB *)
- */
-PCB *createPCB()
-{
-    PCB *newProcess = malloc( sizeof( *newProcess ) );
-    newProcess->processNum = 0;
-    newProcess->processTime = 0;
-    newProcess->startNode = NULL;
-    newProcess->nextProcess = NULL;
-    newProcess->state = NEW;
-
-    return newProcess;
-}
-//
-// getFinalProcess Function Implementation ///////////////////////////////////
+// freePCB Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief Gets the last process in the system.
+ * @brief This function deallocates a single PCB
  *
- * @details This function runs until the end of the list and returns the final
- *          PCB in the system.
+ * @details This function frees a PCB and its loop stack. If it was the last
+ *          PCB running a streamed process block, the block is freed too.
  *
  * @pre currentProcess a pointer to a PCB struct
  *
- * @post currentProcess remains unchanged at post
+ * @post currentProcess is freed at post
  *
  * @param[in] currentProcess a pointer to a PCB struct
  *
- * @return a pointer to a process control block (PCB *)
+ * @return Nothing to return (void)
  */
-PCB *getFinalProcess(PCB *currentProcess)
+void freePCB( PCB *currentProcess )
 {
-    while( currentProcess->nextProcess != NULL )
+    if( currentProcess->image != NULL )
     {
-        currentProcess = currentProcess->nextProcess;
+        currentProcess->image->users--;
+
+        if( currentProcess->image->users == 0 )
+        {
+            freeList( currentProcess->image->blockNode );
+            free( currentProcess->image );
+        }
     }
 
-    return currentProcess;
+    free( currentProcess->loopStack );
+    free( currentProcess );
 }
 //
-// checkState Function Implementation ///////////////////////////////////
+// checkIdle Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief Checks if all processes in the system are in a specified state.
+ * @brief This function checks if the CPU has nothing to run
  *
- * @details This function checks if all processes are in a given state ignoring
- *          processes in the exit state unless looking to see if all processses
- *          are in said state.
+ * @details This function checks that no process in the ring is in the
+ *          Ready state while some work is still left, either blocked on
+ *          I/O or yet to arrive.
  *
- * @pre currentProcess a pointer to a PCB struct
+ * @pre context a pointer to a SimContext struct
  *
- * @pre state a state defined in process.h
+ * @pre currentProcess a pointer to a PCB in a ring
  *
- * @post currentProcess, and state remain unchanged at post
+ * @post currentProcess remains unchanged at post
  *
- * @param[in] currentProcess a pointer to a PCB struct
+ * @param[in] context a pointer to a SimContext struct
  *
- * @param[in] state a code that defines a given state
+ * @param[in] currentProcess a pointer to a PCB struct
  *
- * @return True if all processes in state, False otherwise (Boolean)
+ * @return True if the CPU is idle, False otherwise (Boolean)
  */
-Boolean checkState( PCB *currentProcess, STATE state )
+Boolean checkIdle( SimContext *context, PCB *currentProcess )
 {
-    int numLoops = 0, initialProcess = currentProcess->processNum;
-    Boolean allExit = True;
+    PCB *startProcess = currentProcess;
 
-    while( True )
+    do
     {
-        if( currentProcess->processNum == initialProcess && numLoops > 0 )
-        {
-            return allExit;
-        }
-
-        if( currentProcess->state != state
-         && currentProcess->state != EXIT )
+        if( currentProcess->state == READY )
         {
-            allExit = False;
+            return False;
         }
 
         currentProcess = currentProcess->nextProcess;
-        numLoops++;
     }
+    while( currentProcess != NULL && currentProcess != startProcess );
+
+    return checkWorkloadDone( context ) == False;
 }
 //
-// getShortestProcess Function Implementation ///////////////////////////////////
+// checkWorkloadDone Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief Gets the shortest process in the system.
+ * @brief This function checks if every process has run to the end
  *
- * @details This function runs until the end of the list and returns the shortest
- *          PCB in the system.
+ * @details This function checks that every created process has exited and
+ *          that no process is left to arrive.
  *
- * @pre currentProcess a pointer to a PCB struct
+ * @pre context a pointer to a SimContext struct
  *
- * @post currentProcess remains unchanged at post
+ * @post context remains unchanged at post
  *
- * @param[in] currentProcess a pointer to a PCB struct
+ * @param[in] context a pointer to a SimContext struct
  *
- * @return a pointer to a process control block (PCB *)
+ * @return True if the workload is done, False otherwise (Boolean)
  */
-PCB *getShortestProcess(PCB *currentProcess)
+Boolean checkWorkloadDone( SimContext *context )
 {
-    int numLoops = 0, initialProcess = currentProcess->processNum;
-    PCB *shortestProcess = NULL;
-
-    while( True )
+    if( context->workload.activeProcesses > 0 )
     {
-        // End condition
-        if( currentProcess == NULL )
-        {
-            return shortestProcess;
-        }
-
-        if( currentProcess->processNum == initialProcess
-         && numLoops > 0 )
-        {
-            return shortestProcess;
-        }
-
-        if( shortestProcess == NULL && currentProcess->state == READY )
-        {
-            shortestProcess = currentProcess;
-        }
-        if( shortestProcess != NULL )
-        {
-            if( currentProcess->processTime < shortestProcess->processTime
-             && currentProcess->state == READY)
-            {
-                shortestProcess = currentProcess;
-            }
-        }
+        return False;
+    }
 
-        currentProcess = currentProcess->nextProcess;
-        numLoops++;
+    if( context->workload.stream != NULL
+     && context->workload.stream->pendingBlock != NULL )
+    {
+        return False;
     }
+
+    return True;
 }
 //
-// freePcbList Function Implementation ///////////////////////////////////
+// waitForEvent Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function deallocates a PCB linked list
+ * @brief This function waits while the CPU is idle
  *
- * @details This function deallocates a PCB linked list by iterating
- *          over the nodes in the list and deallocating the appropriate fields
+ * @details This function spins until either an I/O interupt has been queued
+ *          or simulated time reaches the next process arrival.
  *
- * @pre startProcess a pointer to a PCB struct. Ideally the head of the
- *                   linked list
+ * @par Algorithm
+ *      Under the virtual clock nothing can happen while waiting, so the
+ *      clock is moved straight to the next I/O end or arrival instead.
  *
- * @post startProcess is now a NULL pointer
+ * @pre context a pointer to a SimContext struct
  *
- * @param[in] startProcess a pointer to a StringNode struct
+ * @post context remains unchanged at post
+ *
+ * @param[in] context a pointer to a SimContext struct
  *
  * @return Nothing to return (void)
  */
-void freePcbList( PCB *startProcess )
+void waitForEvent( SimContext *context )
 {
-    int initialProcess = startProcess->processNum, numLoops = 0;
+    char timeString[ 300 ];
+    double nextEvent = context->workload.nextArrival;
+    double nextInterupt;
 
-    PCB *currentProcess = startProcess;
-
-    while( startProcess != NULL )
+    if( checkVirtualClock( &context->timer ) == True )
     {
-        currentProcess = startProcess;
-        startProcess = startProcess->nextProcess;
-
-        // Handle preemptive processing
-        if( initialProcess == currentProcess->processNum
-         && numLoops >= 0 )
+        if( context->interuptQueueIterator > -1 )
         {
             return;
         }
 
-        numLoops++;
-        free( currentProcess );
+        nextInterupt = getNextInteruptTime( context ) * 1000;
+
+        if( nextInterupt >= 0 && nextInterupt < nextEvent )
+        {
+            nextEvent = nextInterupt;
+        }
+
+        if( nextEvent < INT_MAX )
+        {
+            advanceClock( &context->timer, nextEvent
+                          - accessTimer( &context->timer, LAP_TIMER,
+                                         timeString ) * 1000 );
+            deliverInterupts( context );
+        }
+
+        return;
+    }
+
+    while( context->interuptQueueIterator < 0
+        && accessTimer( &context->timer, LAP_TIMER, timeString ) * 1000
+                                        < context->workload.nextArrival )
+    {
+        checkCounterDump( context );
     }
 }
 //
-// writeToLog Function Implementation ///////////////////////////////////
+// getNextReadyProcess Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function writes a StringNode struct linked list to a file
- *
- * @details This function iterates over a StringNode struct linked list writing
- *          each structs string value to a givem file
- *
- * @pre startNode a pointer to a StringNode struct. Ideally the head of the
- *                linked list
- *
- * @pre filename a pointer to a string
+ * @brief This function finds the next ready process in list order
  *
- * @post startNode is now a NULL pointer
+ * @details This function walks the ring once starting at the given PCB and
+ *          returns the first PCB in the Ready state.
  *
- * @post filename remains unchanged
+ * @pre currentProcess a pointer to a PCB in a ring
  *
- * @param[in] startNode a pointer to a StringNode struct
+ * @post currentProcess remains unchanged at post
  *
- * @param[in] filename a pointer to a string
+ * @param[in] currentProcess a pointer to a PCB struct
  *
- * @return Nothing to return (void)
+ * @return the next ready PCB, or NULL if there is none (PCB *)
  */
-void writeToLog( StringNode *startNode, char *filename )
+PCB *getNextReadyProcess( PCB *currentProcess )
 {
-    FILE *logFilePointer;
-    logFilePointer = fopen( filename, "w" );
+    PCB *startProcess = currentProcess;
 
-    while( startNode != NULL )
+    do
     {
-        fprintf( logFilePointer, "%s", startNode->string );
-        startNode = startNode->nextNode;
+        if( currentProcess->state == READY )
+        {
+            return currentProcess;
+        }
+
+        currentProcess = currentProcess->nextProcess;
     }
+    while( currentProcess != startProcess );
 
-    fclose( logFilePointer );
+    return NULL;
 }
 //
-// checkPremptive Function Implementation ///////////////////////////////////
+// runSimClock Function Implementation ///////////////////////////////////
 //
 
 /**
- * @brief This function processes a PCB linked list using a First Come First
- *        Serve algorithm.
+ * @brief This function runs the simulator clock for a number of mSec
  *
- * @details This function processes a PCB linked list using a First Come First
- *          Serve algorithm, where the first PCB to come in is the first PCB
- *          that is processed by the system.
+ * @details This function busy waits on the real clock, or under the virtual
+ *          clock moves time forward and hands any I/O that has finished by
+ *          the new time to the interupt queue.
  *
- * @pre cfData a pointer to a ConfigData struct
+ * @pre context a pointer to a SimContext struct
  *
- * @post cfData remains unchanged at post
+ * @post the simulator clock is milliSeconds later at post
  *
- * @param[in] cfData a pointer to a ConfigData struct
+ * @param[in] context a pointer to a SimContext struct
  *
- * @return True if the current setup is preemptive, False otherwise (Boolean)
+ * @param[in] milliSeconds the time to run for
+ *
+ * @return Nothing to return (void)
  */
-Boolean checkPremptive(ConfigData *cfData)
+void runSimClock( SimContext *context, int milliSeconds )
 {
-    if( stringCmp(cfData->cpuSchedCode, "SRTF-P")
-     || stringCmp(cfData->cpuSchedCode, "FCFS-P")
-     || stringCmp(cfData->cpuSchedCode, "RR-P"))
-    {
-        return True;
-    }
-    else
+    if( checkVirtualClock( &context->timer ) == False )
     {
-        return False;
+        runTimer( milliSeconds );
+        return;
     }
+
+    advanceClock( &context->timer, milliSeconds );
+    deliverInterupts( context );
 }
@@ -16,6 +16,113 @@
 * Added interupt system and made necessary changes/inclusions for preemptive
 * stuffs
 *
+* @version 1.20
+* C.S student (18 October 2026)
+* PCBs now carry their own op cursor state so process templates can share
+* a single op list, including the state of any repeat blocks they are in
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* Added process arrival times and streaming workload ingestion
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* Added the virtual clock and RunSummary for parameter sweeps
+*
+* @version 1.50
+* C.S student (18 October 2026)
+* Moved all run state into SimContext so simulations can run side by side
+* in one process
+*
+* @version 1.60
+* C.S student (18 October 2026)
+* Added the log sink used by libossim
+*
+* @version 1.70
+* C.S student (18 October 2026)
+* Added per process scheduling metrics
+*
+* @version 1.80
+* C.S student (18 October 2026)
+* Added latency histograms
+*
+* @version 1.90
+* C.S student (18 October 2026)
+* Added the Trace log target
+*
+* @version 2.00
+* C.S student (18 October 2026)
+* Added runtime counters
+*
+* @version 2.10
+* C.S student (18 October 2026)
+* Added the live stats socket
+*
+* @version 2.20
+* C.S student (18 October 2026)
+* Added the SIM_TRACE_LEVEL tracing macros
+*
+* @version 2.30
+* C.S student (18 October 2026)
+* Added the MLFQ-P scheduler
+*
+* @version 2.40
+* C.S student (18 October 2026)
+* Added the CFS-P scheduler
+*
+* @version 2.50
+* C.S student (18 October 2026)
+* Added the LOTTERY-P and STRIDE-P schedulers
+*
+* @version 2.60
+* C.S student (18 October 2026)
+* Added the EDF-P and RM-P schedulers and process deadlines
+*
+* @version 2.70
+* C.S student (18 October 2026)
+* Added CPU burst prediction for SJF-N and SRTF-P
+*
+* @version 2.80
+* C.S student (18 October 2026)
+* RR-P quanta last across ops and can adapt to each process
+*
+* @version 2.90
+* C.S student (18 October 2026)
+* SJF-N and SRTF-P pick from an aging ready queue
+*
+* @version 3.00
+* C.S student (18 October 2026)
+* Dispatches can cost context switch and cache refill time
+*
+* @version 3.10
+* C.S student (18 October 2026)
+* I/O ops wait in the request queue of their device
+*
+* @version 3.20
+* C.S student (18 October 2026)
+* MLFQ-P, CFS-P, LOTTERY-P, STRIDE-P, EDF-P and RM-P share one dispatch
+* loop with per policy hooks
+*
+* @version 3.30
+* C.S student (18 October 2026)
+* The MLFQ-P quantum lasts across ops
+*
+* @version 3.40
+* C.S student (18 October 2026)
+* The CFS-P slice is kept in quantumLeft
+*
+* @version 3.50
+* C.S student (18 October 2026)
+* The LOTTERY-P and STRIDE-P quantum lasts across ops
+*
+* @version 3.60
+* C.S student (18 October 2026)
+* The EDF-P and RM-P quantum lasts across ops
+*
+* @version 3.70
+* C.S student (18 October 2026)
+* Added the capacities of the interupt queues
+*
 * @note None
 */
 
@@ -36,16 +143,49 @@
 #include <stdlib.h>
 #include <pthread.h>
 #include <stdarg.h>
+#include <limits.h>
 #include "stringUtils.h"
+#include "simIO.h"
 #include "simTimer.h"
 #include "memory.h"
 #include "interupt.h"
+#include "mlfq.h"
+#include "cfs.h"
+#include "share.h"
+#include "deadline.h"
+#include "aging.h"
+#include "device.h"
+#include "metrics.h"
+#include "trace.h"
+#include "counters.h"
+#include "liveStats.h"
 
 //
 // Global Constant Definitions ////////////////////////////////////
 //
 
-//// None
+// Deepest nesting of R(count){ ... } blocks allowed inside one process
+#define MAX_LOOP_DEPTH 8
+
+// Log lines kept by the tracing macros, set with -DSIM_TRACE_LEVEL=N
+//   2 - every line (default)
+//   1 - state changes and interupts, but not the start and end of ops
+//   0 - neither, so benchmarks time only the scheduling
+#ifndef SIM_TRACE_LEVEL
+#define SIM_TRACE_LEVEL 2
+#endif
+
+// The lines below the level are dead code the compiler drops, along with
+// their arguments, which are never evaluated
+#define TRACE_EVENT( context, ... ) \
+    do { if( SIM_TRACE_LEVEL >= 1 ) logLine( context, __VA_ARGS__ ); } while( 0 )
+
+#define TRACE_OP( context, ... ) \
+    do { if( SIM_TRACE_LEVEL >= 2 ) logLine( context, __VA_ARGS__ ); } while( 0 )
+
+// Lap time of a traced line, as a float like the rest of the log
+#define TRACE_TIME( context, timeString ) \
+    ( (float) accessTimer( &( context )->timer, LAP_TIMER, timeString ) )
 
 //
 // Data Structure Definitions (structs, enums, etc.)////////////////
@@ -59,83 +199,342 @@ typedef enum
   RUNNING
 } STATE;
 
+typedef struct LoopFrame
+{
+  MetaNode *bodyNode;
+  int repeatsLeft;
+} LoopFrame;
+
+// A streamed process block and the number of PCBs still running it
+typedef struct ProcessImage
+{
+  MetaNode *blockNode;
+  int users;
+} ProcessImage;
+
 typedef struct PCB
 {
   int processNum;
   int processTime;
+  // Simulated time (msec) the process is admitted to the Ready state
+  int arrivalTime;
+  // Cycles left on the op under startNode, -1 until that op is first run
+  int remainingCycles;
   MetaNode *startNode;
+  // Open R(count){ ... } blocks around startNode, innermost last
+  LoopFrame *loopStack;
+  int loopDepth;
+  // Owning process block when the workload is streamed, NULL otherwise
+  ProcessImage *image;
+  ProcessMetrics metrics;
+  // MLFQ-P level, 0 for the top, valid while mlfqEpoch is the boost epoch
+  int mlfqLevel;
+  int mlfqEpoch;
+  // Next process in the same MLFQ-P ready queue or SJF-N and SRTF-P bucket
+  struct PCB *nextQueued;
+  // Nice value from the metadata and the run time weighted by it in usec,
+  // which orders the CFS-P ready tree
+  int nice;
+  long long vruntime;
+  // Links in the CFS-P ready tree
+  struct PCB *treeParent;
+  struct PCB *treeLeft;
+  struct PCB *treeRight;
+  Boolean treeRed;
+  // LOTTERY-P and STRIDE-P tickets from the metadata, STRIDE-P pass, and
+  // the CPU msec owed per ticket when the process last became ready
+  int tickets;
+  long long pass;
+  double shareMark;
+  // Release period and absolute deadline (msec) from the metadata, 0 and
+  // -1 if not given
+  int period;
+  int deadline;
+  // Predicted length of the next CPU burst and the msec run in the current
+  // one, kept when bursts are predicted
+  double burstTau;
+  double burstTime;
+  // Cycles left of the quantum, or CFS-P slice, given when the process was
+  // picked under a policy that keeps it across ops
+  int quantumLeft;
+  // SJF-N and SRTF-P ready queue key, the time plus the aging rate times
+  // the time the process became ready, in usec
+  long long agingKey;
+  // CPU msec the run had been busy when the process last stopped running,
+  // -1 if it never ran, which tells how cold its cache is
+  double cacheMark;
   struct PCB *nextProcess;
   STATE state;
 } PCB;
+
+// Bookkeeping for processes that have not arrived or have not exited yet
+typedef struct Workload
+{
+  MetaStream *stream;
+  PCB *tailProcess;
+  int nextProcessNum;
+  int activeProcesses;
+  int exitedProcesses;
+  double nextArrival;
+  Boolean streamError;
+  // Streamed PCBs of a periodic template still waiting to be released
+  int heldProcesses;
+} Workload;
+
+// Hooks of a scheduler that keeps its ready processes in a structure of its
+// own, run by dispatchReadyQueue
+struct SimContext;
+
+typedef struct ReadyQueueOps
+{
+  // Adds a process made ready, fresh unless it was just running
+  void (*queueProcess)( struct SimContext *context, PCB *process,
+                        Boolean fresh );
+  int (*countReady)( struct SimContext *context );
+  // Takes the next process to run, NULL if none is ready
+  PCB *(*takeProcess)( struct SimContext *context );
+  // Logs the pick and gives the process its quantum
+  void (*selectProcess)( struct SimContext *context, PCB *process );
+  // Charges the cycles a process ran, NULL if the policy keeps no account
+  void (*chargeProcess)( struct SimContext *context, PCB *process,
+                         int cycles );
+  // Acts on a process that used its quantum, NULL if nothing changes
+  void (*expireProcess)( struct SimContext *context, PCB *process );
+} ReadyQueueOps;
+
+// Totals for one run of the simulator, kept in its SimContext
+typedef struct RunSummary
+{
+  double totalTime;
+  int processes;
+  int dispatches;
+  int ioBlocks;
+  int segFaults;
+} RunSummary;
+
+// Everything a single run of the simulator changes. Each simulation has its
+// own, so any number of them can run at once on different threads
+typedef struct SimContext
+{
+  ConfigData *cfData;
+  StringNode *logNode;
+  // When set, every log line is given to logSink instead of being printed
+  // or kept for the log file
+  void (*logSink)( const char *line, void *userData );
+  void *logUserData;
+  SimTimer timer;
+  // I/O that has finished and is waiting to be handled
+  struct Interupt *interuptQueue;
+  int interuptQueueIterator;
+  int interuptQueueCapacity;
+  // I/O started under the virtual clock, a heap with the earliest end time
+  // at the top
+  struct Interupt *pendingInterupts;
+  int pendingInteruptCount;
+  int pendingInteruptCapacity;
+  long long nextInteruptOrder;
+  pthread_mutex_t interuptMutex;
+  pthread_mutex_t controlMutex;
+  pthread_mutex_t stringMutex;
+  Workload workload;
+  RunSummary runSummary;
+  RunMetrics runMetrics;
+  TraceWriter trace;
+  CounterSet counters;
+  LiveStats liveStats;
+  // Ready queues while running MLFQ-P, NULL otherwise
+  struct Mlfq *mlfq;
+  // Ready tree while running CFS-P, NULL otherwise
+  struct CfsQueue *cfs;
+  // Ready set while running LOTTERY-P or STRIDE-P, NULL otherwise
+  struct ShareQueue *share;
+  // Ready heap while running EDF-P or RM-P, NULL otherwise
+  struct DeadlineQueue *deadlines;
+  // Hooks of the scheduler run by dispatchReadyQueue, NULL otherwise
+  const ReadyQueueOps *readyOps;
+  // Ready queue while running SJF-N or SRTF-P, NULL otherwise
+  struct AgingQueue *aging;
+  // Request queues of the I/O devices while a device has a channel count,
+  // NULL otherwise
+  struct DeviceQueues *devices;
+} SimContext;
 //
 // Function Prototypes ///////////////////////////////////////
 //
-StringNode *beginProcessing( MetaNode *currentNode, ConfigData *cfData );
+SimContext *createSimContext( ConfigData *cfData );
 
-int buildPcbList( PCB *currentPCB, MetaNode *currentNode, ConfigData *cfData );
+void freeSimContext( SimContext *context );
 
-void processAsFCFSN( PCB *currentProcess,
+StringNode *beginProcessing( SimContext *context,
+                             MetaNode *currentNode,
+                             MetaStream *stream );
+
+int buildPcbList( SimContext *context,
+                  PCB **headProcess,
+                  MetaNode *currentNode );
+
+int measurePcbBlock( MetaNode *blockNode,
                      ConfigData *cfData,
-                     StringNode *startNode,
+                     int *processTime,
+                     int *maxLoopDepth,
+                     MetaNode **endNode );
+
+PCB *createPcbBlock( SimContext *context,
+                     MetaNode *blockNode,
+                     int processTime,
+                     int maxLoopDepth,
+                     PCB **tailProcess );
+
+int startPcbStream( SimContext *context, PCB **headProcess, MetaStream *stream );
+
+void processAsFCFSN( PCB *currentProcess,
+                     SimContext *context,
                      MMU *memoryManagementUnit );
 
 void processAsSJFN( PCB *currentProcess,
-                    ConfigData *cfData,
-                    StringNode *startNode,
+                    SimContext *context,
                     MMU *memoryManagementUnit );
 
 void processAsFCFSP( PCB *currentProcess,
-                     ConfigData *cfData,
-                     StringNode *startNode,
+                     SimContext *context,
                      MMU *memoryManagementUnit );
 
 void processAsSRTFP( PCB *currentProcess,
-                     ConfigData *cfData,
-                     StringNode *startNode,
+                     SimContext *context,
                      MMU *memoryManagementUnit );
 
 void processAsRRP( PCB *currentProcess,
-                    ConfigData *cfData,
-                    StringNode *startNode,
+                    SimContext *context,
                     MMU *memoryManagementUnit );
 
+void processAsMLFQP( PCB *currentProcess,
+                     SimContext *context,
+                     MMU *memoryManagementUnit );
+
+void processAsCFSP( PCB *currentProcess,
+                    SimContext *context,
+                    MMU *memoryManagementUnit );
+
+void processAsShareP( PCB *currentProcess,
+                      SimContext *context,
+                      MMU *memoryManagementUnit );
+
+void processAsDeadlineP( PCB *currentProcess,
+                         SimContext *context,
+                         MMU *memoryManagementUnit );
+
+void dispatchReadyQueue( PCB *currentProcess,
+                         SimContext *context,
+                         MMU *memoryManagementUnit,
+                         const ReadyQueueOps *ops );
+
+void queueMlfqReady( SimContext *context, PCB *process, Boolean fresh );
+
+int countMlfqReady( SimContext *context );
+
+PCB *takeMlfqReady( SimContext *context );
+
+void selectMlfqReady( SimContext *context, PCB *process );
+
+void demoteMlfqReady( SimContext *context, PCB *process );
+
+void queueCfsReady( SimContext *context, PCB *process, Boolean fresh );
+
+int countCfsReady( SimContext *context );
+
+PCB *takeCfsReady( SimContext *context );
+
+void selectCfsReady( SimContext *context, PCB *process );
+
+void chargeCfsReady( SimContext *context, PCB *process, int cycles );
+
+void queueShareReady( SimContext *context, PCB *process, Boolean fresh );
+
+int countShareReady( SimContext *context );
+
+PCB *takeShareReady( SimContext *context );
+
+void selectShareReady( SimContext *context, PCB *process );
+
+void chargeShareReady( SimContext *context, PCB *process, int cycles );
+
+void queueDeadlineReady( SimContext *context, PCB *process, Boolean fresh );
+
+int countDeadlineReady( SimContext *context );
+
+PCB *takeDeadlineReady( SimContext *context );
+
+void selectDeadlineReady( SimContext *context, PCB *process );
+
+void logSchedulability( SimContext *context, PCB *headProcess );
+
 int runProcess( PCB *currentProcess,
-                ConfigData *cfData,
-                StringNode *startNode,
+                SimContext *context,
                 MMU *memoryManagementUnit );
 
 int executeOp( MetaNode *currentNode,
                 PCB *currentProcess,
-                ConfigData *cfData,
-                char *opPrint,
-                StringNode *startNode );
+                SimContext *context,
+                char *opPrint );
 
 int executeOpIO( MetaNode *currentNode,
                   PCB *currentProcess,
-                  ConfigData *cfData,
-                  char *opPrint,
-                  StringNode *startNode );
+                  SimContext *context,
+                  char *opPrint );
 
 int executeOpMem( MetaNode *currentNode,
                   PCB *currentProcess,
-                  ConfigData *cfData,
-                  StringNode *startNode,
+                  SimContext *context,
                   MMU *memoryManagementUnit );
 
 int getOpTime( MetaNode *currentNode, ConfigData *cfData );
 
-void setState( ConfigData *cfData,
-               StringNode *startNode,
+void setState( SimContext *context,
                PCB *currentPCB,
                STATE state );
 
-void setStateRecursive( PCB *currentPCB, STATE state );
+int setStateRecursive( PCB *currentPCB, STATE state );
+
+void updateProcessMetrics( SimContext *context,
+                           PCB *currentPCB,
+                           STATE oldState,
+                           double time );
+
+void logRunMetrics( SimContext *context );
+
+void logShareMetrics( SimContext *context );
 
-void checkPcbCreation( ConfigData *cfData, StringNode *startNode, int pcbCode);
+void logWaitMetrics( SimContext *context );
+
+int chargeContextSwitch( SimContext *context, PCB *currentPCB );
+
+void logDeadlineMetrics( SimContext *context );
+
+void logDeviceMetrics( SimContext *context );
+
+void logBurstPrediction( SimContext *context );
+
+void dumpCounters( SimContext *context );
+
+void checkCounterDump( SimContext *context );
+
+void traceProcessState( SimContext *context,
+                        PCB *currentPCB,
+                        STATE oldState,
+                        double time );
+
+void traceDeviceSlice( SimContext *context,
+                       PCB *currentPCB,
+                       char *opString,
+                       char *opPrint,
+                       double endTime,
+                       int runTime );
+
+void checkPcbCreation( SimContext *context, int pcbCode);
 
 void displayProcess( PCB *currentPCB );
 
-void logLine( ConfigData *cfData, StringNode *startNode, char* format, ... );
+void logLine( SimContext *context, char* format, ... );
 
 PCB *createPCB();
 
@@ -143,13 +542,52 @@ PCB *getFinalProcess(PCB *currentProcess);
 
 Boolean checkState(PCB *currentProcess, STATE state);
 
-PCB *getShortestProcess(PCB *currentProcess);
+double getPredictedTime( PCB *currentPCB );
+
+void endCpuBurst( SimContext *context, PCB *currentPCB );
 
 void freePcbList( PCB *startProcess );
 
 void writeToLog( StringNode *startNode, char *filename );
 
 Boolean checkPremptive(ConfigData *cfData);
+
+Boolean checkQuantumCarried( SimContext *context );
+
+void expireQuantum( SimContext *context, PCB *currentProcess );
+
+int getRoundRobinQuantum( SimContext *context, PCB *currentPCB );
+
+Boolean checkBurstTracking( ConfigData *cfData );
+
+Boolean checkProcessEnd( MetaNode *currentNode );
+
+MetaNode *resolveLoopNodes( PCB *currentProcess, MetaNode *currentNode );
+
+int admitArrivals( SimContext *context,
+                   PCB *headProcess,
+                   PCB *keepProcess );
+
+int admitStreamBlock( SimContext *context );
+
+double getNextArrival( SimContext *context, PCB *headProcess );
+
+void reapExitedProcesses( SimContext *context,
+                          PCB *headProcess,
+                          PCB *keepProcess );
+
+void freePCB( PCB *currentProcess );
+
+Boolean checkIdle( SimContext *context, PCB *currentProcess );
+
+Boolean checkWorkloadDone( SimContext *context );
+
+void waitForEvent( SimContext *context );
+
+void runSimClock( SimContext *context, int milliSeconds );
+
+PCB *getNextReadyProcess( PCB *currentProcess );
+
 //
 // Terminating Precompiler Directives ///////////////////////////////
 //
@@ -0,0 +1,464 @@
+// Share Implementation File Information ///////////////////////////////
+/**
+* @file share.c
+*
+* @brief Implementation for share
+*
+* @details Implements all functions for the LOTTERY-P and STRIDE-P ready sets
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of share
+*
+* @note Requires share.h
+*/
+
+#include "share.h"
+
+//
+// createShareQueue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function creates an empty LOTTERY-P or STRIDE-P ready set
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @post cfData remains unchanged at post
+ *
+ * @param[in] cfData a pointer to a ConfigData struct
+ *
+ * @param[in] lottery True for LOTTERY-P, False for STRIDE-P
+ *
+ * @return a pointer to the new ready set (ShareQueue *)
+ */
+ShareQueue *createShareQueue( ConfigData *cfData, Boolean lottery )
+{
+    ShareQueue *share = malloc( sizeof( *share ) );
+
+    share->lottery = lottery;
+    share->capacity = SHARE_START_CAPACITY;
+    share->ticketTree = calloc( share->capacity + 1, sizeof( long long ) );
+    share->readyProcesses = calloc( share->capacity, sizeof( PCB * ) );
+    share->randomState = cfData->lotterySeed;
+    share->heapCapacity = SHARE_START_CAPACITY;
+    share->passHeap = malloc( sizeof( PCB * ) * share->heapCapacity );
+    share->currentPass = 0;
+    share->readyCount = 0;
+    share->readyTickets = 0;
+    share->cycleTime = cfData->processorCycleTime;
+    share->owedPerTicket = 0;
+
+    return share;
+}
+//
+// freeShareQueue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees a ready set, the PCBs in it are not freed
+ *
+ * @param[in] share a pointer to a ShareQueue struct
+ *
+ * @return nothing to return (void)
+ */
+void freeShareQueue( ShareQueue *share )
+{
+    free( share->ticketTree );
+    free( share->readyProcesses );
+    free( share->passHeap );
+    free( share );
+}
+//
+// queueShareProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds a ready process to the ready set
+ *
+ * @details A process that was not running starts being owed CPU time here.
+ *          Under STRIDE-P it is also moved up to the pass of the process
+ *          last taken, so time spent blocked is not saved up.
+ *
+ * @pre process a pointer to a PCB that is not in the ready set
+ *
+ * @param[in,out] share a pointer to a ShareQueue struct
+ *
+ * @param[in,out] process a pointer to a PCB struct
+ *
+ * @param[in] waking True if the process was not running before
+ *
+ * @return nothing to return (void)
+ */
+void queueShareProcess( ShareQueue *share, PCB *process, Boolean waking )
+{
+    if( waking == True )
+    {
+        process->shareMark = share->owedPerTicket;
+    }
+
+    if( share->lottery == True )
+    {
+        growShareQueue( share, process->processNum );
+        share->readyProcesses[ process->processNum ] = process;
+        addTicketTree( share, process->processNum, process->tickets );
+    }
+    else
+    {
+        if( waking == True && process->pass < share->currentPass )
+        {
+            process->pass = share->currentPass;
+        }
+
+        pushPassHeap( share, process );
+    }
+
+    share->readyCount++;
+    share->readyTickets += process->tickets;
+}
+//
+// takeShareProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function takes the next process to run from the ready set
+ *
+ * @details Under LOTTERY-P a ticket of the ready processes is drawn at
+ *          random and its holder is taken. Under STRIDE-P the process with
+ *          the least pass is taken.
+ *
+ * @param[in,out] share a pointer to a ShareQueue struct
+ *
+ * @return the process, or NULL if no process is ready (PCB *)
+ */
+PCB *takeShareProcess( ShareQueue *share )
+{
+    PCB *process;
+    int index;
+
+    if( share->readyCount == 0 )
+    {
+        return NULL;
+    }
+
+    if( share->lottery == True )
+    {
+        index = findTicketTree( share,
+                                (long long) ( getShareRandom(
+                                                  &share->randomState )
+                                % (unsigned long long) share->readyTickets ) );
+        process = share->readyProcesses[ index ];
+        share->readyProcesses[ index ] = NULL;
+        addTicketTree( share, index, -process->tickets );
+    }
+    else
+    {
+        process = popPassHeap( share );
+        share->currentPass = process->pass;
+    }
+
+    share->readyCount--;
+    share->readyTickets -= process->tickets;
+
+    return process;
+}
+//
+// chargeShareProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function charges a running process for the cycles it ran
+ *
+ * @details This function shares the run time out between the tickets of
+ *          the running and ready processes, and under STRIDE-P adds the
+ *          stride of the process to its pass for each cycle.
+ *
+ * @param[in,out] share a pointer to a ShareQueue struct
+ *
+ * @param[in,out] process a pointer to the running PCB
+ *
+ * @param[in] cycles the cycles it ran
+ *
+ * @return nothing to return (void)
+ */
+void chargeShareProcess( ShareQueue *share, PCB *process, int cycles )
+{
+    share->owedPerTicket += (double) cycles * share->cycleTime
+                          / ( share->readyTickets + process->tickets );
+
+    if( share->lottery == False )
+    {
+        process->pass += STRIDE_ONE / process->tickets * cycles;
+    }
+}
+//
+// leaveShareQueue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function settles the CPU time owed to a process that blocked
+ *        or exited
+ *
+ * @param[in] share a pointer to a ShareQueue struct
+ *
+ * @param[in,out] process a pointer to a PCB that was running
+ *
+ * @return nothing to return (void)
+ */
+void leaveShareQueue( ShareQueue *share, PCB *process )
+{
+    process->metrics.shareTime += process->tickets
+                                * ( share->owedPerTicket - process->shareMark );
+    process->shareMark = share->owedPerTicket;
+}
+//
+// addTicketTree Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds tickets at a process number in the Fenwick tree
+ *
+ * @param[in,out] share a pointer to a ShareQueue struct
+ *
+ * @param[in] index the process number, below the capacity
+ *
+ * @param[in] tickets the tickets to add, negative to take them away
+ *
+ * @return nothing to return (void)
+ */
+void addTicketTree( ShareQueue *share, int index, long long tickets )
+{
+    for( index++; index <= share->capacity; index += index & -index )
+    {
+        share->ticketTree[ index ] += tickets;
+    }
+}
+//
+// findTicketTree Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function finds the process holding a ticket
+ *
+ * @details This function walks down the Fenwick tree from its largest
+ *          power of two, skipping every range whose tickets are all before
+ *          the one wanted.
+ *
+ * @pre ticket is less than the ready tickets
+ *
+ * @param[in] share a pointer to a ShareQueue struct
+ *
+ * @param[in] ticket the ticket, counting the tickets of ready processes in
+ *            process number order from 0
+ *
+ * @return the process number holding it (int)
+ */
+int findTicketTree( ShareQueue *share, long long ticket )
+{
+    int position = 0, step;
+
+    for( step = share->capacity; step > 0; step >>= 1 )
+    {
+        if( position + step <= share->capacity
+         && share->ticketTree[ position + step ] <= ticket )
+        {
+            position += step;
+            ticket -= share->ticketTree[ position ];
+        }
+    }
+
+    return position;
+}
+//
+// growShareQueue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function makes room in the Fenwick tree for a process number
+ *
+ * @details This function doubles the capacity until the process number
+ *          fits, then builds the tree again from the ready processes in
+ *          O(capacity).
+ *
+ * @param[in,out] share a pointer to a ShareQueue struct
+ *
+ * @param[in] processNum the process number to make room for
+ *
+ * @return nothing to return (void)
+ */
+void growShareQueue( ShareQueue *share, int processNum )
+{
+    int oldCapacity = share->capacity, index, parent;
+
+    if( processNum < share->capacity )
+    {
+        return;
+    }
+
+    while( processNum >= share->capacity )
+    {
+        share->capacity *= 2;
+    }
+
+    share->readyProcesses = realloc( share->readyProcesses,
+                                     sizeof( PCB * ) * share->capacity );
+
+    for( index = oldCapacity; index < share->capacity; index++ )
+    {
+        share->readyProcesses[ index ] = NULL;
+    }
+
+    free( share->ticketTree );
+    share->ticketTree = calloc( share->capacity + 1, sizeof( long long ) );
+
+    for( index = 1; index <= share->capacity; index++ )
+    {
+        if( share->readyProcesses[ index - 1 ] != NULL )
+        {
+            share->ticketTree[ index ]
+                                += share->readyProcesses[ index - 1 ]->tickets;
+        }
+
+        parent = index + ( index & -index );
+
+        if( parent <= share->capacity )
+        {
+            share->ticketTree[ parent ] += share->ticketTree[ index ];
+        }
+    }
+}
+//
+// checkPassBefore Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if one process comes before another in the
+ *        pass heap
+ *
+ * @details Processes with the same pass are ordered by process number so
+ *          runs are repeatable.
+ *
+ * @param[in] first a pointer to a PCB struct
+ *
+ * @param[in] second a pointer to a PCB struct
+ *
+ * @return True if first comes before second, False otherwise (Boolean)
+ */
+Boolean checkPassBefore( PCB *first, PCB *second )
+{
+    if( first->pass < second->pass
+     || ( first->pass == second->pass
+       && first->processNum < second->processNum ) )
+    {
+        return True;
+    }
+
+    return False;
+}
+//
+// pushPassHeap Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function adds a process to the pass heap
+ *
+ * @details The heap holds readyCount processes, which the caller counts.
+ *
+ * @param[in,out] share a pointer to a ShareQueue struct
+ *
+ * @param[in] process a pointer to a PCB struct
+ *
+ * @return nothing to return (void)
+ */
+void pushPassHeap( ShareQueue *share, PCB *process )
+{
+    int index = share->readyCount, parent;
+
+    if( index == share->heapCapacity )
+    {
+        share->heapCapacity *= 2;
+        share->passHeap = realloc( share->passHeap,
+                                   sizeof( PCB * ) * share->heapCapacity );
+    }
+
+    while( index > 0 )
+    {
+        parent = ( index - 1 ) / 2;
+
+        if( checkPassBefore( process, share->passHeap[ parent ] ) == False )
+        {
+            break;
+        }
+
+        share->passHeap[ index ] = share->passHeap[ parent ];
+        index = parent;
+    }
+
+    share->passHeap[ index ] = process;
+}
+//
+// popPassHeap Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function takes the process with the least pass from the heap
+ *
+ * @pre the heap holds readyCount processes, at least one
+ *
+ * @param[in,out] share a pointer to a ShareQueue struct
+ *
+ * @return the process (PCB *)
+ */
+PCB *popPassHeap( ShareQueue *share )
+{
+    int count = share->readyCount - 1, index = 0, child;
+    PCB *first = share->passHeap[ 0 ];
+    PCB *last = share->passHeap[ count ];
+
+    while( ( child = index * 2 + 1 ) < count )
+    {
+        if( child + 1 < count
+         && checkPassBefore( share->passHeap[ child + 1 ],
+                             share->passHeap[ child ] ) == True )
+        {
+            child++;
+        }
+
+        if( checkPassBefore( share->passHeap[ child ], last ) == False )
+        {
+            break;
+        }
+
+        share->passHeap[ index ] = share->passHeap[ child ];
+        index = child;
+    }
+
+    share->passHeap[ index ] = last;
+
+    return first;
+}
+//
+// getShareRandom Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the next seeded random number
+ *
+ * @details This function uses splitmix64 like simgen, so a Lottery Seed
+ *          gives the same draws on every host.
+ *
+ * @param[in,out] randomState a pointer to the state of the generator
+ *
+ * @return 64 random bits (unsigned long long)
+ */
+unsigned long long getShareRandom( unsigned long long *randomState )
+{
+    unsigned long long value;
+
+    *randomState += 0x9E3779B97F4A7C15ULL;
+    value = *randomState;
+    value = ( value ^ ( value >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    value = ( value ^ ( value >> 27 ) ) * 0x94D049BB133111EBULL;
+
+    return value ^ ( value >> 31 );
+}
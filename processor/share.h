@@ -0,0 +1,111 @@
+// Share Header Information ////////////////////////////////////////
+/**
+* @file share.h
+*
+* @brief Header file for share
+*
+* @details Specifies constants, simple data structures, included libraries,
+*          and function declarations used in the LOTTERY-P and STRIDE-P
+*          ready sets
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of share
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides the ready sets of the proportional share schedulers.
+  LOTTERY-P keeps the tickets of ready processes in a Fenwick tree indexed by
+  process number, so drawing the winning ticket and adding or taking a
+  process are O(log n). STRIDE-P keeps ready processes in a binary heap by
+  pass, so taking the least pass and adding a process are O(log n).
+
+  Both also keep the CPU time each ticket was owed so far. A slice of t msec
+  run while T tickets could run owes each of them t / T msec, and a process
+  settles what it was owed when it stops being able to run, so the target
+  share of every process is known in O(1) per slice
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef SHARE_H
+#define SHARE_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include "processor.h"
+#include "configParser.h"
+#include "metaLinkedList.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+
+// Pass added per cycle run by a process with one ticket
+#define STRIDE_ONE ( 1LL << 20 )
+
+// Processes the ready sets have room for before they grow
+#define SHARE_START_CAPACITY 64
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+typedef struct ShareQueue
+{
+  // True for LOTTERY-P, False for STRIDE-P
+  Boolean lottery;
+  // LOTTERY-P Fenwick tree of ready tickets, 1 based, and the ready PCB of
+  // each process number or NULL
+  long long *ticketTree;
+  struct PCB **readyProcesses;
+  int capacity;
+  unsigned long long randomState;
+  // STRIDE-P heap of ready PCBs, least pass first, and the pass of the
+  // process last taken, which woken processes are moved up to
+  struct PCB **passHeap;
+  int heapCapacity;
+  long long currentPass;
+  int readyCount;
+  long long readyTickets;
+  int cycleTime;
+  // CPU msec owed to each ticket that could run since the start of the run
+  double owedPerTicket;
+} ShareQueue;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+ShareQueue *createShareQueue( ConfigData *cfData, Boolean lottery );
+
+void freeShareQueue( ShareQueue *share );
+
+void queueShareProcess( ShareQueue *share,
+                        struct PCB *process,
+                        Boolean waking );
+
+struct PCB *takeShareProcess( ShareQueue *share );
+
+void chargeShareProcess( ShareQueue *share, struct PCB *process, int cycles );
+
+void leaveShareQueue( ShareQueue *share, struct PCB *process );
+
+void addTicketTree( ShareQueue *share, int index, long long tickets );
+
+int findTicketTree( ShareQueue *share, long long ticket );
+
+void growShareQueue( ShareQueue *share, int processNum );
+
+Boolean checkPassBefore( struct PCB *first, struct PCB *second );
+
+void pushPassHeap( ShareQueue *share, struct PCB *process );
+
+struct PCB *popPassHeap( ShareQueue *share );
+
+unsigned long long getShareRandom( unsigned long long *randomState );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // SHARE_H
+//
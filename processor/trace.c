@@ -0,0 +1,410 @@
+// Trace Implementation File Information ///////////////////////////////
+/**
+* @file trace.c
+*
+* @brief Implementation for trace
+*
+* @details Implements all functions for writing the simulated timeline of a
+*          run as Chrome trace event JSON
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of trace
+*
+* @note Requires trace.h
+*/
+
+#include "trace.h"
+
+//
+// initTrace Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function initializes a trace writer that is not tracing
+ *
+ * @pre trace a pointer to a TraceWriter struct
+ *
+ * @post trace has no file at post
+ *
+ * @param[out] trace a pointer to a TraceWriter struct
+ *
+ * @return nothing to return (void)
+ */
+void initTrace( TraceWriter *trace )
+{
+    trace->filePointer = NULL;
+    trace->firstEvent = True;
+    trace->deviceCount = 0;
+}
+//
+// openTrace Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function starts a trace file
+ *
+ * @details This function opens the trace file, writes the start of the
+ *          event list and names the CPU, process and device track groups.
+ *
+ * @pre trace a pointer to a TraceWriter made by initTrace
+ *
+ * @post trace writes events to the file at post
+ *
+ * @exception badFile
+ *            If the file cannot be opened, return False and leave the trace
+ *            writer off.
+ *
+ * @param[in,out] trace a pointer to a TraceWriter struct
+ *
+ * @param[in] filename a pointer to the path of the trace file
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean openTrace( TraceWriter *trace, char *filename )
+{
+    int pid;
+    char *groupNames[] = { "CPU", "Processes", "I/O Devices" };
+
+    initTrace( trace );
+    trace->filePointer = fopen( filename, "w" );
+
+    if( trace->filePointer == NULL )
+    {
+        return False;
+    }
+
+    fprintf( trace->filePointer,
+             "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" );
+
+    for( pid = TRACE_CPU_PID; pid <= TRACE_DEVICE_PID; pid++ )
+    {
+        writeTraceEventStart( trace );
+        fprintf( trace->filePointer,
+                 "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d," \
+                 "\"args\":{\"name\":", pid );
+        writeTraceString( trace->filePointer, groupNames[ pid - 1 ] );
+        fprintf( trace->filePointer, "}}" );
+
+        writeTraceEventStart( trace );
+        fprintf( trace->filePointer,
+                 "{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":%d," \
+                 "\"args\":{\"sort_index\":%d}}", pid, pid );
+    }
+
+    traceTrackName( trace, TRACE_CPU_PID, TRACE_CORE_TID, "Core 0" );
+
+    return True;
+}
+//
+// closeTrace Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function finishes a trace file
+ *
+ * @details This function ends the event list, closes the file and frees
+ *          the device names. Nothing is done if the run was not traced.
+ *
+ * @pre trace a pointer to a TraceWriter struct
+ *
+ * @post trace is off at post
+ *
+ * @param[in,out] trace a pointer to a TraceWriter struct
+ *
+ * @return nothing to return (void)
+ */
+void closeTrace( TraceWriter *trace )
+{
+    int device;
+
+    if( trace->filePointer == NULL )
+    {
+        return;
+    }
+
+    fprintf( trace->filePointer, "\n]}\n" );
+    fclose( trace->filePointer );
+
+    for( device = 0; device < trace->deviceCount; device++ )
+    {
+        free( trace->deviceNames[ device ] );
+    }
+
+    initTrace( trace );
+}
+//
+// checkTracing Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if a run is being traced
+ *
+ * @param[in] trace a pointer to a TraceWriter struct
+ *
+ * @return True if events are written, False otherwise (Boolean)
+ */
+Boolean checkTracing( TraceWriter *trace )
+{
+    return trace->filePointer != NULL;
+}
+//
+// traceTrackName Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function names a track
+ *
+ * @details This function writes the thread name metadata event that gives
+ *          a track its label, and sorts the track by its number.
+ *
+ * @pre trace a pointer to a TraceWriter struct
+ *
+ * @post trace has the event written at post, if tracing
+ *
+ * @param[in] trace a pointer to a TraceWriter struct
+ *
+ * @param[in] pid the track group
+ *
+ * @param[in] tid the track in the group
+ *
+ * @param[in] name a pointer to the label of the track
+ *
+ * @return nothing to return (void)
+ */
+void traceTrackName( TraceWriter *trace, int pid, int tid, char *name )
+{
+    if( checkTracing( trace ) == False )
+    {
+        return;
+    }
+
+    writeTraceEventStart( trace );
+    fprintf( trace->filePointer,
+             "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d," \
+             "\"args\":{\"name\":", pid, tid );
+    writeTraceString( trace->filePointer, name );
+    fprintf( trace->filePointer, "}}" );
+
+    writeTraceEventStart( trace );
+    fprintf( trace->filePointer,
+             "{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":%d," \
+             "\"tid\":%d,\"args\":{\"sort_index\":%d}}", pid, tid, tid );
+}
+//
+// traceSlice Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes a slice of time on a track
+ *
+ * @pre trace a pointer to a TraceWriter struct
+ *
+ * @pre startTime and endTime in simulated sec, endTime not before startTime
+ *
+ * @post trace has the event written at post, if tracing
+ *
+ * @param[in] trace a pointer to a TraceWriter struct
+ *
+ * @param[in] pid the track group
+ *
+ * @param[in] tid the track in the group
+ *
+ * @param[in] name a pointer to the label of the slice
+ *
+ * @param[in] category a pointer to the category of the slice
+ *
+ * @param[in] startTime the start of the slice in sec
+ *
+ * @param[in] endTime the end of the slice in sec
+ *
+ * @return nothing to return (void)
+ */
+void traceSlice( TraceWriter *trace,
+                 int pid,
+                 int tid,
+                 char *name,
+                 char *category,
+                 double startTime,
+                 double endTime )
+{
+    if( checkTracing( trace ) == False )
+    {
+        return;
+    }
+
+    if( endTime < startTime )
+    {
+        endTime = startTime;
+    }
+
+    writeTraceEventStart( trace );
+    fprintf( trace->filePointer, "{\"name\":" );
+    writeTraceString( trace->filePointer, name );
+    fprintf( trace->filePointer,
+             ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3lf,\"dur\":%.3lf," \
+             "\"pid\":%d,\"tid\":%d}",
+             category, startTime * 1000000, ( endTime - startTime ) * 1000000,
+             pid, tid );
+}
+//
+// traceInstant Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes an instant event on a track
+ *
+ * @pre trace a pointer to a TraceWriter struct
+ *
+ * @post trace has the event written at post, if tracing
+ *
+ * @param[in] trace a pointer to a TraceWriter struct
+ *
+ * @param[in] pid the track group
+ *
+ * @param[in] tid the track in the group
+ *
+ * @param[in] name a pointer to the label of the event
+ *
+ * @param[in] category a pointer to the category of the event
+ *
+ * @param[in] time the time of the event in simulated sec
+ *
+ * @return nothing to return (void)
+ */
+void traceInstant( TraceWriter *trace,
+                   int pid,
+                   int tid,
+                   char *name,
+                   char *category,
+                   double time )
+{
+    if( checkTracing( trace ) == False )
+    {
+        return;
+    }
+
+    writeTraceEventStart( trace );
+    fprintf( trace->filePointer, "{\"name\":" );
+    writeTraceString( trace->filePointer, name );
+    fprintf( trace->filePointer,
+             ",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3lf," \
+             "\"pid\":%d,\"tid\":%d}",
+             category, time * 1000000, pid, tid );
+}
+//
+// getTraceDeviceTrack Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the track of an I/O device
+ *
+ * @details This function looks up a device by name, giving it the next
+ *          track and naming that track the first time it is seen.
+ *
+ * @pre trace a pointer to a TraceWriter struct
+ *
+ * @pre deviceName a pointer to the op string of an I/O op
+ *
+ * @post trace knows the device at post
+ *
+ * @param[in,out] trace a pointer to a TraceWriter struct
+ *
+ * @param[in] deviceName a pointer to the name of the device
+ *
+ * @return the track of the device in the device group (int)
+ */
+int getTraceDeviceTrack( TraceWriter *trace, char *deviceName )
+{
+    int device;
+
+    for( device = 0; device < trace->deviceCount; device++ )
+    {
+        if( stringCmp( trace->deviceNames[ device ], deviceName ) == True )
+        {
+            return device;
+        }
+    }
+
+    if( trace->deviceCount == TRACE_MAX_DEVICES )
+    {
+        return TRACE_MAX_DEVICES - 1;
+    }
+
+    trace->deviceNames[ device ] = malloc( stringLen( deviceName ) + 1 );
+    stringCpy( deviceName, trace->deviceNames[ device ], '\0' );
+    trace->deviceCount++;
+
+    traceTrackName( trace, TRACE_DEVICE_PID, device, deviceName );
+
+    return device;
+}
+//
+// writeTraceEventStart Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function separates an event from the one before it
+ *
+ * @pre trace a pointer to a TraceWriter that is tracing
+ *
+ * @post trace is ready for the next event at post
+ *
+ * @param[in,out] trace a pointer to a TraceWriter struct
+ *
+ * @return nothing to return (void)
+ */
+void writeTraceEventStart( TraceWriter *trace )
+{
+    if( trace->firstEvent == False )
+    {
+        fprintf( trace->filePointer, ",\n" );
+    }
+
+    trace->firstEvent = False;
+}
+//
+// writeTraceString Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes a string as a quoted JSON string
+ *
+ * @details This function escapes quotes, back slashes and control
+ *          characters, as op strings come straight from the metadata file.
+ *
+ * @pre filePointer a pointer to a file open for writing
+ *
+ * @post string remains unchanged at post
+ *
+ * @param[in] filePointer a pointer to a file
+ *
+ * @param[in] string a pointer to the string
+ *
+ * @return nothing to return (void)
+ */
+void writeTraceString( FILE *filePointer, char *string )
+{
+    int iterator;
+
+    fputc( '"', filePointer );
+
+    for( iterator = 0; string[ iterator ] != '\0'; iterator++ )
+    {
+        if( string[ iterator ] == '"' || string[ iterator ] == '\\' )
+        {
+            fputc( '\\', filePointer );
+            fputc( string[ iterator ], filePointer );
+        }
+        else if( (unsigned char) string[ iterator ] < ' ' )
+        {
+            fprintf( filePointer, "\\u%04x", string[ iterator ] );
+        }
+        else
+        {
+            fputc( string[ iterator ], filePointer );
+        }
+    }
+
+    fputc( '"', filePointer );
+}
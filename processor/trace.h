@@ -0,0 +1,98 @@
+// Trace Header Information ////////////////////////////////////////
+/**
+* @file trace.h
+*
+* @brief Header file for trace
+*
+* @details Specifies constants, simple data structures, included libraries,
+*          and function declarations used in writing timeline traces
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of trace
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides the operations for writing the simulated timeline of
+  a run as Chrome trace event JSON, which chrome://tracing and
+  ui.perfetto.dev open directly. Events are written as they happen, so the
+  trace never has to be held in memory.
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef TRACE_H
+#define TRACE_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include "stringUtils.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+
+// Each group of tracks is shown as one trace process
+#define TRACE_CPU_PID 1
+#define TRACE_PROCESS_PID 2
+#define TRACE_DEVICE_PID 3
+
+// The simulator has a single core
+#define TRACE_CORE_TID 0
+
+// Most I/O devices given their own track, later ones share the last track
+#define TRACE_MAX_DEVICES 32
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+typedef struct TraceWriter
+{
+  // NULL unless the run is being traced
+  FILE *filePointer;
+  Boolean firstEvent;
+  // Names of the I/O devices seen so far, the index is the device track
+  char *deviceNames[ TRACE_MAX_DEVICES ];
+  int deviceCount;
+} TraceWriter;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+void initTrace( TraceWriter *trace );
+
+Boolean openTrace( TraceWriter *trace, char *filename );
+
+void closeTrace( TraceWriter *trace );
+
+Boolean checkTracing( TraceWriter *trace );
+
+void traceTrackName( TraceWriter *trace, int pid, int tid, char *name );
+
+void traceSlice( TraceWriter *trace,
+                 int pid,
+                 int tid,
+                 char *name,
+                 char *category,
+                 double startTime,
+                 double endTime );
+
+void traceInstant( TraceWriter *trace,
+                   int pid,
+                   int tid,
+                   char *name,
+                   char *category,
+                   double time );
+
+int getTraceDeviceTrack( TraceWriter *trace, char *deviceName );
+
+void writeTraceEventStart( TraceWriter *trace );
+
+void writeTraceString( FILE *filePointer, char *string );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // TRACE_H
+//
@@ -0,0 +1,1074 @@
+// Regress Implementation File Information ///////////////////////////////
+/**
+* @file regress.c
+*
+* @brief Implementation for regress
+*
+* @details Implements the reference log regression runner built as
+*          simregress
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of regress
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* References can give config lines of their own, and the ones made on the
+* virtual clock are compared event by event
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* Added simgen workloads, checked for segmentation faults when generated
+* with no faults asked for
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* The FCFS-P and SRTF-P references were made again on the virtual clock,
+* and a run with no baseline records one
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* The RR-P reference was made again on the virtual clock, with its quantum
+* counted across ops
+*
+* @version 1.50
+* C.S student (18 October 2026)
+* Added the CFS-P reference
+*
+* @note Requires regress.h
+*/
+
+#define _DEFAULT_SOURCE
+
+#include "regress.h"
+
+int main( int argc, char *argv[] )
+{
+    RegressOptions options;
+    RegressResult results[ REGRESS_REFERENCE_COUNT ];
+    int index;
+    Boolean passed = True;
+
+    if( parseRegressArgs( argc, argv, &options ) != 0 )
+    {
+        printf( "Usage: %s [%s PATH] [%s PATH] [%s DIR] [%s DIR]\n" \
+                "       [%s Virtual|Real] [%s MSEC] [%s FILE] [%s PERCENT]\n" \
+                "       [%s N] [%s]\n",
+                argv[ 0 ], REGRESS_SIM_OPTION, REGRESS_GEN_OPTION,
+                REGRESS_REFS_OPTION,
+                REGRESS_WORK_OPTION, REGRESS_CLOCK_OPTION,
+                REGRESS_TOLERANCE_OPTION, REGRESS_BASELINE_OPTION,
+                REGRESS_THRESHOLD_OPTION, REGRESS_REPS_OPTION,
+                REGRESS_RECORD_OPTION );
+        return EXIT_FAILURE;
+    }
+
+    mkdir( options.workPath, 0755 );
+
+    for( index = 0; index < REGRESS_REFERENCE_COUNT; index++ )
+    {
+        results[ index ].reference = &REGRESS_REFERENCES[ index ];
+        runReference( &options, &results[ index ] );
+    }
+
+    // The first run on a host records the baseline later runs are gated on
+    if( options.record == False
+     && readBaseline( &options, results, REGRESS_REFERENCE_COUNT ) == False )
+    {
+        printf( "\nNo baseline at %s, recording this run\n",
+                options.baselinePath );
+        options.record = True;
+    }
+
+    if( options.record == True
+     && writeBaseline( &options, results, REGRESS_REFERENCE_COUNT ) == False )
+    {
+        printf( "Unable to write %s\n", options.baselinePath );
+        return EXIT_FAILURE;
+    }
+
+    printf( "\n%-14s %-6s %8s %10s %10s %10s %10s %10s\n",
+            "Name", "Result", "Diffs", "Max ms", "Wall ms", "Base ms",
+            "RSS KB", "Base KB" );
+
+    for( index = 0; index < REGRESS_REFERENCE_COUNT; index++ )
+    {
+        RegressResult *result = &results[ index ];
+        Boolean failed = result->ran == False || result->differences > 0
+                      || result->maxTimeError > options.tolerance
+                      || result->slower == True || result->larger == True;
+
+        if( failed == True )
+        {
+            passed = False;
+        }
+
+        printf( "%-14s %-6s %8d %10.3lf %10.2lf ",
+                result->reference->name, failed == True ? "FAIL" : "pass",
+                result->differences, result->maxTimeError,
+                result->wallTime );
+
+        if( result->hasBaseline == True )
+        {
+            printf( "%10.2lf %10ld %10ld", result->baseWallTime,
+                    result->peakRss, result->basePeakRss );
+        }
+        else
+        {
+            printf( "%10s %10ld %10s", "-", result->peakRss, "-" );
+        }
+
+        printf( "%s%s\n", result->slower == True ? " slower" : "",
+                          result->larger == True ? " larger" : "" );
+    }
+
+    if( options.record == True )
+    {
+        printf( "\nBaseline written to %s\n", options.baselinePath );
+    }
+
+    return passed == True ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+//
+// parseRegressArgs Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function reads the regression runner options
+ *
+ * @details This function fills in the options given on the command line,
+ *          every other option keeps its default.
+ *
+ * @exception badOption
+ *            If an option is unknown or its value cannot be read, print it
+ *            and return 1.
+ *
+ * @param[in] argc number of command line arguments
+ *
+ * @param[in] argv the command line arguments
+ *
+ * @param[out] options a pointer to a RegressOptions struct
+ *
+ * @return 0 for success, 1 for a bad option (int)
+ */
+int parseRegressArgs( int argc, char *argv[], RegressOptions *options )
+{
+    int iterator;
+    char *option, *value, *endPtr;
+    Boolean valid;
+
+    options->simPath = "./sim";
+    options->generatorPath = "./simgen";
+    options->refsPath = "Testing_References";
+    options->workPath = "regress_out";
+    options->virtualClock = True;
+    options->tolerance = 10;
+    options->baselinePath = "regress_baseline.txt";
+    options->threshold = 10;
+    options->reps = 5;
+    options->record = False;
+
+    for( iterator = 1; iterator < argc; iterator++ )
+    {
+        option = argv[ iterator ];
+
+        if( stringCmp( option, (char *) REGRESS_RECORD_OPTION ) == True )
+        {
+            options->record = True;
+            continue;
+        }
+
+        if( iterator + 1 >= argc )
+        {
+            printf( "Missing value for %s\n", option );
+            return 1;
+        }
+
+        iterator++;
+        value = argv[ iterator ];
+        valid = True;
+
+        if( stringCmp( option, (char *) REGRESS_SIM_OPTION ) == True )
+        {
+            options->simPath = value;
+        }
+        else if( stringCmp( option, (char *) REGRESS_GEN_OPTION ) == True )
+        {
+            options->generatorPath = value;
+        }
+        else if( stringCmp( option, (char *) REGRESS_REFS_OPTION ) == True )
+        {
+            options->refsPath = value;
+        }
+        else if( stringCmp( option, (char *) REGRESS_WORK_OPTION ) == True )
+        {
+            options->workPath = value;
+        }
+        else if( stringCmp( option, (char *) REGRESS_CLOCK_OPTION ) == True )
+        {
+            options->virtualClock = stringCmp( value, (char *) "Virtual" );
+            valid = options->virtualClock == True
+                 || stringCmp( value, (char *) "Real" ) == True;
+        }
+        else if( stringCmp( option,
+                            (char *) REGRESS_TOLERANCE_OPTION ) == True )
+        {
+            options->tolerance = strtod( value, &endPtr );
+            valid = *endPtr == NULL_TERMINAL && options->tolerance >= 0;
+        }
+        else if( stringCmp( option,
+                            (char *) REGRESS_BASELINE_OPTION ) == True )
+        {
+            options->baselinePath = value;
+        }
+        else if( stringCmp( option,
+                            (char *) REGRESS_THRESHOLD_OPTION ) == True )
+        {
+            options->threshold = strtod( value, &endPtr );
+            valid = *endPtr == NULL_TERMINAL && options->threshold >= 0;
+        }
+        else if( stringCmp( option, (char *) REGRESS_REPS_OPTION ) == True )
+        {
+            options->reps = stringToI( value );
+            valid = checkInt( value ) && options->reps > 0;
+        }
+        else
+        {
+            printf( "Unknown option %s\n", option );
+            return 1;
+        }
+
+        if( valid == False )
+        {
+            printf( "Bad value for %s: %s\n", option, value );
+            return 1;
+        }
+    }
+
+    return 0;
+}
+//
+// writeRegressConfig Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes the config a reference log was made with
+ *
+ * @details This function writes the config given in the references
+ *          README, logging to a file in the work directory. A generated
+ *          workload is read from the work directory, with enough memory
+ *          for every block simgen makes.
+ *
+ * @pre options a pointer to a RegressOptions struct
+ *
+ * @post the config is written at post
+ *
+ * @exception badFile
+ *            If the config cannot be written, return False.
+ *
+ * @param[in] options a pointer to a RegressOptions struct
+ *
+ * @param[in] reference a pointer to the RegressReference to run
+ *
+ * @param[out] configPath a pointer to REGRESS_PATH_SIZE chars
+ *
+ * @param[out] logPath a pointer to REGRESS_PATH_SIZE chars
+ *
+ * @param[out] workloadPath a pointer to REGRESS_PATH_SIZE chars
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean writeRegressConfig( RegressOptions *options,
+                            const RegressReference *reference,
+                            char *configPath,
+                            char *logPath,
+                            char *workloadPath )
+{
+    FILE *filePointer;
+    int memory = REGRESS_MEMORY_KB;
+
+    snprintf( configPath, REGRESS_PATH_SIZE, "%s/%s.cnf",
+              options->workPath, reference->name );
+    snprintf( logPath, REGRESS_PATH_SIZE, "%s/%s.lgf",
+              options->workPath, reference->name );
+
+    if( reference->generatedMemory != NULL )
+    {
+        snprintf( workloadPath, REGRESS_PATH_SIZE, "%s/%s.mdf",
+                  options->workPath, reference->name );
+        memory = REGRESS_GENERATED_MEMORY_KB;
+    }
+    else
+    {
+        snprintf( workloadPath, REGRESS_PATH_SIZE, "%s/%s_Test.mdf",
+                  options->refsPath, reference->name );
+    }
+
+    filePointer = fopen( configPath, "w" );
+
+    if( filePointer == NULL )
+    {
+        return False;
+    }
+
+    fprintf( filePointer,
+             "Start Simulator Configuration File\n" \
+             "Version/Phase: 1.5\n" \
+             "File Path: %s\n" \
+             "CPU Scheduling Code: %s\n" \
+             "Quantum Time (cycles): 5\n" \
+             "Memory Available (KB): %d\n" \
+             "Processor Cycle Time (msec): 10\n" \
+             "I/O Cycle Time (msec): 20\n" \
+             "Log To: File\n" \
+             "Log File Path: %s\n" \
+             "Simulation Clock: %s\n" \
+             "%s" \
+             "End Simulator Configuration File.\n",
+             workloadPath, reference->code, memory, logPath,
+             options->virtualClock == True ? "Virtual" : "Real",
+             reference->extraConfig );
+
+    fclose( filePointer );
+
+    return True;
+}
+//
+// runGenerator Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function makes the workload of a generated reference
+ *
+ * @details This function runs simgen with a fixed seed and no faults asked
+ *          for, so the same workload is made on every run.
+ *
+ * @pre reference a pointer to a RegressReference with generatedMemory set
+ *
+ * @post the workload is written at post
+ *
+ * @exception badRun
+ *            If simgen cannot be started or does not exit with 0,
+ *            return False.
+ *
+ * @param[in] options a pointer to a RegressOptions struct
+ *
+ * @param[in] reference a pointer to the RegressReference to make
+ *
+ * @param[in] workloadPath a pointer to the path to write the workload to
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean runGenerator( RegressOptions *options,
+                      const RegressReference *reference,
+                      char *workloadPath )
+{
+    int status, nullFile;
+    pid_t child;
+
+    fflush( stdout );
+    child = fork();
+
+    if( child == 0 )
+    {
+        nullFile = open( "/dev/null", O_WRONLY );
+        dup2( nullFile, STDERR_FILENO );
+        execl( options->generatorPath, options->generatorPath,
+               "--processes", REGRESS_GENERATED_PROCESSES, "--seed", "3",
+               "--mix", "40,15,15,30", "--memory", reference->generatedMemory,
+               "--faults", "0", "--out", workloadPath, (char *) NULL );
+        _exit( 127 );
+    }
+
+    if( child < 0 || waitpid( child, &status, 0 ) != child )
+    {
+        return False;
+    }
+
+    return WIFEXITED( status ) && WEXITSTATUS( status ) == 0;
+}
+//
+// runSimOnce Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function runs the sim on a config and measures it
+ *
+ * @details This function runs the sim in a child process with its output
+ *          thrown away, and gets the wall time and the peak resident set
+ *          of that child alone.
+ *
+ * @pre configPath a pointer to a config written by writeRegressConfig
+ *
+ * @post the log of the run is written at post
+ *
+ * @exception badRun
+ *            If the sim cannot be started or does not exit with 0,
+ *            return False.
+ *
+ * @param[in] options a pointer to a RegressOptions struct
+ *
+ * @param[in] configPath a pointer to the path of the config
+ *
+ * @param[out] wallTime the wall time of the run in msec
+ *
+ * @param[out] peakRss the peak resident set of the run in KB
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean runSimOnce( RegressOptions *options,
+                    char *configPath,
+                    double *wallTime,
+                    long *peakRss )
+{
+    int status, nullFile;
+    long long startTime = getHostNanoSec();
+    struct rusage usage;
+    pid_t child;
+
+    fflush( stdout );
+    child = fork();
+
+    if( child == 0 )
+    {
+        nullFile = open( "/dev/null", O_WRONLY );
+        dup2( nullFile, STDOUT_FILENO );
+        execl( options->simPath, options->simPath, configPath, (char *) NULL );
+        _exit( 127 );
+    }
+
+    if( child < 0 || wait4( child, &status, 0, &usage ) != child )
+    {
+        return False;
+    }
+
+    *wallTime = ( getHostNanoSec() - startTime ) / 1000000.0;
+    *peakRss = usage.ru_maxrss;
+
+    return WIFEXITED( status ) && WEXITSTATUS( status ) == 0;
+}
+//
+// runReference Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function replays one reference and checks its log
+ *
+ * @details This function runs the reference config the asked for number
+ *          of times, keeping the best wall time and peak RSS, then compares
+ *          the log of the last run with the reference log.
+ *
+ * @par Algorithm
+ *      Non preemptive runs do not depend on when threads wake up, so their
+ *      events are compared in order and their times are checked too. So are
+ *      those of a preemptive reference made on the virtual clock when it is
+ *      replayed on it. Replayed on the real clock, interupts land at
+ *      slightly different times on every run, so only the order of each
+ *      process' own I/O and memory events is compared. A generated workload has no reference log, each
+ *      segmentation fault of its run is a difference. It is run once, and
+ *      left out of the baseline.
+ *
+ * @pre result a pointer to a RegressResult with its reference set
+ *
+ * @post result holds the outcome at post
+ *
+ * @param[in] options a pointer to a RegressOptions struct
+ *
+ * @param[out] result a pointer to a RegressResult struct
+ *
+ * @return nothing to return (void)
+ */
+void runReference( RegressOptions *options, RegressResult *result )
+{
+    char configPath[ REGRESS_PATH_SIZE ], logPath[ REGRESS_PATH_SIZE ];
+    char referencePath[ REGRESS_PATH_SIZE ], workloadPath[ REGRESS_PATH_SIZE ];
+    int rep, reps = options->reps;
+    double wallTime;
+    long peakRss;
+    LogLines reference, run;
+
+    result->ran = False;
+    result->differences = 0;
+    result->maxTimeError = 0;
+    result->wallTime = 0;
+    result->peakRss = 0;
+    result->hasBaseline = False;
+    result->slower = False;
+    result->larger = False;
+
+    printf( "%s:\n", result->reference->name );
+
+    if( writeRegressConfig( options, result->reference,
+                            configPath, logPath, workloadPath ) == False )
+    {
+        printf( "  unable to write %s\n", configPath );
+        return;
+    }
+
+    if( result->reference->generatedMemory != NULL )
+    {
+        if( runGenerator( options, result->reference, workloadPath ) == False )
+        {
+            printf( "  %s did not make %s\n", options->generatorPath,
+                    workloadPath );
+            return;
+        }
+
+        reps = 1;
+    }
+
+    for( rep = 0; rep < reps; rep++ )
+    {
+        if( runSimOnce( options, configPath, &wallTime, &peakRss ) == False )
+        {
+            printf( "  %s %s did not run\n", options->simPath, configPath );
+            return;
+        }
+
+        if( rep == 0 || wallTime < result->wallTime )
+        {
+            result->wallTime = wallTime;
+        }
+
+        if( rep == 0 || peakRss < result->peakRss )
+        {
+            result->peakRss = peakRss;
+        }
+    }
+
+    if( result->reference->generatedMemory != NULL )
+    {
+        if( readLogLines( logPath, &run ) == False )
+        {
+            printf( "  unable to read %s\n", logPath );
+            return;
+        }
+
+        result->ran = True;
+        result->differences = countSegmentFaults( &run );
+        freeLogLines( &run );
+
+        return;
+    }
+
+    snprintf( referencePath, REGRESS_PATH_SIZE, "%s/%s_Test.lgf",
+              options->refsPath, result->reference->name );
+
+    if( readLogLines( referencePath, &reference ) == False
+     || readLogLines( logPath, &run ) == False )
+    {
+        printf( "  unable to read %s or %s\n", referencePath, logPath );
+        return;
+    }
+
+    result->ran = True;
+
+    if( checkPreemptive( result->reference->code ) == True
+     && ( result->reference->virtualReference == False
+       || options->virtualClock == False ) )
+    {
+        result->differences = compareProcessEvents( &reference, &run );
+    }
+    else
+    {
+        result->differences = compareOrderedEvents( &reference, &run,
+                                                    &result->maxTimeError );
+    }
+
+    freeLogLines( &reference );
+    freeLogLines( &run );
+}
+//
+// readLogLines Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function reads a log, splitting off the timestamps
+ *
+ * @details This function reads every line of a log, keeping the time of a
+ *          "Time: <sec>, " line in msec and the text after it as the event.
+ *          Lines without a time get a time of -1.
+ *
+ * @pre lines a pointer to a LogLines struct
+ *
+ * @post lines holds the log at post, to be freed with freeLogLines
+ *
+ * @exception badFile
+ *            If the log cannot be opened, return False.
+ *
+ * @param[in] logPath a pointer to the path of the log
+ *
+ * @param[out] lines a pointer to a LogLines struct
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean readLogLines( char *logPath, LogLines *lines )
+{
+    FILE *filePointer = fopen( logPath, "r" );
+    char *line = NULL, *event;
+    size_t lineSize = 0;
+    ssize_t length;
+    double time;
+    int consumed;
+
+    lines->count = 0;
+    lines->capacity = 0;
+    lines->times = NULL;
+    lines->events = NULL;
+
+    if( filePointer == NULL )
+    {
+        return False;
+    }
+
+    while( ( length = getline( &line, &lineSize, filePointer ) ) != -1 )
+    {
+        if( length > 0 && line[ length - 1 ] == '\n' )
+        {
+            line[ length - 1 ] = NULL_TERMINAL;
+        }
+
+        consumed = 0;
+        event = line;
+        time = -1;
+
+        if( sscanf( line, "Time: %lf, %n", &time, &consumed ) == 1
+         && consumed > 0 )
+        {
+            event = &line[ consumed ];
+            time *= 1000;
+        }
+
+        if( lines->count == lines->capacity )
+        {
+            lines->capacity = lines->capacity * 2 + 64;
+            lines->times = realloc( lines->times,
+                                    sizeof( double ) * lines->capacity );
+            lines->events = realloc( lines->events,
+                                     sizeof( char * ) * lines->capacity );
+        }
+
+        lines->times[ lines->count ] = time;
+        lines->events[ lines->count ] = strdup( event );
+        lines->count++;
+    }
+
+    free( line );
+    fclose( filePointer );
+
+    return True;
+}
+//
+// freeLogLines Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees a log read by readLogLines
+ *
+ * @param[in,out] lines a pointer to a LogLines struct
+ *
+ * @return nothing to return (void)
+ */
+void freeLogLines( LogLines *lines )
+{
+    int index;
+
+    for( index = 0; index < lines->count; index++ )
+    {
+        free( lines->events[ index ] );
+    }
+
+    free( lines->events );
+    free( lines->times );
+    lines->count = 0;
+}
+//
+// compareOrderedEvents Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function compares two logs event by event
+ *
+ * @details This function compares the events of both logs in order, and
+ *          finds how far apart the times of matching events are.
+ *
+ * @param[in] reference a pointer to the reference LogLines
+ *
+ * @param[in] run a pointer to the LogLines of the run
+ *
+ * @param[out] maxTimeError the most msec a matching event was off by
+ *
+ * @return the number of events that differ (int)
+ */
+int compareOrderedEvents( LogLines *reference,
+                          LogLines *run,
+                          double *maxTimeError )
+{
+    int index, differences = 0, count = reference->count;
+    double timeError;
+
+    *maxTimeError = 0;
+
+    if( run->count > count )
+    {
+        count = run->count;
+    }
+
+    for( index = 0; index < count; index++ )
+    {
+        if( index >= reference->count || index >= run->count )
+        {
+            reportDifference( differences++,
+                              index < reference->count
+                              ? reference->events[ index ] : "(end of log)",
+                              index < run->count
+                              ? run->events[ index ] : "(end of log)" );
+        }
+        else if( strcmp( reference->events[ index ],
+                         run->events[ index ] ) != 0 )
+        {
+            reportDifference( differences++, reference->events[ index ],
+                              run->events[ index ] );
+        }
+        else
+        {
+            timeError = reference->times[ index ] - run->times[ index ];
+            timeError = timeError < 0 ? -timeError : timeError;
+
+            if( timeError > *maxTimeError )
+            {
+                *maxTimeError = timeError;
+            }
+        }
+    }
+
+    return differences;
+}
+//
+// compareProcessEvents Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function compares the events of each process of two logs
+ *
+ * @details This function compares, for each process, the I/O and memory
+ *          events logged for it, in the order they were logged.
+ *
+ * @par Algorithm
+ *      Run ops are left out, as preemption splits them at different
+ *      points, as are the OS lines, whose order depends on when each
+ *      interupt landed.
+ *
+ * @param[in] reference a pointer to the reference LogLines
+ *
+ * @param[in] run a pointer to the LogLines of the run
+ *
+ * @return the number of events that differ (int)
+ */
+int compareProcessEvents( LogLines *reference, LogLines *run )
+{
+    int process, lastProcess = -1, differences = 0;
+    int referenceIndex, runIndex;
+
+    for( referenceIndex = 0; referenceIndex < reference->count;
+                                                          referenceIndex++ )
+    {
+        process = getEventProcess( reference->events[ referenceIndex ] );
+        lastProcess = process > lastProcess ? process : lastProcess;
+    }
+
+    for( runIndex = 0; runIndex < run->count; runIndex++ )
+    {
+        process = getEventProcess( run->events[ runIndex ] );
+        lastProcess = process > lastProcess ? process : lastProcess;
+    }
+
+    for( process = 0; process <= lastProcess; process++ )
+    {
+        referenceIndex = -1;
+        runIndex = -1;
+
+        do
+        {
+            do
+            {
+                referenceIndex++;
+            }
+            while( referenceIndex < reference->count
+                && ( getEventProcess( reference->events[ referenceIndex ] )
+                                                                   != process
+                  || checkProcessEvent( reference->events[ referenceIndex ] )
+                                                                   == False ) );
+
+            do
+            {
+                runIndex++;
+            }
+            while( runIndex < run->count
+                && ( getEventProcess( run->events[ runIndex ] ) != process
+                  || checkProcessEvent( run->events[ runIndex ] ) == False ) );
+
+            if( referenceIndex < reference->count && runIndex < run->count )
+            {
+                if( strcmp( reference->events[ referenceIndex ],
+                            run->events[ runIndex ] ) != 0 )
+                {
+                    reportDifference( differences++,
+                                      reference->events[ referenceIndex ],
+                                      run->events[ runIndex ] );
+                }
+            }
+            else if( referenceIndex < reference->count
+                  || runIndex < run->count )
+            {
+                reportDifference( differences++,
+                                  referenceIndex < reference->count
+                                  ? reference->events[ referenceIndex ]
+                                  : "(no more events)",
+                                  runIndex < run->count
+                                  ? run->events[ runIndex ]
+                                  : "(no more events)" );
+            }
+        }
+        while( referenceIndex < reference->count || runIndex < run->count );
+    }
+
+    return differences;
+}
+//
+// countSegmentFaults Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function counts the segmentation faults of a run
+ *
+ * @details This function reports each fault as a difference, as a
+ *          generated workload made with no faults asked for should have
+ *          none.
+ *
+ * @param[in] run a pointer to the LogLines of the run
+ *
+ * @return the number of segmentation faults (int)
+ */
+int countSegmentFaults( LogLines *run )
+{
+    int index, faults = 0;
+
+    for( index = 0; index < run->count; index++ )
+    {
+        if( strstr( run->events[ index ], "Segmentation Fault" ) != NULL )
+        {
+            reportDifference( faults++, "(no segmentation fault)",
+                              run->events[ index ] );
+        }
+    }
+
+    return faults;
+}
+//
+// getEventProcess Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the process an event line is about
+ *
+ * @param[in] event a pointer to an event with its timestamp taken off
+ *
+ * @return the process number of a "Process N, " event, -1 otherwise (int)
+ */
+int getEventProcess( char *event )
+{
+    int process;
+
+    if( sscanf( event, "Process %d,", &process ) == 1 )
+    {
+        return process;
+    }
+
+    return -1;
+}
+//
+// checkProcessEvent Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if a process event is compared
+ *
+ * @param[in] event a pointer to a "Process N, " event
+ *
+ * @return True unless it is a run op or quantum event (Boolean)
+ */
+Boolean checkProcessEvent( char *event )
+{
+    return strstr( event, "Run operation" ) == NULL
+        && strstr( event, "quantum time out" ) == NULL;
+}
+//
+// reportDifference Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function prints a difference between the logs
+ *
+ * @details This function prints the first few differences of a log in
+ *          full, later ones are only counted.
+ *
+ * @param[in] difference the number of differences before this one
+ *
+ * @param[in] expected a pointer to the event of the reference
+ *
+ * @param[in] actual a pointer to the event of the run
+ *
+ * @return nothing to return (void)
+ */
+void reportDifference( int difference, char *expected, char *actual )
+{
+    if( difference < REGRESS_SHOWN_DIFFERENCES )
+    {
+        printf( "  expected: %s\n       got: %s\n", expected, actual );
+    }
+    else if( difference == REGRESS_SHOWN_DIFFERENCES )
+    {
+        printf( "  ...\n" );
+    }
+}
+//
+// checkPreemptive Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if a scheduling code is preemptive
+ *
+ * @param[in] code a pointer to the scheduling code
+ *
+ * @return True for a -P code, False otherwise (Boolean)
+ */
+Boolean checkPreemptive( const char *code )
+{
+    int length = stringLen( (char *) code );
+
+    return length > 2 && code[ length - 1 ] == 'P'
+                      && code[ length - 2 ] == '-';
+}
+//
+// readBaseline Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function compares the results with the saved baseline
+ *
+ * @details This function reads "<name> <wall msec> <peak KB>" lines and
+ *          marks each result that is more than the threshold percent slower
+ *          or larger than its line, and over by more than the slack.
+ *          References without a line are not gated.
+ *
+ * @exception noBaseline
+ *            If the baseline cannot be opened, return False.
+ *
+ * @pre results hold the runs of every reference
+ *
+ * @post results are marked at post
+ *
+ * @param[in] options a pointer to a RegressOptions struct
+ *
+ * @param[in,out] results a pointer to resultCount RegressResult structs
+ *
+ * @param[in] resultCount the number of results
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean readBaseline( RegressOptions *options,
+                      RegressResult *results,
+                      int resultCount )
+{
+    FILE *filePointer = fopen( options->baselinePath, "r" );
+    char name[ 32 ];
+    double wallTime, limit = 1 + options->threshold / 100;
+    long peakRss;
+    int index;
+
+    if( filePointer == NULL )
+    {
+        return False;
+    }
+
+    while( fscanf( filePointer, "%31s %lf %ld", name, &wallTime,
+                                                 &peakRss ) == 3 )
+    {
+        for( index = 0; index < resultCount; index++ )
+        {
+            if( results[ index ].ran == True
+             && stringCmp( name, (char *) results[ index ].reference->name )
+                                                                    == True )
+            {
+                results[ index ].hasBaseline = True;
+                results[ index ].baseWallTime = wallTime;
+                results[ index ].basePeakRss = peakRss;
+                results[ index ].slower = results[ index ].wallTime
+                                                        > wallTime * limit
+                                       && results[ index ].wallTime
+                                      > wallTime + REGRESS_WALL_SLACK_MSEC;
+                results[ index ].larger = results[ index ].peakRss
+                                                        > peakRss * limit
+                                       && results[ index ].peakRss
+                                            > peakRss + REGRESS_RSS_SLACK_KB;
+            }
+        }
+    }
+
+    fclose( filePointer );
+
+    return True;
+}
+//
+// writeBaseline Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function saves the results as the baseline
+ *
+ * @details Generated workloads are only checked for faults, so they are
+ *          not saved.
+ *
+ * @pre results hold the runs of every reference
+ *
+ * @post the baseline file is written at post
+ *
+ * @exception badFile
+ *            If the file cannot be written, return False.
+ *
+ * @param[in] options a pointer to a RegressOptions struct
+ *
+ * @param[in] results a pointer to resultCount RegressResult structs
+ *
+ * @param[in] resultCount the number of results
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean writeBaseline( RegressOptions *options,
+                       RegressResult *results,
+                       int resultCount )
+{
+    FILE *filePointer = fopen( options->baselinePath, "w" );
+    int index;
+
+    if( filePointer == NULL )
+    {
+        return False;
+    }
+
+    for( index = 0; index < resultCount; index++ )
+    {
+        if( results[ index ].ran == True
+         && results[ index ].reference->generatedMemory == NULL )
+        {
+            fprintf( filePointer, "%s %.3lf %ld\n",
+                     results[ index ].reference->name,
+                     results[ index ].wallTime, results[ index ].peakRss );
+        }
+    }
+
+    fclose( filePointer );
+
+    return True;
+}
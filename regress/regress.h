@@ -0,0 +1,245 @@
+// Regress Header Information ////////////////////////////////////////
+/**
+* @file regress.h
+*
+* @brief Header file for regress
+*
+* @details Specifies constants, simple data structures, included libraries,
+* and function declarations used in checking runs against the references
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of regress
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* References can give config lines of their own, and the ones made on the
+* virtual clock are compared event by event
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* Added simgen workloads, checked for segmentation faults when generated
+* with no faults asked for
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* The FCFS-P and SRTF-P references were made again on the virtual clock,
+* and a run with no baseline records one
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* The RR-P reference was made again on the virtual clock, with its quantum
+* counted across ops
+*
+* @version 1.50
+* C.S student (18 October 2026)
+* Added the CFS-P reference
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides a runner that replays every Testing_References config
+  with the sim and compares its log with the reference log. Timestamps are
+  taken off before comparing, and checked against the reference within a
+  tolerance where the run is deterministic. The wall time and peak memory of
+  each run are recorded, and compared with a saved baseline so a change
+  that makes a reference run too much slower or larger fails. Workloads
+  made by simgen with no faults asked for are run the same way, and fail
+  on any segmentation fault
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef REGRESS_H
+#define REGRESS_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "histogram.h"
+#include "stringUtils.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+static const char REGRESS_SIM_OPTION[] = "--sim";
+static const char REGRESS_GEN_OPTION[] = "--gen";
+static const char REGRESS_REFS_OPTION[] = "--refs";
+static const char REGRESS_WORK_OPTION[] = "--work";
+static const char REGRESS_CLOCK_OPTION[] = "--clock";
+static const char REGRESS_TOLERANCE_OPTION[] = "--tolerance";
+static const char REGRESS_BASELINE_OPTION[] = "--baseline";
+static const char REGRESS_THRESHOLD_OPTION[] = "--threshold";
+static const char REGRESS_REPS_OPTION[] = "--reps";
+static const char REGRESS_RECORD_OPTION[] = "--record";
+
+#define REGRESS_REFERENCE_COUNT 17
+
+// Memory the references are run with, and the generated workloads, whose
+// blocks take at most the 1000 start positions of the MMU between them
+#define REGRESS_MEMORY_KB 667
+#define REGRESS_GENERATED_MEMORY_KB 1000
+
+// Processes of each generated workload, as passed to simgen
+#define REGRESS_GENERATED_PROCESSES "100"
+
+// Longest path made from the options
+#define REGRESS_PATH_SIZE 512
+
+// Lines of a log that differ before the rest of the differences are only
+// counted
+#define REGRESS_SHOWN_DIFFERENCES 5
+
+// Virtual clock runs take a few msec, so a run is only slower or larger
+// than its baseline if it is also over by at least this much
+#define REGRESS_WALL_SLACK_MSEC 2.0
+#define REGRESS_RSS_SLACK_KB 512
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+// A reference log, named <name>_Test.lgf and made from <name>_Test.mdf
+typedef struct RegressReference
+{
+  const char *name;
+  const char *code;
+  // Config lines added to the ones every reference is run with
+  const char *extraConfig;
+  // True if the reference was made on the virtual clock, where preemptive
+  // runs are deterministic too
+  Boolean virtualReference;
+  // simgen --memory pattern of a workload generated with --faults 0 and
+  // checked for segmentation faults instead of against a log, NULL for a
+  // reference log
+  const char *generatedMemory;
+} RegressReference;
+
+static const RegressReference REGRESS_REFERENCES[ REGRESS_REFERENCE_COUNT ] =
+{
+    { "FCFS-N", "FCFS-N", "", False, NULL },
+    { "SJF-N", "SJF-N", "", False, NULL },
+    { "FCFS-P", "FCFS-P", "", True, NULL },
+    { "SRTF-P", "SRTF-P", "", True, NULL },
+    { "RR-P", "RR-P", "", True, NULL },
+    { "RR-P-Short", "RR-P", "", True, NULL },
+    { "RR-P-Adaptive", "RR-P",
+      "RR Quantum: Adaptive\n"
+      "RR Target Latency (msec): 200\n", True, NULL },
+    { "MLFQ-P", "MLFQ-P",
+      "MLFQ Quantums (cycles): 3,6,12\n"
+      "MLFQ Boost Time (msec): 300\n", True, NULL },
+    { "CFS-P", "CFS-P", "", True, NULL },
+    { "LOTTERY-P", "LOTTERY-P", "Lottery Seed: 7\n", True, NULL },
+    { "STRIDE-P", "STRIDE-P", "", True, NULL },
+    { "EDF-P", "EDF-P", "", True, NULL },
+    { "RM-P", "RM-P", "", True, NULL },
+    { "Local-FCFS-N", "FCFS-N", "", True, "local" },
+    { "Local-RR-P", "RR-P", "", True, "local" },
+    { "Scatter-FCFS-N", "FCFS-N", "", True, "scattered" },
+    { "Scatter-RR-P", "RR-P", "", True, "scattered" }
+};
+
+typedef struct RegressOptions
+{
+  char *simPath;
+  char *generatorPath;
+  char *refsPath;
+  char *workPath;
+  Boolean virtualClock;
+  // Most msec a timestamp may be off from the reference
+  double tolerance;
+  char *baselinePath;
+  // Percent slower or larger than the baseline that fails
+  double threshold;
+  int reps;
+  Boolean record;
+} RegressOptions;
+
+// The lines of a log, each split into its time and its event
+typedef struct LogLines
+{
+  double *times;
+  char **events;
+  int count;
+  int capacity;
+} LogLines;
+
+typedef struct RegressResult
+{
+  const RegressReference *reference;
+  Boolean ran;
+  int differences;
+  double maxTimeError;
+  // Best wall time of the repeats in msec, peak RSS in KB
+  double wallTime;
+  long peakRss;
+  double baseWallTime;
+  long basePeakRss;
+  Boolean hasBaseline;
+  Boolean slower;
+  Boolean larger;
+} RegressResult;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+int parseRegressArgs( int argc, char *argv[], RegressOptions *options );
+
+Boolean writeRegressConfig( RegressOptions *options,
+                            const RegressReference *reference,
+                            char *configPath,
+                            char *logPath,
+                            char *workloadPath );
+
+Boolean runGenerator( RegressOptions *options,
+                      const RegressReference *reference,
+                      char *workloadPath );
+
+Boolean runSimOnce( RegressOptions *options,
+                    char *configPath,
+                    double *wallTime,
+                    long *peakRss );
+
+void runReference( RegressOptions *options, RegressResult *result );
+
+Boolean readLogLines( char *logPath, LogLines *lines );
+
+void freeLogLines( LogLines *lines );
+
+int compareOrderedEvents( LogLines *reference,
+                          LogLines *run,
+                          double *maxTimeError );
+
+int compareProcessEvents( LogLines *reference, LogLines *run );
+
+int countSegmentFaults( LogLines *run );
+
+int getEventProcess( char *event );
+
+Boolean checkProcessEvent( char *event );
+
+void reportDifference( int difference, char *expected, char *actual );
+
+Boolean checkPreemptive( const char *code );
+
+Boolean readBaseline( RegressOptions *options,
+                      RegressResult *results,
+                      int resultCount );
+
+Boolean writeBaseline( RegressOptions *options,
+                       RegressResult *results,
+                       int resultCount );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // REGRESS_H
+//
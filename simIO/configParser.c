@@ -10,6 +10,67 @@
 * C.S student (29 January 2018)
 * Initial creation of configParser
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Added optional "Key: value" lines before the end line
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* Added the Process Metrics and Metrics File Path settings
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* Added the Histogram File Prefix setting
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* Added the Trace log target
+*
+* @version 1.50
+* C.S student (18 October 2026)
+* Added the Runtime Counters setting
+*
+* @version 1.60
+* C.S student (18 October 2026)
+* Added the Stats Socket setting
+*
+* @version 1.70
+* C.S student (18 October 2026)
+* Added the MLFQ-P code and its MLFQ Quantums and MLFQ Boost Time settings
+*
+* @version 1.80
+* C.S student (18 October 2026)
+* Added the CFS-P code and its CFS Target Latency and CFS Min Granularity
+* settings
+*
+* @version 1.90
+* C.S student (18 October 2026)
+* Added the LOTTERY-P and STRIDE-P codes and the Lottery Seed setting
+*
+* @version 2.00
+* C.S student (18 October 2026)
+* Added the EDF-P and RM-P codes
+*
+* @version 2.10
+* C.S student (18 October 2026)
+* Added the Burst Prediction, Burst Alpha and Burst Initial Tau settings
+*
+* @version 2.20
+* C.S student (18 October 2026)
+* Added the RR Quantum and RR Target Latency settings
+*
+* @version 2.30
+* C.S student (18 October 2026)
+* Added the Aging Rate setting
+*
+* @version 2.40
+* C.S student (18 October 2026)
+* Added the Context Switch, Cache Refill and Cache Decay settings
+*
+* @version 2.50
+* C.S student (18 October 2026)
+* Added the Channels and Cycle Time settings of each I/O device
+*
 * @note Requires configParser.h
 */
 
@@ -22,7 +83,37 @@ const char *cpuSchedCodeLookUp[] =
     [2] = "SJF-N",
     [3] = "SRTF-P",
     [4] = "FCFS-P",
-    [5] = "RR-P"
+    [5] = "RR-P",
+    [6] = "MLFQ-P",
+    [7] = "CFS-P",
+    [8] = "LOTTERY-P",
+    [9] = "STRIDE-P",
+    [10] = "EDF-P",
+    [11] = "RM-P"
+};
+
+const char *deviceNameLookUp[ DEVICE_COUNT ] =
+{
+    [0] = "hard drive",
+    [1] = "keyboard",
+    [2] = "printer",
+    [3] = "monitor"
+};
+
+const char *deviceChannelsLookUp[ DEVICE_COUNT ] =
+{
+    [0] = "Hard Drive Channels",
+    [1] = "Keyboard Channels",
+    [2] = "Printer Channels",
+    [3] = "Monitor Channels"
+};
+
+const char *deviceCycleTimeLookUp[ DEVICE_COUNT ] =
+{
+    [0] = "Hard Drive Cycle Time (msec)",
+    [1] = "Keyboard Cycle Time (msec)",
+    [2] = "Printer Cycle Time (msec)",
+    [3] = "Monitor Cycle Time (msec)"
 };
 
 //
@@ -97,9 +188,7 @@ struct ConfigData *readConfig( FILE *filePointer )
     cfData->logFilePath = getStrLine( filePointer,
                                       LOG_FILE_PATH_EXPECTED );
 
-    validEnd = removeExpectedLine( filePointer,
-                                   CONFIG_END_LINE_EXPECTED,
-                                   NEW_LINE );
+    validEnd = readOptionalLines( filePointer, cfData );
 
     if ( checkConfig( cfData ) == False
         || validStart == False
@@ -131,6 +220,7 @@ struct ConfigData *readConfig( FILE *filePointer )
 ConfigData *createConfig()
 {
   ConfigData *cfData = malloc( sizeof( *cfData ) );
+  int device;
   cfData->versionPhase = -1;
   cfData->filePath = "BAD";
   cfData->cpuSchedCode = "BAD";
@@ -140,6 +230,34 @@ ConfigData *createConfig()
   cfData->ioCycleTime = -1;
   cfData->logTo = "BAD";
   cfData->logFilePath = "BAD";
+  cfData->streamWorkload = False;
+  cfData->virtualClock = False;
+  cfData->logMetrics = False;
+  cfData->metricsFilePath = NULL;
+  cfData->histogramFilePrefix = NULL;
+  cfData->dumpCounters = False;
+  cfData->statsSocketPath = NULL;
+  cfData->mlfqLevels = 0;
+  cfData->mlfqBoostTime = -1;
+  cfData->cfsTargetLatency = CFS_DEFAULT_TARGET_LATENCY;
+  cfData->cfsMinGranularity = CFS_DEFAULT_MIN_GRANULARITY;
+  cfData->lotterySeed = 1;
+  cfData->burstPrediction = False;
+  cfData->burstAlpha = BURST_DEFAULT_ALPHA;
+  cfData->burstInitialTau = BURST_DEFAULT_INITIAL_TAU;
+  cfData->rrAdaptive = False;
+  cfData->rrTargetLatency = 0;
+  cfData->agingRate = 0;
+  cfData->contextSwitchCycles = 0;
+  cfData->cacheRefillCycles = 0;
+  cfData->cacheDecayCycles = 0;
+
+  for( device = 0; device < DEVICE_COUNT; device++ )
+  {
+      cfData->deviceChannels[ device ] = 0;
+      cfData->deviceCycleTimes[ device ] = 0;
+  }
+
   return cfData;
 }
 //
@@ -196,6 +314,9 @@ Boolean freeConfig( ConfigData *cfData )
         free( cfData->logFilePath );
     }
 
+    free( cfData->metricsFilePath );
+    free( cfData->histogramFilePrefix );
+    free( cfData->statsSocketPath );
     free( cfData );
 
     return True;
@@ -290,6 +411,8 @@ Boolean checkConfig( ConfigData *cfData )
  */
 Boolean displayConfig( ConfigData *config )
 {
+    int iterator;
+
     if (config == NULL)
     {
         return False;
@@ -306,6 +429,56 @@ Boolean displayConfig( ConfigData *config )
     printf( "I/O cycle rate     : %d\n", config->ioCycleTime );
     printf( "Log to code        : %s\n", config->logTo );
     printf( "Log file name      : %s\n", config->logFilePath );
+    printf( "Stream workload    : %s\n",
+            config->streamWorkload == True ? "Yes" : "No" );
+    printf( "Virtual clock      : %s\n",
+            config->virtualClock == True ? "Yes" : "No" );
+    printf( "Process metrics    : %s\n",
+            config->logMetrics == True ? "Summary" : "None" );
+    printf( "Metrics file name  : %s\n",
+            config->metricsFilePath != NULL ? config->metricsFilePath
+                                            : "None" );
+    printf( "Histogram prefix   : %s\n",
+            config->histogramFilePrefix != NULL ? config->histogramFilePrefix
+                                                : "None" );
+    printf( "Runtime counters   : %s\n",
+            config->dumpCounters == True ? "On" : "Off" );
+    printf( "Stats socket       : %s\n",
+            config->statsSocketPath != NULL ? config->statsSocketPath
+                                            : "None" );
+    printf( "MLFQ quantums      :" );
+
+    for( iterator = 0; iterator < config->mlfqLevels; iterator++ )
+    {
+        printf( "%s%d", iterator > 0 ? "," : " ",
+                config->mlfqQuantums[ iterator ] );
+    }
+
+    printf( "%s\n", config->mlfqLevels == 0 ? " Default" : "" );
+    printf( "MLFQ boost time    : %d\n", config->mlfqBoostTime );
+    printf( "CFS target latency : %d\n", config->cfsTargetLatency );
+    printf( "CFS min granularity: %d\n", config->cfsMinGranularity );
+    printf( "Lottery seed       : %d\n", config->lotterySeed );
+    printf( "Burst prediction   : %s\n",
+            config->burstPrediction == True ? "Exponential" : "Oracle" );
+    printf( "Burst alpha        : %d\n", config->burstAlpha );
+    printf( "Burst initial tau  : %d\n", config->burstInitialTau );
+    printf( "RR quantum         : %s\n",
+            config->rrAdaptive == True ? "Adaptive" : "Fixed" );
+    printf( "RR target latency  : %d\n", config->rrTargetLatency );
+    printf( "Aging rate         : %d\n", config->agingRate );
+    printf( "Context switch     : %d\n", config->contextSwitchCycles );
+    printf( "Cache refill       : %d\n", config->cacheRefillCycles );
+    printf( "Cache decay        : %d\n", config->cacheDecayCycles );
+
+    for( iterator = 0; iterator < DEVICE_COUNT; iterator++ )
+    {
+        printf( "%-19s: %d channels, %d msec/cycle\n",
+                deviceNameLookUp[ iterator ],
+                config->deviceChannels[ iterator ],
+                config->deviceCycleTimes[ iterator ] );
+    }
+
     return True;
 }
 //
@@ -616,7 +789,7 @@ Boolean cpuSchedCodeCheck(  char *code )
 {
     int iterator;
 
-    for( iterator = 5; iterator >= 0; iterator-- )
+    for( iterator = CPU_SCHED_CODE_COUNT - 1; iterator >= 0; iterator-- )
     {
         if( cmpExpected( code, cpuSchedCodeLookUp[ iterator ] ) == 0 )
         {
@@ -702,7 +875,7 @@ char *getLogTo( FILE *filePointer )
  * @post type remains the same on post
  *
  * @par Algorithm
- *      The algorithm checks the given type against the three possible types.
+ *      The algorithm checks the given type against the four possible types.
  *
  * @exception badType
  *            If the type is not a logging type, immediately return -1.
@@ -715,11 +888,604 @@ Boolean logToCodeCheck( char *type)
 {
     if( stringCmp( type, "Both" ) == True
      || stringCmp( type, "Monitor" ) == True
-     || stringCmp( type, "File" ) == True )
+     || stringCmp( type, "File" ) == True
+     || stringCmp( type, "Trace" ) == True )
     {
         return True;
     }
 
     printf( "Bad Log To code: %s\n", type );
+    return False;
+}//
+// readOptionalLines Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function reads the optional settings of a config file
+ *
+ * @details This function reads "Key: value" lines after the Log File Path
+ *          line until the end line is found. Blank lines are skipped.
+ *
+ * @pre filePointer a pointer to a file, positioned after Log File Path
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @post filePointer now points past the end line
+ *
+ * @post cfData holds any optional settings that were found
+ *
+ * @exception missingEnd
+ *            If the file ends before the end line, return False.
+ *
+ * @exception badSetting
+ *            If any optional line is unknown or malformed, return False.
+ *
+ * @param[in] filePointer a pointer to a configuration file
+ *
+ * @param[out] cfData a pointer to a ConfigData struct
+ *
+ * @return True if every optional line and the end line were valid (Boolean)
+ */
+Boolean readOptionalLines( FILE *filePointer, ConfigData *cfData )
+{
+    Boolean validLines = True;
+    char *fileLinePtr, *keyPtr, *valuePtr;
+
+    while( True )
+    {
+        fileLinePtr = extractLine( filePointer );
+
+        if( fileLinePtr[ 0 ] == END_OF_FILE )
+        {
+            free( fileLinePtr );
+            printf( "%s line is missing.\n", CONFIG_END_LINE_EXPECTED );
+            return False;
+        }
+
+        if( checkExtractedLine( fileLinePtr,
+                                CONFIG_END_LINE_EXPECTED,
+                                NEW_LINE ) == True )
+        {
+            free( fileLinePtr );
+            return validLines;
+        }
+
+        if( fileLinePtr[ 0 ] != NEW_LINE )
+        {
+            keyPtr = stringSplitBefore( fileLinePtr, ':' );
+            valuePtr = stringSplitAfter( fileLinePtr, ':' );
+
+            if( setOptionalValue( cfData, keyPtr, valuePtr ) == False )
+            {
+                validLines = False;
+            }
+
+            free( keyPtr );
+        }
+
+        free( fileLinePtr );
+    }
+}
+//
+// setOptionalValue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function stores one optional setting in a config
+ *
+ * @details This function matches a key against the known optional settings
+ *          and stores its value in the configuration struct.
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @pre key a pointer to the left side of an optional line
+ *
+ * @pre value a malloc'd pointer to the right side of an optional line
+ *
+ * @post value is either owned by cfData or freed at post
+ *
+ * @exception badKey
+ *            If the key is not a known setting, return False.
+ *
+ * @exception badValue
+ *            If the value is not valid for the key, return False.
+ *
+ * @param[out] cfData a pointer to a ConfigData struct
+ *
+ * @param[in] key a pointer to the setting name
+ *
+ * @param[in] value a pointer to the setting value
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean setOptionalValue( ConfigData *cfData, char *key, char *value )
+{
+    Boolean isValid = True;
+
+    if( stringCmp( key, (char *) WORKLOAD_INGESTION_EXPECTED ) == True )
+    {
+        if( stringCmp( value, "Stream" ) == True )
+        {
+            cfData->streamWorkload = True;
+        }
+        else if( stringCmp( value, "Batch" ) == True )
+        {
+            cfData->streamWorkload = False;
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) SIMULATION_CLOCK_EXPECTED ) == True )
+    {
+        if( stringCmp( value, "Virtual" ) == True )
+        {
+            cfData->virtualClock = True;
+        }
+        else if( stringCmp( value, "Real" ) == True )
+        {
+            cfData->virtualClock = False;
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) PROCESS_METRICS_EXPECTED ) == True )
+    {
+        if( stringCmp( value, "Summary" ) == True )
+        {
+            cfData->logMetrics = True;
+        }
+        else if( stringCmp( value, "None" ) == True )
+        {
+            cfData->logMetrics = False;
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) RUNTIME_COUNTERS_EXPECTED ) == True )
+    {
+        if( stringCmp( value, "On" ) == True )
+        {
+            cfData->dumpCounters = True;
+        }
+        else if( stringCmp( value, "Off" ) == True )
+        {
+            cfData->dumpCounters = False;
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) MLFQ_QUANTUMS_EXPECTED ) == True )
+    {
+        isValid = setMlfqQuantums( cfData, value );
+    }
+    else if( stringCmp( key, (char *) MLFQ_BOOST_TIME_EXPECTED ) == True )
+    {
+        if( value[ 0 ] != '\0' && checkInt( value ) == True )
+        {
+            cfData->mlfqBoostTime = stringToI( value );
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) LOTTERY_SEED_EXPECTED ) == True )
+    {
+        if( value[ 0 ] != '\0' && checkInt( value ) == True )
+        {
+            cfData->lotterySeed = stringToI( value );
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) BURST_PREDICTION_EXPECTED ) == True )
+    {
+        if( stringCmp( value, "Exponential" ) == True )
+        {
+            cfData->burstPrediction = True;
+        }
+        else if( stringCmp( value, "Oracle" ) == True )
+        {
+            cfData->burstPrediction = False;
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) BURST_ALPHA_EXPECTED ) == True )
+    {
+        if( value[ 0 ] != '\0' && checkInt( value ) == True
+         && stringToI( value ) >= 0 && stringToI( value ) <= 100 )
+        {
+            cfData->burstAlpha = stringToI( value );
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) BURST_INITIAL_TAU_EXPECTED ) == True )
+    {
+        if( value[ 0 ] != '\0' && checkInt( value ) == True
+         && stringToI( value ) >= 0 )
+        {
+            cfData->burstInitialTau = stringToI( value );
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) RR_QUANTUM_EXPECTED ) == True )
+    {
+        if( stringCmp( value, "Adaptive" ) == True )
+        {
+            cfData->rrAdaptive = True;
+        }
+        else if( stringCmp( value, "Fixed" ) == True )
+        {
+            cfData->rrAdaptive = False;
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) RR_TARGET_LATENCY_EXPECTED ) == True )
+    {
+        if( value[ 0 ] != '\0' && checkInt( value ) == True )
+        {
+            cfData->rrTargetLatency = stringToI( value );
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) AGING_RATE_EXPECTED ) == True )
+    {
+        if( value[ 0 ] != '\0' && checkInt( value ) == True )
+        {
+            cfData->agingRate = stringToI( value );
+        }
+        else
+        {
+            isValid = False;
+        }
+    }
+    else if( stringCmp( key, (char *) CONTEXT_SWITCH_EXPECTED ) == True
+          || stringCmp( key, (char *) CACHE_REFILL_EXPECTED ) == True
+          || stringCmp( key, (char *) CACHE_DECAY_EXPECTED ) == True )
+    {
+        if( value[ 0 ] == '\0' || checkInt( value ) == False )
+        {
+            isValid = False;
+        }
+        else if( stringCmp( key, (char *) CONTEXT_SWITCH_EXPECTED ) == True )
+        {
+            cfData->contextSwitchCycles = stringToI( value );
+        }
+        else if( stringCmp( key, (char *) CACHE_REFILL_EXPECTED ) == True )
+        {
+            cfData->cacheRefillCycles = stringToI( value );
+        }
+        else
+        {
+            cfData->cacheDecayCycles = stringToI( value );
+        }
+    }
+    else if( checkDeviceKey( key ) == True )
+    {
+        isValid = setDeviceValue( cfData, key, value );
+    }
+    else if( stringCmp( key, (char *) CFS_TARGET_LATENCY_EXPECTED ) == True
+          || stringCmp( key, (char *) CFS_MIN_GRANULARITY_EXPECTED ) == True )
+    {
+        if( value[ 0 ] == '\0' || checkInt( value ) == False
+         || stringToI( value ) <= 0 )
+        {
+            isValid = False;
+        }
+        else if( stringCmp( key, (char *) CFS_TARGET_LATENCY_EXPECTED ) )
+        {
+            cfData->cfsTargetLatency = stringToI( value );
+        }
+        else
+        {
+            cfData->cfsMinGranularity = stringToI( value );
+        }
+    }
+    else if( stringCmp( key, (char *) METRICS_FILE_PATH_EXPECTED ) == True
+          || stringCmp( key, (char *) HISTOGRAM_FILE_PREFIX_EXPECTED ) == True
+          || stringCmp( key, (char *) STATS_SOCKET_EXPECTED ) == True )
+    {
+        return setOptionalPath( cfData, key, value );
+    }
+    else
+    {
+        printf( "Unknown setting %s\n", key );
+        free( value );
+        return False;
+    }
+
+    if( isValid == False )
+    {
+        printf( "Malformed input data or line for %s\n", key );
+    }
+
+    free( value );
+    return isValid;
+}
+//
+// setOptionalPath Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function stores one optional file path in a config
+ *
+ * @details This function stores the value of a Metrics File Path or
+ *          Histogram File Prefix line, replacing any earlier one.
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @pre key a pointer to the name of a path setting
+ *
+ * @pre value a malloc'd pointer to the right side of an optional line
+ *
+ * @post value is either owned by cfData or freed at post
+ *
+ * @exception badValue
+ *            If the path is empty, return False.
+ *
+ * @param[out] cfData a pointer to a ConfigData struct
+ *
+ * @param[in] key a pointer to the setting name
+ *
+ * @param[in] value a pointer to the setting value
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean setOptionalPath( ConfigData *cfData, char *key, char *value )
+{
+    char **pathPtr = &cfData->metricsFilePath;
+
+    if( value[ 0 ] == '\0' )
+    {
+        printf( "Malformed input data or line for %s\n", key );
+        free( value );
+        return False;
+    }
+
+    if( stringCmp( key, (char *) HISTOGRAM_FILE_PREFIX_EXPECTED ) == True )
+    {
+        pathPtr = &cfData->histogramFilePrefix;
+    }
+    else if( stringCmp( key, (char *) STATS_SOCKET_EXPECTED ) == True )
+    {
+        pathPtr = &cfData->statsSocketPath;
+    }
+
+    free( *pathPtr );
+    *pathPtr = value;
+
+    return True;
+}
+//
+// setMlfqQuantums Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function stores the MLFQ-P quantum of each level in a config
+ *
+ * @details This function reads a comma separated list of cycle counts, one
+ *          for each level from the top level down, such as "5,10,20".
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @pre value a pointer to the right side of an MLFQ Quantums line
+ *
+ * @post cfData holds the levels at post if True is returned
+ *
+ * @exception badValue
+ *            If a quantum is missing or not a positive number, or there are
+ *            more than MLFQ_MAX_LEVELS, return False.
+ *
+ * @param[out] cfData a pointer to a ConfigData struct
+ *
+ * @param[in] value a pointer to the setting value
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean setMlfqQuantums( ConfigData *cfData, char *value )
+{
+    int iterator = 0, levels = 0, quantum = 0;
+    int quantums[ MLFQ_MAX_LEVELS ];
+    Boolean hasDigit = False;
+
+    do
+    {
+        if( '0' <= value[ iterator ] && value[ iterator ] <= '9' )
+        {
+            quantum = quantum * 10 + value[ iterator ] - '0';
+            hasDigit = True;
+        }
+        else if( value[ iterator ] == ',' || value[ iterator ] == '\0' )
+        {
+            if( hasDigit == False || quantum <= 0
+             || levels == MLFQ_MAX_LEVELS )
+            {
+                return False;
+            }
+
+            quantums[ levels ] = quantum;
+            levels++;
+            quantum = 0;
+            hasDigit = False;
+        }
+        else if( value[ iterator ] != ' ' )
+        {
+            return False;
+        }
+    }
+    while( value[ iterator++ ] != '\0' );
+
+    for( iterator = 0; iterator < levels; iterator++ )
+    {
+        cfData->mlfqQuantums[ iterator ] = quantums[ iterator ];
+    }
+
+    cfData->mlfqLevels = levels;
+
+    return True;
+}
+//
+// checkDeviceKey Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if a setting belongs to an I/O device
+ *
+ * @param[in] key a pointer to the left side of an optional line
+ *
+ * @return True if the key is a Channels or Cycle Time setting of a device,
+ *         False otherwise (Boolean)
+ */
+Boolean checkDeviceKey( char *key )
+{
+    int device;
+
+    for( device = 0; device < DEVICE_COUNT; device++ )
+    {
+        if( stringCmp( key, (char *) deviceChannelsLookUp[ device ] ) == True
+         || stringCmp( key, (char *) deviceCycleTimeLookUp[ device ] ) == True )
+        {
+            return True;
+        }
+    }
+
+    return False;
+}
+//
+// setDeviceValue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function stores the channels or cycle time of an I/O device
+ *
+ * @pre key a pointer to a key checkDeviceKey accepts
+ *
+ * @post cfData holds the value at post if True is returned
+ *
+ * @exception badValue
+ *            If the value is not a number in the range of the setting,
+ *            return False.
+ *
+ * @param[out] cfData a pointer to a ConfigData struct
+ *
+ * @param[in] key a pointer to the left side of an optional line
+ *
+ * @param[in] value a pointer to the setting value
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean setDeviceValue( ConfigData *cfData, char *key, char *value )
+{
+    int device, number;
+
+    if( value[ 0 ] == '\0' || checkInt( value ) == False )
+    {
+        return False;
+    }
+
+    number = stringToI( value );
+
+    for( device = 0; device < DEVICE_COUNT; device++ )
+    {
+        if( stringCmp( key, (char *) deviceChannelsLookUp[ device ] ) == True )
+        {
+            if( number < DEVICE_CHANNELS_MIN || number > DEVICE_CHANNELS_MAX )
+            {
+                return False;
+            }
+
+            cfData->deviceChannels[ device ] = number;
+        }
+        else if( stringCmp( key,
+                            (char *) deviceCycleTimeLookUp[ device ] ) == True )
+        {
+            if( number < IO_CYCLE_TIME_MIN || number > IO_CYCLE_TIME_MAX )
+            {
+                return False;
+            }
+
+            cfData->deviceCycleTimes[ device ] = number;
+        }
+    }
+
+    return True;
+}
+//
+// getDeviceIndex Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function finds the I/O device of an op
+ *
+ * @param[in] opString a pointer to the op string of an I or O op
+ *
+ * @return the index of the device in deviceNameLookUp, or -1 if the op is
+ *         on no known device (int)
+ */
+int getDeviceIndex( char *opString )
+{
+    int device;
+
+    for( device = 0; device < DEVICE_COUNT; device++ )
+    {
+        if( stringCmp( opString, (char *) deviceNameLookUp[ device ] ) == True )
+        {
+            return device;
+        }
+    }
+
+    return -1;
+}
+//
+// checkDeviceQueues Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if any I/O device has a channel count
+ *
+ * @details Without one every I/O op runs at once, as if each device had as
+ *          many channels as ops started on it.
+ *
+ * @param[in] cfData a pointer to a ConfigData struct
+ *
+ * @return True if I/O ops can wait for a device, False otherwise (Boolean)
+ */
+Boolean checkDeviceQueues( ConfigData *cfData )
+{
+    int device;
+
+    for( device = 0; device < DEVICE_COUNT; device++ )
+    {
+        if( cfData->deviceChannels[ device ] > 0 )
+        {
+            return True;
+        }
+    }
+
     return False;
 }
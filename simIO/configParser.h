@@ -11,6 +11,63 @@
 * C.S student (29 January 2018)
 * Initial creation of configParser
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Added optional "Key: value" lines before the end line
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* Added the Process Metrics and Metrics File Path settings
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* Added the Histogram File Prefix setting
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* Added the Runtime Counters setting
+*
+* @version 1.50
+* C.S student (18 October 2026)
+* Added the Stats Socket setting
+*
+* @version 1.60
+* C.S student (18 October 2026)
+* Added the MLFQ-P code and its MLFQ Quantums and MLFQ Boost Time settings
+*
+* @version 1.70
+* C.S student (18 October 2026)
+* Added the CFS-P code and its CFS Target Latency and CFS Min Granularity
+* settings
+*
+* @version 1.80
+* C.S student (18 October 2026)
+* Added the LOTTERY-P and STRIDE-P codes and the Lottery Seed setting
+*
+* @version 1.90
+* C.S student (18 October 2026)
+* Added the EDF-P and RM-P codes
+*
+* @version 2.00
+* C.S student (18 October 2026)
+* Added the Burst Prediction, Burst Alpha and Burst Initial Tau settings
+*
+* @version 2.10
+* C.S student (18 October 2026)
+* Added the RR Quantum and RR Target Latency settings
+*
+* @version 2.20
+* C.S student (18 October 2026)
+* Added the Aging Rate setting
+*
+* @version 2.30
+* C.S student (18 October 2026)
+* Added the Context Switch, Cache Refill and Cache Decay settings
+*
+* @version 2.40
+* C.S student (18 October 2026)
+* Added the Channels and Cycle Time settings of each I/O device
+*
 * @note None
 */
 
@@ -65,7 +122,58 @@ static const char LOG_TO_EXPECTED[] = "Log To";
 
 static const char LOG_FILE_PATH_EXPECTED[] = "Log File Path";
 
+// Optional settings, given as "Key: value" lines before the end line
+static const char WORKLOAD_INGESTION_EXPECTED[] = "Workload Ingestion";
+static const char SIMULATION_CLOCK_EXPECTED[] = "Simulation Clock";
+static const char PROCESS_METRICS_EXPECTED[] = "Process Metrics";
+static const char METRICS_FILE_PATH_EXPECTED[] = "Metrics File Path";
+static const char HISTOGRAM_FILE_PREFIX_EXPECTED[] = "Histogram File Prefix";
+static const char RUNTIME_COUNTERS_EXPECTED[] = "Runtime Counters";
+static const char STATS_SOCKET_EXPECTED[] = "Stats Socket";
+static const char MLFQ_QUANTUMS_EXPECTED[] = "MLFQ Quantums (cycles)";
+static const char MLFQ_BOOST_TIME_EXPECTED[] = "MLFQ Boost Time (msec)";
+static const char CFS_TARGET_LATENCY_EXPECTED[] = "CFS Target Latency (msec)";
+static const char CFS_MIN_GRANULARITY_EXPECTED[] = "CFS Min Granularity (msec)";
+static const char LOTTERY_SEED_EXPECTED[] = "Lottery Seed";
+static const char BURST_PREDICTION_EXPECTED[] = "Burst Prediction";
+static const char BURST_ALPHA_EXPECTED[] = "Burst Alpha (%)";
+static const char BURST_INITIAL_TAU_EXPECTED[] = "Burst Initial Tau (msec)";
+static const char RR_QUANTUM_EXPECTED[] = "RR Quantum";
+static const char RR_TARGET_LATENCY_EXPECTED[] = "RR Target Latency (msec)";
+static const char AGING_RATE_EXPECTED[] = "Aging Rate (%)";
+static const char CONTEXT_SWITCH_EXPECTED[] = "Context Switch (cycles)";
+static const char CACHE_REFILL_EXPECTED[] = "Cache Refill (cycles)";
+static const char CACHE_DECAY_EXPECTED[] = "Cache Decay (cycles)";
+static const int DEVICE_CHANNELS_MIN = 0;
+static const int DEVICE_CHANNELS_MAX = 64;
+
+// Most MLFQ-P queue levels, and the levels used when none are given
+#define MLFQ_MAX_LEVELS 8
+#define MLFQ_DEFAULT_LEVELS 3
+
+// Msec in which CFS-P runs every ready process once, and the shortest slice
+// it gives when there are too many to fit
+#define CFS_DEFAULT_TARGET_LATENCY 200
+#define CFS_DEFAULT_MIN_GRANULARITY 25
+
+// Weight in percent of the last CPU burst in each new prediction, and the
+// msec predicted for a process before its first burst
+#define BURST_DEFAULT_ALPHA 50
+#define BURST_DEFAULT_INITIAL_TAU 100
+
+// Longest adaptive RR-P quantum as a multiple of the Quantum Time, when no
+// RR Target Latency bounds it
+#define RR_ADAPTIVE_MAX_SCALE 8
+
 extern const char *cpuSchedCodeLookUp[];
+static const int CPU_SCHED_CODE_COUNT = 12;
+
+// I/O devices with a request queue each, by the op string of their ops,
+// and the "<Device> Channels" and "<Device> Cycle Time (msec)" settings
+#define DEVICE_COUNT 4
+extern const char *deviceNameLookUp[];
+extern const char *deviceChannelsLookUp[];
+extern const char *deviceCycleTimeLookUp[];
 //
 // Data Structure Definitions (structs, enums, etc.)////////////////
 //
@@ -80,6 +188,53 @@ typedef struct ConfigData
   int ioCycleTime;
   char *logTo;
   char *logFilePath;
+  Boolean streamWorkload;
+  Boolean virtualClock;
+  Boolean logMetrics;
+  // NULL unless the metrics of each run are written to a file
+  char *metricsFilePath;
+  // NULL unless latency histograms are written to <prefix>_<name>.hgrm
+  char *histogramFilePrefix;
+  // Runtime counters are written to stderr when the run ends
+  Boolean dumpCounters;
+  // NULL unless the progress of the run is served on this Unix socket
+  char *statsSocketPath;
+  // MLFQ-P quantum of each level in cycles, top level first. 0 levels
+  // means the Quantum Time doubled at each of MLFQ_DEFAULT_LEVELS levels
+  int mlfqLevels;
+  int mlfqQuantums[ MLFQ_MAX_LEVELS ];
+  // Msec between MLFQ-P boosts to the top level, 0 for never and -1 for
+  // the default
+  int mlfqBoostTime;
+  // CFS-P scheduling period and shortest slice in msec
+  int cfsTargetLatency;
+  int cfsMinGranularity;
+  // Seed of the LOTTERY-P draws, the same seed draws the same tickets
+  int lotterySeed;
+  // SJF-N and SRTF-P pick by predicted CPU bursts instead of the known
+  // process times, each prediction weighting the last burst by burstAlpha
+  // percent and the prediction before it by the rest
+  Boolean burstPrediction;
+  int burstAlpha;
+  int burstInitialTau;
+  // RR-P gives each process a quantum that covers its predicted CPU burst,
+  // at least the Quantum Time, and shares the target latency between the
+  // ready processes if one is given (0 for none)
+  Boolean rrAdaptive;
+  int rrTargetLatency;
+  // Percent of each msec a process waits in the Ready state that SJF-N and
+  // SRTF-P take off its time when picking, 0 for no aging
+  int agingRate;
+  // Cycles every dispatch costs, and the extra cycles a process pays to
+  // refill a cold cache, which is fully cold once others ran the decay
+  // cycles since it last ran (0 for at once)
+  int contextSwitchCycles;
+  int cacheRefillCycles;
+  int cacheDecayCycles;
+  // Ops each device serves at once, 0 for as many as are started, and the
+  // msec of each of its cycles, 0 for the I/O Cycle Time
+  int deviceChannels[ DEVICE_COUNT ];
+  int deviceCycleTimes[ DEVICE_COUNT ];
 } ConfigData;
 //
 // Free Function Prototypes ///////////////////////////////////////
@@ -111,6 +266,22 @@ Boolean cpuSchedCodeCheck( char *code );
 char *getLogTo( FILE *filePointer );
 
 Boolean logToCodeCheck( char *type );
+
+Boolean readOptionalLines( FILE *filePointer, ConfigData *cfData );
+
+Boolean setOptionalValue( ConfigData *cfData, char *key, char *value );
+
+Boolean setOptionalPath( ConfigData *cfData, char *key, char *value );
+
+Boolean setMlfqQuantums( ConfigData *cfData, char *value );
+
+Boolean checkDeviceKey( char *key );
+
+Boolean setDeviceValue( ConfigData *cfData, char *key, char *value );
+
+int getDeviceIndex( char *opString );
+
+Boolean checkDeviceQueues( ConfigData *cfData );
 //
 // Terminating Precompiler Directives ///////////////////////////////
 //
@@ -10,6 +10,11 @@
 * C.S student (30 January 2018)
 * Initial creation of metadataParser
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Factored out readMetaComponent and added MetaStream for reading a
+* workload one process block at a time
+*
 * @note Requires metadataParser.h
 */
 
@@ -33,13 +38,16 @@
  *      it is it begins parsing the metadata.
  *
  * @par Algorithm
- *      It begins reading and placing characters into a string until it
- *      hits a semicolon (;). This indicates that it has read a metadata
- *      component that needs to be parsed.
+ *      It reads one metadata component at a time with readMetaComponent,
+ *      a component ends at a semicolon (;).
+ *
+ * @par Algorithm
+ *      An open brace '{' or close brace '}' also ends a component, these
+ *      bracket the body of an R(count){ ... } repeat block. The body is only
+ *      stored once, it is expanded as processes run.
  *
  * @par Algorithm
- *      After extracting the node, it adds it to the linked list, then resets
- *      the string to read in the next component of metadata.
+ *      After extracting the node, it adds it to the linked list.
  *
  * @par Algorithm
  *      This repeats until either the end of the file is reached or a period
@@ -76,12 +84,69 @@ MetaNode *readMetadata( FILE *filePointer )
     }
 
     MetaNode *currentNode = NULL;
+    MetaNode *newNode = NULL;
+    char terminator = NULL_TERMINAL;
+
+    do
+    {
+        newNode = readMetaComponent( filePointer, &terminator );
+
+        if ( newNode == NULL )
+        {
+          freeList( currentNode );
+          return NULL;
+        }
+
+        currentNode = addNode( currentNode, newNode );
+    }
+    while( terminator != '.' && terminator != END_OF_FILE );
+
+    fgetc( filePointer );
+    validEndLine = removeExpectedLine( filePointer, META_END_LINE_EXPECTED, '.' );
+
+    if( validEndLine == False )
+    {
+        printf( "Bad end line in metadata file.\n" );
+        freeList( currentNode );
+        return NULL;
+    }
+    return currentNode;
+}
+//
+// readMetaComponent Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function reads one metadata component from a file
+ *
+ * @details This function reads characters until a component terminator
+ *          and parses what was read into a single MetaNode.
+ *
+ * @pre filePointer a pointer to a file inside the metadata body
+ *
+ * @post filePointer points just past the terminator
+ *
+ * @par Algorithm
+ *      Characters are read until a semicolon (;), an open or close brace,
+ *      a period (.) or the end of the file. Braces are parsed as repeat
+ *      block nodes, everything else as a normal metadata node.
+ *
+ * @exception badNode
+ *            If the component is bad, display it and return null.
+ *
+ * @param[in] filePointer a pointer to a file
+ *
+ * @param[out] terminator the character that ended the component
+ *
+ * @return the newly parsed node (MetaNode *)
+ */
+MetaNode *readMetaComponent( FILE *filePointer, char *terminator )
+{
     MetaNode *newNode = NULL;
     size_t sizeOfArray = 10;
     int iterator = 0;
     char currentCharacter = NULL_TERMINAL;
     char *linePtr = calloc( sizeOfArray + 1, sizeof( char ) );
-    linePtr[sizeOfArray - 1] = NULL_TERMINAL;
 
     do
     {
@@ -94,50 +159,226 @@ MetaNode *readMetadata( FILE *filePointer )
             sizeOfArray *= 2;
             linePtr = stringResize( linePtr, sizeOfArray );
         }
+    }
+    while( currentCharacter != ';'
+        && currentCharacter != '{'
+        && currentCharacter != '}'
+        && currentCharacter != '.'
+        && currentCharacter != END_OF_FILE );
 
-        if( currentCharacter == ';' )
-        {
-            newNode = extractNode( linePtr );
-            currentNode = addNode( currentNode, newNode );
-            iterator = 0;
-            free( linePtr );
+    if( currentCharacter == '{' || currentCharacter == '}' )
+    {
+        newNode = extractLoopNode( linePtr );
+    }
+    else
+    {
+        newNode = extractNode( linePtr );
+    }
 
-            if ( newNode == NULL )
-            {
-              metaParseError( linePtr );
-              freeList( currentNode );
-              return NULL;
-            }
+    if( newNode == NULL )
+    {
+        metaParseError( linePtr );
+    }
 
-            sizeOfArray = 10;
-            linePtr = calloc( sizeOfArray + 1, sizeof( char ) );
-        }
+    *terminator = currentCharacter;
+    free( linePtr );
+    return newNode;
+}
+//
+// openMetaStream Function Implementation ///////////////////////////////////
+//
 
+/**
+ * @brief This function starts reading a metadata file as a stream
+ *
+ * @details This function checks the start line and the S(start) node of
+ *          a metadata file, then reads ahead the first process block.
+ *
+ * @pre filePointer a pointer to an open metadata file
+ *
+ * @post the stream owns filePointer at post
+ *
+ * @exception badStart
+ *            If the start line or S(start) node is bad, close the file
+ *            and return null.
+ *
+ * @param[in] filePointer a pointer to a file
+ *
+ * @return a new metadata stream (MetaStream *)
+ */
+MetaStream *openMetaStream( FILE *filePointer )
+{
+    MetaStream *stream;
+    MetaNode *startNode;
+    char terminator;
+
+    if( removeExpectedLine( filePointer, META_START_LINE_EXPECTED, '\n' )
+                                                                    == False )
+    {
+        printf( "Bad startline in metadata file.\n" );
+        fclose( filePointer );
+        return NULL;
     }
-    while( currentCharacter != '.' && currentCharacter != END_OF_FILE );
 
-    newNode = extractNode( linePtr );
+    startNode = readMetaComponent( filePointer, &terminator );
 
-    if( newNode == NULL )
+    if( startNode == NULL || terminator != ';'
+     || startNode->commandLetter != 'S'
+     || stringCmp( startNode->opString, "start" ) == False )
     {
-      metaParseError( linePtr );
-      free( linePtr );
-      freeList( currentNode );
-      return NULL;
+        freeList( startNode );
+        fclose( filePointer );
+        return NULL;
     }
 
-    free( linePtr );
-    currentNode = addNode( currentNode, newNode );
-    fgetc( filePointer );
-    validEndLine = removeExpectedLine( filePointer, META_END_LINE_EXPECTED, '.' );
+    freeList( startNode );
 
-    if( validEndLine == False )
+    stream = malloc( sizeof( MetaStream ) );
+    stream->filePointer = filePointer;
+    stream->pendingBlock = NULL;
+    stream->finished = False;
+    stream->failed = False;
+
+    readProcessBlock( stream );
+
+    return stream;
+}
+//
+// readProcessBlock Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function reads the next process block from a stream
+ *
+ * @details This function reads metadata components from an A(start) or
+ *          T(start) node up to the first A(end) or T(end) node. The block
+ *          becomes the stream's pending block until the processor takes it.
+ *
+ * @pre stream a pointer to an open MetaStream
+ *
+ * @post stream->pendingBlock holds the block, or null if there is none
+ *
+ * @par Algorithm
+ *      When S(end) is read instead of a block, the end line is checked and
+ *      the stream is marked finished.
+ *
+ * @exception badBlock
+ *            If a component is bad, an operation is found outside of a
+ *            process, or the file ends inside a process, the stream is
+ *            marked failed and null is returned.
+ *
+ * @param[in,out] stream a pointer to a MetaStream
+ *
+ * @return the newly read process block (MetaNode *)
+ */
+MetaNode *readProcessBlock( MetaStream *stream )
+{
+    MetaNode *blockHead = NULL;
+    MetaNode *blockTail = NULL;
+    MetaNode *newNode = NULL;
+    char terminator;
+
+    stream->pendingBlock = NULL;
+
+    if( stream->finished == True || stream->failed == True )
     {
-        printf( "Bad end line in metadata file.\n" );
-        freeList( currentNode );
         return NULL;
     }
-    return currentNode;
+
+    do
+    {
+        newNode = readMetaComponent( stream->filePointer, &terminator );
+
+        if( newNode == NULL )
+        {
+            stream->failed = True;
+            freeList( blockHead );
+            return NULL;
+        }
+
+        if( blockHead == NULL )
+        {
+            if( newNode->commandLetter == 'S'
+             && stringCmp( newNode->opString, "end" ) == True
+             && terminator == '.' )
+            {
+                freeList( newNode );
+                fgetc( stream->filePointer );
+
+                if( removeExpectedLine( stream->filePointer,
+                                        META_END_LINE_EXPECTED,
+                                        '.' ) == False )
+                {
+                    printf( "Bad end line in metadata file.\n" );
+                    stream->failed = True;
+                    return NULL;
+                }
+
+                stream->finished = True;
+                return NULL;
+            }
+
+            if( ( newNode->commandLetter != 'A'
+               && newNode->commandLetter != 'T' )
+             || stringCmp( newNode->opString, "start" ) == False )
+            {
+                metaParseError( newNode->opString );
+                freeList( newNode );
+                stream->failed = True;
+                return NULL;
+            }
+
+            blockHead = newNode;
+        }
+        else
+        {
+            blockTail->nextNode = newNode;
+        }
+
+        blockTail = newNode;
+
+        if( terminator == '.' || terminator == END_OF_FILE )
+        {
+            printf( "Metadata file ended inside a process.\n" );
+            freeList( blockHead );
+            stream->failed = True;
+            return NULL;
+        }
+    }
+    while( blockTail == blockHead
+        || ( blockTail->commandLetter != 'A'
+          && blockTail->commandLetter != 'T' )
+        || stringCmp( blockTail->opString, "end" ) == False );
+
+    stream->pendingBlock = blockHead;
+    return blockHead;
+}
+//
+// closeMetaStream Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function closes a metadata stream
+ *
+ * @details This function frees any block that was read but never taken,
+ *          closes the file and frees the stream.
+ *
+ * @pre stream a pointer to a MetaStream, or null
+ *
+ * @post stream is freed at post
+ *
+ * @param[in] stream a pointer to a MetaStream
+ */
+void closeMetaStream( MetaStream *stream )
+{
+    if( stream == NULL )
+    {
+        return;
+    }
+
+    freeList( stream->pendingBlock );
+    fclose( stream->filePointer );
+    free( stream );
 }
 //
 // readMetadata Function Implementation ///////////////////////////////////
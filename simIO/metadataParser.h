@@ -11,6 +11,10 @@
 * C.S student (30 January 2018)
 * Initial creation of metedataParser
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Added MetaStream for reading a workload one process block at a time
+*
 * @note None
 */
 
@@ -41,13 +45,27 @@ const static char META_END_LINE_EXPECTED[] = "End Program Meta-Data Code.";
 // Data Structure Definitions (structs, enums, etc.)////////////////
 //
 
-//// None
-
+// A metadata file being read one process block at a time
+typedef struct MetaStream
+{
+  FILE *filePointer;
+  struct MetaNode *pendingBlock;
+  Boolean finished;
+  Boolean failed;
+} MetaStream;
 //
 // Free Function Prototypes ///////////////////////////////////////
 //
 struct MetaNode *readMetadata( FILE *filePointer );
 
+MetaNode *readMetaComponent( FILE *filePointer, char *terminator );
+
+MetaStream *openMetaStream( FILE *filePointer );
+
+MetaNode *readProcessBlock( MetaStream *stream );
+
+void closeMetaStream( MetaStream *stream );
+
 int metaParseError( char *errorLine );
 //
 // Terminating Precompiler Directives ///////////////////////////////
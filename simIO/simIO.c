@@ -11,6 +11,10 @@
 * C.S student (25 February 2018)
 * Initial creation of simIO
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Added getMetadataStream
+*
 * @note Requires simIO.h
 */
 #include "simIO.h"
@@ -98,3 +102,35 @@ MetaNode *getMetadata( ConfigData *cfData )
     
     return startNode;
 }
+//
+// getMetadataStream Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function opens a metadata file as a stream of process blocks
+ *
+ * @details This function opens the metadata file named in the config and
+ *          checks its start, leaving the process blocks to be read one at a
+ *          time as simulated time reaches them.
+ *
+ * @pre cfData a pointer to a ConfigData struct
+ *
+ * @post cfData remains unchanged at post
+ *
+ * @param[in] cfData a pointer to a ConfigData struct
+ *
+ * @return a pointer to a new MetaStream or NULL on failure (MetaStream *)
+ */
+MetaStream *getMetadataStream( ConfigData *cfData )
+{
+    FILE *metadataFilePointer;
+    metadataFilePointer = fopen( cfData->filePath, "r" );
+
+    if( metadataFilePointer == NULL )
+    {
+        printf( "Unable to open metadata file.\n" );
+        return NULL;
+    }
+
+    return openMetaStream( metadataFilePointer );
+}
@@ -11,6 +11,10 @@
 * C.S student (25 February 2018)
 * Initial creation of simIO
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Added getMetadataStream
+*
 * @note None
 */
 
@@ -49,6 +53,8 @@
 ConfigData *getConfig( char *fileName );
 
 MetaNode *getMetadata( ConfigData *cfData );
+
+MetaStream *getMetadataStream( ConfigData *cfData );
 //
 // Terminating Precompiler Directives ///////////////////////////////
 //
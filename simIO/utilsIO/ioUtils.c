@@ -11,6 +11,10 @@
 * C.S student (30 January 2018)
 * Initial creation of ioUtils
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* removeExpectedLine no longer prints the line after freeing it
+*
 * @note Requires ioUtils.h
 */
 
@@ -158,13 +162,12 @@ Boolean removeExpectedLine( FILE *filePointer, const char *expected, char delimi
 
     linePtr = extractLine( filePointer );
     isValid = checkExtractedLine( linePtr, expected, delimiter );
-    free( linePtr );
 
-    if ( isValid == True )
+    if ( isValid == False )
     {
-        return True;
+        printf( "Line %s is invalid. Expected %s\n", linePtr, expected );
     }
 
-    printf( "Line %s is invalid. Expected %s\n", linePtr, expected );
-    return False;
+    free( linePtr );
+    return isValid;
 }
@@ -11,6 +11,30 @@
 * C.S student (31 January 2018)
 * Initial creation of metaLinkedList
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Added the T(start)/T(end) process template commands
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* Added the R(count){ ... } repeat commands
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* Added @time arrival times on A(start) and T(start) commands
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* Added ,key=value process attributes on A(start) and T(start) commands
+*
+* @version 1.50
+* C.S student (18 October 2026)
+* Added the tickets attribute
+*
+* @version 1.60
+* C.S student (18 October 2026)
+* Added the deadline and period attributes
+*
 * @note Requires metaLinkedList.h
 */
 
@@ -200,6 +224,8 @@ MetaNode *extractNode( char *metaLinePtr )
     char commandLetter = NULL_TERMINAL;
     char *opStringPtr = NULL;
     char *cycleTimePtr = NULL;
+    char *arrivalTimePtr = NULL;
+    char *attributesPtr = NULL;
     int validNode = 0;
 
     if (metaLinePtr == NULL)
@@ -210,24 +236,151 @@ MetaNode *extractNode( char *metaLinePtr )
     commandLetter = extractCommandLetter( metaLinePtr );
     opStringPtr = extractOpString( metaLinePtr );
     cycleTimePtr = extractCycleTime( metaLinePtr );
-    
+    attributesPtr = extractAttributes( cycleTimePtr );
+    arrivalTimePtr = extractArrivalTime( cycleTimePtr );
+
     validNode = checkNode( commandLetter, opStringPtr, cycleTimePtr );
 
+    // Only process starts can carry an arrival time or attributes
+    if( validNode == True
+     && ( arrivalTimePtr != NULL || attributesPtr != NULL ) )
+    {
+        if( ( commandLetter != 'A' && commandLetter != 'T' )
+         || stringCmp( opStringPtr, "start" ) == False )
+        {
+            validNode = False;
+        }
+    }
+
+    if( validNode == True && arrivalTimePtr != NULL )
+    {
+        if( checkInt( arrivalTimePtr ) == False )
+        {
+            validNode = False;
+        }
+    }
+
     if( validNode == True )
     {
         newNode = createNode( commandLetter,
                               opStringPtr,
                               stringToI( cycleTimePtr ) );
+
+        if( arrivalTimePtr != NULL )
+        {
+            newNode->arrivalTime = stringToI( arrivalTimePtr );
+        }
+
+        if( attributesPtr != NULL
+         && setNodeAttributes( newNode, attributesPtr ) == False )
+        {
+            freeNode( newNode );
+            newNode = NULL;
+        }
     }
     else
     {
         free( opStringPtr );
     }
 
+    free( attributesPtr );
+    free( arrivalTimePtr );
     free( cycleTimePtr );
     return newNode;
 }
 //
+// extractLoopNode Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function extracts a repeat node from a given string
+ *
+ * @details This function parses a string that ends in either an open brace
+ *          '{' or a close brace '}' into the R(start) or R(end) MetaNode that
+ *          brackets the body of a repeat block.
+ *
+ * @pre metaLinePtr a pointer to a metadata string
+ *
+ * @post metaLinePtr remains unchanged
+ *
+ * @par Algorithm
+ *      A string ending in '{' must be of the form R(count){ where count is an
+ *      integer of at least one, it becomes an R(start) node whose cycle time
+ *      is the repeat count.
+ *
+ * @par Algorithm
+ *      A string ending in '}' may only contain white space before the brace,
+ *      it becomes an R(end) node.
+ *
+ * @exception invalid metadata
+ *            The string was not a valid repeat header or footer, thus the
+ *            function returns a null pointer.
+ *
+ * @param[in] metaLinePtr pointer to a string
+ *
+ * @return new MetaNode (MetaNode *)
+ */
+MetaNode *extractLoopNode( char *metaLinePtr )
+{
+    int iterator = 0, repeatCount = 0;
+    char *opStringPtr = NULL;
+    char *countPtr = NULL;
+
+    if( metaLinePtr == NULL )
+    {
+        return NULL;
+    }
+
+    while( metaLinePtr[ iterator + 1 ] != NULL_TERMINAL )
+    {
+        iterator++;
+    }
+
+    if( metaLinePtr[ iterator ] == '}' )
+    {
+        while( iterator > 0 )
+        {
+            iterator--;
+
+            if( metaLinePtr[ iterator ] != ' '
+             && metaLinePtr[ iterator ] != '\n' )
+            {
+                return NULL;
+            }
+        }
+
+        opStringPtr = malloc( sizeof( "end" ) );
+        strcpy( opStringPtr, "end" );
+
+        return createNode( 'R', opStringPtr, 0 );
+    }
+
+    if( metaLinePtr[ iterator ] != '{'
+     || extractCommandLetter( metaLinePtr ) != 'R' )
+    {
+        return NULL;
+    }
+
+    countPtr = extractOpString( metaLinePtr );
+
+    if( checkInt( countPtr ) == True )
+    {
+        repeatCount = stringToI( countPtr );
+    }
+
+    free( countPtr );
+
+    if( repeatCount < 1 )
+    {
+        return NULL;
+    }
+
+    opStringPtr = malloc( sizeof( "start" ) );
+    strcpy( opStringPtr, "start" );
+
+    return createNode( 'R', opStringPtr, repeatCount );
+}
+//
 // extractCommandLetter Function Implementation ///////////////////////////////////
 //
 
@@ -365,6 +518,205 @@ char *extractCycleTime( char *metaLine )
     return cycleTimeStr;
 }
 //
+// extractArrivalTime Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function splits an arrival time off of a cycle time
+ *
+ * @details This function looks for an at sign '@' in an extracted cycle
+ *          time string. Everything after the at sign is returned as the
+ *          arrival time and the cycle time string is cut off at the at sign.
+ *
+ * @pre cycleTime a pointer to a cycle time string
+ *
+ * @post cycleTime no longer contains the arrival time at post. An empty
+ *       cycle time in front of the at sign becomes 0.
+ *
+ * @param[in,out] cycleTime pointer to a cycle time string
+ *
+ * @return newly extracted arrival time, or NULL if there was none (char *)
+ */
+char *extractArrivalTime( char *cycleTime )
+{
+    int iterator = 0;
+    char *arrivalTimePtr = NULL;
+
+    while( cycleTime[ iterator ] != NULL_TERMINAL
+        && cycleTime[ iterator ] != '@' )
+    {
+        iterator++;
+    }
+
+    if( cycleTime[ iterator ] != '@' )
+    {
+        return NULL;
+    }
+
+    arrivalTimePtr = malloc( strlen( &cycleTime[ iterator + 1 ] ) + 1 );
+    strcpy( arrivalTimePtr, &cycleTime[ iterator + 1 ] );
+
+    if( iterator == 0 )
+    {
+        cycleTime[ iterator ] = '0';
+        iterator++;
+    }
+
+    cycleTime[ iterator ] = NULL_TERMINAL;
+
+    return arrivalTimePtr;
+}
+//
+// extractAttributes Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function splits the process attributes off of a cycle time
+ *
+ * @details This function looks for the first comma ',' in an extracted
+ *          cycle time string. Everything after the comma is returned as the
+ *          attributes and the cycle time string is cut off at the comma.
+ *
+ * @pre cycleTime a pointer to a cycle time string
+ *
+ * @post cycleTime no longer contains the attributes at post
+ *
+ * @param[in,out] cycleTime pointer to a cycle time string
+ *
+ * @return newly extracted attributes, or NULL if there were none (char *)
+ */
+char *extractAttributes( char *cycleTime )
+{
+    int iterator = 0;
+    char *attributesPtr = NULL;
+
+    while( cycleTime[ iterator ] != NULL_TERMINAL
+        && cycleTime[ iterator ] != ',' )
+    {
+        iterator++;
+    }
+
+    if( cycleTime[ iterator ] != ',' )
+    {
+        return NULL;
+    }
+
+    attributesPtr = malloc( strlen( &cycleTime[ iterator + 1 ] ) + 1 );
+    strcpy( attributesPtr, &cycleTime[ iterator + 1 ] );
+
+    cycleTime[ iterator ] = NULL_TERMINAL;
+
+    return attributesPtr;
+}
+//
+// setNodeAttributes Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function stores the process attributes of a start node
+ *
+ * @details This function reads a comma separated list of key=value pairs,
+ *          such as "nice=-5,tickets=200", into the fields of a MetaNode.
+ *
+ * @pre node a pointer to an A(start) or T(start) MetaNode
+ *
+ * @pre attributes a pointer to an extracted attribute string
+ *
+ * @post node holds the attributes at post if True is returned
+ *
+ * @exception badAttribute
+ *            If a key is not known or its value is not a whole number in
+ *            its range, return False.
+ *
+ * @param[out] node a pointer to a MetaNode struct
+ *
+ * @param[in] attributes a pointer to an attribute string
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean setNodeAttributes( MetaNode *node, char *attributes )
+{
+    int iterator = 0, keyStart = 0, value = 0, sign = 1;
+    Boolean hasDigit = False;
+    char *key;
+
+    while( attributes[ iterator ] != NULL_TERMINAL )
+    {
+        keyStart = iterator;
+
+        while( attributes[ iterator ] != NULL_TERMINAL
+            && attributes[ iterator ] != '=' )
+        {
+            iterator++;
+        }
+
+        if( attributes[ iterator ] != '=' )
+        {
+            return False;
+        }
+
+        key = &attributes[ keyStart ];
+        attributes[ iterator ] = NULL_TERMINAL;
+        iterator++;
+
+        value = 0;
+        sign = 1;
+        hasDigit = False;
+
+        if( attributes[ iterator ] == '-' )
+        {
+            sign = -1;
+            iterator++;
+        }
+
+        while( '0' <= attributes[ iterator ] && attributes[ iterator ] <= '9' )
+        {
+            value = value * 10 + attributes[ iterator ] - '0';
+            hasDigit = True;
+            iterator++;
+        }
+
+        if( hasDigit == False
+         || ( attributes[ iterator ] != ','
+           && attributes[ iterator ] != NULL_TERMINAL ) )
+        {
+            return False;
+        }
+
+        if( attributes[ iterator ] == ',' )
+        {
+            iterator++;
+        }
+
+        value *= sign;
+
+        if( stringCmp( key, "nice" ) == True
+         && MIN_NICE <= value && value <= MAX_NICE )
+        {
+            node->nice = value;
+        }
+        else if( stringCmp( key, "tickets" ) == True
+              && 1 <= value && value <= MAX_TICKETS )
+        {
+            node->tickets = value;
+        }
+        else if( stringCmp( key, "deadline" ) == True && 1 <= value )
+        {
+            node->deadline = value;
+        }
+        else if( stringCmp( key, "period" ) == True && 1 <= value )
+        {
+            node->period = value;
+        }
+        else
+        {
+            return False;
+        }
+    }
+
+    return True;
+}
+//
 // checkNode Function Implementation ///////////////////////////////////
 //
 
@@ -429,6 +781,16 @@ Boolean checkNode( char commandLetter, char *opString, char *cycleTime )
             tableEnd = 1;
             break;
 
+        case 'T':
+            tableStart = 0;
+            tableEnd = 1;
+            break;
+
+        case 'R':
+            tableStart = 0;
+            tableEnd = 1;
+            break;
+
         case 'P':
             tableStart = 2;
             tableEnd = 2;
@@ -552,6 +914,11 @@ MetaNode *createNode( char commandLetter, char *opString, int cycleTime )
     newNode->commandLetter = commandLetter;
     newNode->opString = opString;
     newNode->cycleTime = cycleTime;
+    newNode->arrivalTime = 0;
+    newNode->nice = 0;
+    newNode->tickets = DEFAULT_TICKETS;
+    newNode->deadline = 0;
+    newNode->period = 0;
     newNode->nextNode = NULL;
     newNode->previousNode = NULL;
     return newNode;
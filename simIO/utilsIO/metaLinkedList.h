@@ -11,6 +11,18 @@
 * C.S student (31 January 2018)
 * Initial creation of metaLinkedList
 *
+* @version 1.10
+* C.S student (18 October 2026)
+* Added ,key=value process attributes on A(start) and T(start) commands
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* Added the tickets attribute
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* Added the deadline and period attributes
+*
 * @note None
 */
 
@@ -40,6 +52,14 @@
 // Global Constant Definitions ////////////////////////////////////
 //
 extern const char *commandLookUp[];
+
+// Range of the nice attribute, lower nice values get more of the CPU
+#define MIN_NICE -20
+#define MAX_NICE 19
+
+// Tickets of a process under LOTTERY-P and STRIDE-P, its share of the CPU
+#define DEFAULT_TICKETS 100
+#define MAX_TICKETS 1000000
 //
 // Data Structure Definitions (structs, enums, etc.)////////////////
 //
@@ -48,6 +68,14 @@ typedef struct MetaNode
   char commandLetter;
   char *opString;
   int cycleTime;
+  // Simulated arrival time (msec) given as @time on A(start)/T(start)
+  int arrivalTime;
+  // Attributes given as ,key=value on A(start)/T(start)
+  int nice;
+  int tickets;
+  // Relative deadline and release period (msec), 0 if not given
+  int deadline;
+  int period;
   struct MetaNode *nextNode;
   struct MetaNode *previousNode;
 } MetaNode;
@@ -62,6 +90,8 @@ Boolean displayList( MetaNode *node );
 
 MetaNode *extractNode( char *metaLine );
 
+MetaNode *extractLoopNode( char *metaLine );
+
 MetaNode *createNode( char commandLetter, char *opString, int cycleTime );
 
 char extractCommandLetter( char *metaLine );
@@ -70,6 +100,12 @@ char *extractOpString( char *metaLine );
 
 char *extractCycleTime( char *metaLine );
 
+char *extractArrivalTime( char *cycleTime );
+
+char *extractAttributes( char *cycleTime );
+
+Boolean setNodeAttributes( MetaNode *node, char *attributes );
+
 Boolean checkNode( char commandLetter, char *opString, char *cycleTime );
 
 char extractCommandLetter( char *metaLine );
@@ -0,0 +1,1163 @@
+// Sweep Implementation File Information ///////////////////////////////
+/**
+* @file sweep.c
+*
+* @brief Implementation for sweep
+*
+* @details Implements all functions for running parameter sweeps
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of sweep
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* Jobs run on the pool threads with their own SimContext instead of in
+* forked children
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* Jobs never write runtime counters
+*
+* @version 1.30
+* C.S student (18 October 2026)
+* Jobs never serve live stats
+*
+* @version 1.40
+* C.S student (18 October 2026)
+* Added the quantum search of --optimize quantum
+*
+* @version 1.50
+* C.S student (18 October 2026)
+* A job fails if its run state cannot be set up
+*
+* @note Requires sweep.h
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "sweep.h"
+
+const char *objectiveNames[] =
+{
+    [TURNAROUND_OBJECTIVE] = "turnaround",
+    [RESPONSE_P99_OBJECTIVE] = "p99-response",
+    [SWITCHES_OBJECTIVE] = "switches"
+};
+
+//
+// checkSweepArgs Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks if the simulator was asked to run a sweep
+ *
+ * @details This function looks for any option before the config file name
+ *          on the command line.
+ *
+ * @pre argv the command line arguments
+ *
+ * @post argc and argv remain unchanged at post
+ *
+ * @param[in] argc number of command line arguments
+ *
+ * @param[in] argv the command line arguments
+ *
+ * @return True if a sweep option was given, False otherwise (Boolean)
+ */
+Boolean checkSweepArgs( int argc, char *argv[] )
+{
+    int iterator;
+
+    for( iterator = 1; iterator < argc - 1; iterator++ )
+    {
+        if( argv[ iterator ][ 0 ] == '-' && argv[ iterator ][ 1 ] == '-' )
+        {
+            return True;
+        }
+    }
+
+    return False;
+}
+//
+// runSweep Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function runs a workload under every combination of settings
+ *
+ * @details This function reads the sweep options, builds one job for every
+ *          combination of scheduling code, memory size and quantum time,
+ *          runs the jobs on a pool of threads and writes the results table.
+ *
+ * @par Algorithm
+ *      Options not given on the command line use the value in the config.
+ *      The pool has one thread per host core unless --jobs is given. With
+ *      --optimize quantum the --quantum values only bound the search, which
+ *      runQuantumSearch makes instead of the table of every combination.
+ *
+ * @par Algorithm
+ *      Each job runs on its pool thread with its own SimContext and copy of
+ *      the config, so no run state is shared between jobs. The parsed
+ *      workload is shared by every job and only read, so it is never
+ *      copied or parsed again.
+ *
+ * @exception badOption
+ *            If an option or its value is bad, print it and return failure.
+ *
+ * @param[in] argc number of command line arguments
+ *
+ * @param[in] argv the command line arguments
+ *
+ * @param[in] cfData a pointer to the ConfigData of the workload
+ *
+ * @param[in] workloadNode the head of the parsed MetaNode linked list
+ *
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if any option or run failed (int)
+ */
+int runSweep( int argc, char *argv[], ConfigData *cfData, MetaNode *workloadNode )
+{
+    int iterator, policyIndex, memoryIndex, quantumIndex;
+    int policyCount = 0, memoryCount = 0, quantumCount = 0;
+    int threadCount = (int) sysconf( _SC_NPROCESSORS_ONLN );
+    int exitCode = EXIT_SUCCESS;
+    int lowQuantum = QUANTUM_TIME_MAX, highQuantum = QUANTUM_TIME_MIN;
+    char *option, *value, *outPath = NULL;
+    char **policies = NULL;
+    int *memorySizes = NULL, *quantumTimes = NULL;
+    Boolean optimizeQuantum = False;
+    OPTIMIZE_OBJECTIVES objective = TURNAROUND_OBJECTIVE;
+    FILE *outFilePointer = stdout;
+    SweepPool pool;
+
+    for( iterator = 1; iterator < argc - 1; iterator += 2 )
+    {
+        option = argv[ iterator ];
+        value = argv[ iterator + 1 ];
+
+        if( iterator + 1 >= argc - 1 )
+        {
+            printf( "Missing value for %s\n", option );
+            exitCode = EXIT_FAILURE;
+        }
+        else if( stringCmp( option, (char *) SWEEP_POLICY_OPTION ) == True
+              && policies == NULL )
+        {
+            policyCount = parseSweepPolicies( value, &policies );
+        }
+        else if( stringCmp( option, (char *) SWEEP_QUANTUM_OPTION ) == True
+              && quantumTimes == NULL )
+        {
+            quantumCount = parseSweepValues( value,
+                                             QUANTUM_TIME_MIN,
+                                             QUANTUM_TIME_MAX,
+                                             &quantumTimes );
+        }
+        else if( stringCmp( option, (char *) SWEEP_MEMORY_OPTION ) == True
+              && memorySizes == NULL )
+        {
+            memoryCount = parseSweepValues( value,
+                                            MEM_AVAILABLE_MIN,
+                                            MEM_AVAILABLE_MAX,
+                                            &memorySizes );
+        }
+        else if( stringCmp( option, (char *) SWEEP_JOBS_OPTION ) == True )
+        {
+            if( checkInt( value ) == False || stringToI( value ) < 1 )
+            {
+                printf( "Bad value for %s: %s\n", option, value );
+                exitCode = EXIT_FAILURE;
+            }
+            else
+            {
+                threadCount = stringToI( value );
+            }
+        }
+        else if( stringCmp( option, (char *) SWEEP_OUT_OPTION ) == True )
+        {
+            outPath = value;
+        }
+        else if( stringCmp( option, (char *) SWEEP_OPTIMIZE_OPTION ) == True
+              && stringCmp( value, "quantum" ) == True )
+        {
+            optimizeQuantum = True;
+        }
+        else if( stringCmp( option, (char *) SWEEP_OBJECTIVE_OPTION ) == True )
+        {
+            for( objective = TURNAROUND_OBJECTIVE;
+                 objective < OBJECTIVE_COUNT
+              && stringCmp( value, (char *) objectiveNames[ objective ] )
+                                                                  == False;
+                 objective++ );
+
+            if( objective == OBJECTIVE_COUNT )
+            {
+                printf( "Bad value for %s: %s\n", option, value );
+                exitCode = EXIT_FAILURE;
+            }
+        }
+        else
+        {
+            printf( "Unknown or repeated sweep option: %s\n", option );
+            exitCode = EXIT_FAILURE;
+        }
+
+        if( policyCount < 0 || quantumCount < 0 || memoryCount < 0 )
+        {
+            printf( "Bad value for %s: %s\n", option, value );
+            exitCode = EXIT_FAILURE;
+            break;
+        }
+    }
+
+    // Anything not swept comes from the config
+    if( policies == NULL && exitCode == EXIT_SUCCESS )
+    {
+        policyCount = parseSweepPolicies( cfData->cpuSchedCode, &policies );
+    }
+
+    // A search runs every quantum time given ones do not bound
+    for( quantumIndex = 0; quantumIndex < quantumCount; quantumIndex++ )
+    {
+        if( quantumTimes[ quantumIndex ] < lowQuantum )
+        {
+            lowQuantum = quantumTimes[ quantumIndex ];
+        }
+
+        if( quantumTimes[ quantumIndex ] > highQuantum )
+        {
+            highQuantum = quantumTimes[ quantumIndex ];
+        }
+    }
+
+    if( quantumTimes == NULL )
+    {
+        lowQuantum = QUANTUM_TIME_MIN;
+        highQuantum = QUANTUM_TIME_MAX;
+        quantumTimes = malloc( sizeof( int ) );
+        quantumTimes[ 0 ] = cfData->quantumTime;
+        quantumCount = 1;
+    }
+
+    // A quantum of no cycles never runs a process
+    if( lowQuantum < 1 )
+    {
+        lowQuantum = 1;
+    }
+
+    if( memorySizes == NULL )
+    {
+        memorySizes = malloc( sizeof( int ) );
+        memorySizes[ 0 ] = cfData->memAvailable;
+        memoryCount = 1;
+    }
+
+    if( exitCode == EXIT_SUCCESS && outPath != NULL )
+    {
+        outFilePointer = fopen( outPath, "w" );
+
+        if( outFilePointer == NULL )
+        {
+            printf( "Unable to open sweep output file: %s\n", outPath );
+            exitCode = EXIT_FAILURE;
+        }
+    }
+
+    if( exitCode == EXIT_SUCCESS && optimizeQuantum == True
+     && ( policyCount != 1 || memoryCount != 1 || highQuantum < 1 ) )
+    {
+        printf( "%s quantum needs one policy, one memory size and a " \
+                "quantum time above 0\n", SWEEP_OPTIMIZE_OPTION );
+        exitCode = EXIT_FAILURE;
+    }
+
+    if( exitCode != EXIT_SUCCESS || policyCount <= 0 )
+    {
+        if( outFilePointer != stdout && outFilePointer != NULL )
+        {
+            fclose( outFilePointer );
+        }
+
+        freeSweepPolicies( policies, policyCount );
+        free( quantumTimes );
+        free( memorySizes );
+        return EXIT_FAILURE;
+    }
+
+    pool.cfData = cfData;
+    pool.workloadNode = workloadNode;
+    pthread_mutex_init( &pool.jobMutex, NULL );
+
+    if( optimizeQuantum == True )
+    {
+        exitCode = runQuantumSearch( &pool, policies[ 0 ], memorySizes[ 0 ],
+                                     lowQuantum, highQuantum, objective,
+                                     threadCount, outFilePointer );
+
+        if( outFilePointer != stdout )
+        {
+            fclose( outFilePointer );
+        }
+
+        pthread_mutex_destroy( &pool.jobMutex );
+        freeSweepPolicies( policies, policyCount );
+        free( quantumTimes );
+        free( memorySizes );
+
+        return exitCode;
+    }
+
+    pool.jobCount = policyCount * memoryCount * quantumCount;
+    pool.jobs = malloc( sizeof( SweepJob ) * pool.jobCount );
+
+    iterator = 0;
+
+    for( policyIndex = 0; policyIndex < policyCount; policyIndex++ )
+    {
+        for( memoryIndex = 0; memoryIndex < memoryCount; memoryIndex++ )
+        {
+            for( quantumIndex = 0; quantumIndex < quantumCount; quantumIndex++ )
+            {
+                pool.jobs[ iterator ].policy = policies[ policyIndex ];
+                pool.jobs[ iterator ].memAvailable = memorySizes[ memoryIndex ];
+                pool.jobs[ iterator ].quantumTime = quantumTimes[ quantumIndex ];
+                pool.jobs[ iterator ].failed = True;
+                iterator++;
+            }
+        }
+    }
+
+    runSweepPool( &pool, threadCount );
+
+    writeSweepResults( outFilePointer, pool.jobs, pool.jobCount );
+
+    for( iterator = 0; iterator < pool.jobCount; iterator++ )
+    {
+        if( pool.jobs[ iterator ].failed == True )
+        {
+            exitCode = EXIT_FAILURE;
+        }
+    }
+
+    if( outFilePointer != stdout )
+    {
+        fclose( outFilePointer );
+    }
+
+    pthread_mutex_destroy( &pool.jobMutex );
+    free( pool.jobs );
+    freeSweepPolicies( policies, policyCount );
+    free( quantumTimes );
+    free( memorySizes );
+
+    return exitCode;
+}
+//
+// runSweepPool Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function runs every job of a pool on its threads
+ *
+ * @pre pool a pointer to a SweepPool struct with its jobs set
+ *
+ * @post every job of the pool has its results at post
+ *
+ * @param[in,out] pool a pointer to a SweepPool struct
+ *
+ * @param[in] threadCount the most threads to run at once
+ *
+ * @return Nothing to return (void)
+ */
+void runSweepPool( SweepPool *pool, int threadCount )
+{
+    int iterator;
+    pthread_t *threads;
+
+    pool->nextJob = 0;
+
+    if( threadCount > pool->jobCount )
+    {
+        threadCount = pool->jobCount;
+    }
+
+    threads = malloc( sizeof( pthread_t ) * threadCount );
+
+    for( iterator = 0; iterator < threadCount; iterator++ )
+    {
+        pthread_create( &threads[ iterator ], NULL, &sweepWorker, pool );
+    }
+
+    for( iterator = 0; iterator < threadCount; iterator++ )
+    {
+        pthread_join( threads[ iterator ], NULL );
+    }
+
+    free( threads );
+}
+//
+// runQuantumSearch Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function searches for the quantum time with the best
+ *        objective
+ *
+ * @details This function runs the workload under one policy and memory size
+ *          at quantum times from the low to the high one, and writes every
+ *          run made as the objective curve with the best quantum time.
+ *
+ * @par Algorithm
+ *      Each round runs a grid of quantum times evenly spaced over the range
+ *      at once on the pool, one per thread but at least
+ *      OPTIMIZE_GRID_POINTS. The range then shrinks to the grid points
+ *      either side of the best one, until it is small enough for every
+ *      quantum time in it to be run. The search assumes the objective has
+ *      one low point, and finds the best one near the best grid point
+ *      otherwise.
+ *
+ * @pre pool a pointer to a SweepPool struct with its config, workload and
+ *      mutex set
+ *
+ * @post pool holds no jobs at post
+ *
+ * @exception runFailed
+ *            If any run failed, it is left out of the search and failure is
+ *            returned.
+ *
+ * @param[in,out] pool a pointer to a SweepPool struct
+ *
+ * @param[in] policy a pointer to the scheduling code to run
+ *
+ * @param[in] memAvailable the memory size to run with
+ *
+ * @param[in] lowQuantum the least quantum time to search, at least 1
+ *
+ * @param[in] highQuantum the greatest quantum time to search
+ *
+ * @param[in] objective the objective to minimize
+ *
+ * @param[in] threadCount the most runs to make at once
+ *
+ * @param[in] filePointer a pointer to the file to write the curve to
+ *
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if any run failed (int)
+ */
+int runQuantumSearch( SweepPool *pool,
+                      char *policy,
+                      int memAvailable,
+                      int lowQuantum,
+                      int highQuantum,
+                      OPTIMIZE_OBJECTIVES objective,
+                      int threadCount,
+                      FILE *filePointer )
+{
+    int gridPoints = threadCount > OPTIMIZE_GRID_POINTS
+                   ? threadCount : OPTIMIZE_GRID_POINTS;
+    int *gridQuanta = malloc( sizeof( int ) * gridPoints );
+    int gridCount, gridIndex, bestIndex, curveCount = 0, exitCode = EXIT_SUCCESS;
+    SweepJob *curve = malloc( sizeof( SweepJob )
+                              * ( highQuantum - lowQuantum + 1 ) );
+    SweepJob *job, *bestJob;
+    Boolean lastRound = False;
+
+    while( lastRound == False )
+    {
+        gridCount = getSearchGrid( lowQuantum, highQuantum, gridPoints,
+                                   gridQuanta );
+        lastRound = gridCount == highQuantum - lowQuantum + 1;
+
+        // Only quantum times not run in an earlier round are run
+        pool->jobs = &curve[ curveCount ];
+        pool->jobCount = 0;
+
+        for( gridIndex = 0; gridIndex < gridCount; gridIndex++ )
+        {
+            if( findSweepQuantum( curve, curveCount,
+                                  gridQuanta[ gridIndex ] ) == NULL )
+            {
+                job = &pool->jobs[ pool->jobCount ];
+                job->policy = policy;
+                job->memAvailable = memAvailable;
+                job->quantumTime = gridQuanta[ gridIndex ];
+                job->failed = True;
+                pool->jobCount++;
+            }
+        }
+
+        runSweepPool( pool, threadCount );
+        curveCount += pool->jobCount;
+
+        bestIndex = -1;
+        bestJob = NULL;
+
+        for( gridIndex = 0; gridIndex < gridCount; gridIndex++ )
+        {
+            job = findSweepQuantum( curve, curveCount,
+                                    gridQuanta[ gridIndex ] );
+
+            if( job->failed == False
+             && ( bestJob == NULL
+               || getSweepObjective( job, objective )
+                  < getSweepObjective( bestJob, objective ) ) )
+            {
+                bestJob = job;
+                bestIndex = gridIndex;
+            }
+        }
+
+        if( bestJob == NULL )
+        {
+            break;
+        }
+
+        lowQuantum = gridQuanta[ bestIndex > 0 ? bestIndex - 1 : 0 ];
+        highQuantum = gridQuanta[ bestIndex < gridCount - 1
+                                  ? bestIndex + 1 : gridCount - 1 ];
+    }
+
+    qsort( curve, curveCount, sizeof( SweepJob ), compareSweepQuanta );
+
+    bestJob = NULL;
+
+    for( gridIndex = 0; gridIndex < curveCount; gridIndex++ )
+    {
+        if( curve[ gridIndex ].failed == True )
+        {
+            exitCode = EXIT_FAILURE;
+        }
+        else if( bestJob == NULL
+              || getSweepObjective( &curve[ gridIndex ], objective )
+                 < getSweepObjective( bestJob, objective ) )
+        {
+            bestJob = &curve[ gridIndex ];
+        }
+    }
+
+    writeQuantumCurve( filePointer, curve, curveCount, objective, bestJob );
+
+    pool->jobs = NULL;
+    pool->jobCount = 0;
+    free( gridQuanta );
+    free( curve );
+
+    return exitCode;
+}
+//
+// getSearchGrid Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function spaces the quantum times of a search round
+ *
+ * @details This function spaces grid points evenly from the low to the
+ *          high quantum time, both included, or takes every quantum time
+ *          between them if there are no more than the grid points.
+ *
+ * @pre quantumTimes a pointer to room for gridPoints values
+ *
+ * @param[in] lowQuantum the least quantum time
+ *
+ * @param[in] highQuantum the greatest quantum time
+ *
+ * @param[in] gridPoints the most quantum times to space, at least 2
+ *
+ * @param[out] quantumTimes a pointer to the quantum times, increasing
+ *
+ * @return the number of quantum times (int)
+ */
+int getSearchGrid( int lowQuantum, int highQuantum, int gridPoints,
+                   int *quantumTimes )
+{
+    int gridCount = 0, gridIndex, quantumTime;
+
+    if( highQuantum - lowQuantum + 1 <= gridPoints )
+    {
+        for( quantumTime = lowQuantum; quantumTime <= highQuantum;
+             quantumTime++ )
+        {
+            quantumTimes[ gridCount ] = quantumTime;
+            gridCount++;
+        }
+
+        return gridCount;
+    }
+
+    for( gridIndex = 0; gridIndex < gridPoints; gridIndex++ )
+    {
+        quantumTime = lowQuantum
+                    + (int) ( (long long) ( highQuantum - lowQuantum )
+                              * gridIndex / ( gridPoints - 1 ) );
+
+        if( gridCount == 0 || quantumTimes[ gridCount - 1 ] != quantumTime )
+        {
+            quantumTimes[ gridCount ] = quantumTime;
+            gridCount++;
+        }
+    }
+
+    return gridCount;
+}
+//
+// findSweepQuantum Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function finds the job run at a quantum time
+ *
+ * @param[in] jobs a pointer to an array of SweepJob structs
+ *
+ * @param[in] jobCount the number of jobs
+ *
+ * @param[in] quantumTime the quantum time to find
+ *
+ * @return a pointer to the job, or NULL if none was run at it (SweepJob *)
+ */
+SweepJob *findSweepQuantum( SweepJob *jobs, int jobCount, int quantumTime )
+{
+    int iterator;
+
+    for( iterator = 0; iterator < jobCount; iterator++ )
+    {
+        if( jobs[ iterator ].quantumTime == quantumTime )
+        {
+            return &jobs[ iterator ];
+        }
+    }
+
+    return NULL;
+}
+//
+// getSweepObjective Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the value of an objective for a finished job
+ *
+ * @param[in] job a pointer to a SweepJob struct
+ *
+ * @param[in] objective the objective to get
+ *
+ * @return the value, lower is better (double)
+ */
+double getSweepObjective( SweepJob *job, OPTIMIZE_OBJECTIVES objective )
+{
+    switch( objective )
+    {
+      case RESPONSE_P99_OBJECTIVE:
+        return job->p99Response;
+
+      case SWITCHES_OBJECTIVE:
+        return job->contextSwitches;
+
+      default:
+        return job->meanTurnaround;
+    }
+}
+//
+// compareSweepQuanta Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function orders sweep jobs by quantum time for qsort
+ *
+ * @param[in] first a pointer to a SweepJob struct
+ *
+ * @param[in] second a pointer to a SweepJob struct
+ *
+ * @return negative, zero or positive as first has the lesser, the same or
+ *         the greater quantum time (int)
+ */
+int compareSweepQuanta( const void *first, const void *second )
+{
+    return ( (const SweepJob *) first )->quantumTime
+         - ( (const SweepJob *) second )->quantumTime;
+}
+//
+// writeQuantumCurve Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes the results of a quantum search
+ *
+ * @details This function writes one line per quantum time run, in
+ *          increasing order, with every objective, then the best quantum
+ *          time. Its line is marked with a *.
+ *
+ * @pre filePointer a pointer to an open file
+ *
+ * @param[in] filePointer a pointer to a file
+ *
+ * @param[in] jobs a pointer to an array of SweepJob structs
+ *
+ * @param[in] jobCount the number of jobs
+ *
+ * @param[in] objective the objective that was minimized
+ *
+ * @param[in] bestJob a pointer to the best job, or NULL if every run failed
+ *
+ * @return Nothing to return (void)
+ */
+void writeQuantumCurve( FILE *filePointer,
+                        SweepJob *jobs,
+                        int jobCount,
+                        OPTIMIZE_OBJECTIVES objective,
+                        SweepJob *bestJob )
+{
+    int iterator;
+    SweepJob *job;
+
+    fprintf( filePointer, "Quantum Search Results\n" );
+    fprintf( filePointer, "======================\n" );
+
+    if( jobCount > 0 )
+    {
+        fprintf( filePointer, "Policy: %s, Memory (KB): %d, Objective: %s\n",
+                 jobs[ 0 ].policy, jobs[ 0 ].memAvailable,
+                 objectiveNames[ objective ] );
+    }
+
+    fprintf( filePointer, "  %8s %16s %18s %17s %14s\n",
+             "Quantum", "Turnaround (ms)", "p99 Response (ms)",
+             "Context Switches", "Sim Time (ms)" );
+
+    for( iterator = 0; iterator < jobCount; iterator++ )
+    {
+        job = &jobs[ iterator ];
+
+        if( job->failed == True )
+        {
+            fprintf( filePointer, "  %8d %16s\n", job->quantumTime, "FAILED" );
+            continue;
+        }
+
+        fprintf( filePointer, "%c %8d %16.3lf %18.3lf %17d %14.3lf\n",
+                 job == bestJob ? '*' : ' ', job->quantumTime,
+                 job->meanTurnaround, job->p99Response,
+                 job->contextSwitches, job->summary.totalTime );
+    }
+
+    if( bestJob == NULL )
+    {
+        fprintf( filePointer, "No run finished\n" );
+        return;
+    }
+
+    fprintf( filePointer, "Best quantum: %d (%s %.3lf, %d runs)\n",
+             bestJob->quantumTime, objectiveNames[ objective ],
+             getSweepObjective( bestJob, objective ), jobCount );
+}
+//
+// parseSweepValues Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function parses a list of integer sweep values
+ *
+ * @details This function parses a comma separated list where each item is
+ *          either a single value or a range written start:end or
+ *          start:end:step.
+ *
+ * @pre valueStr a pointer to a string
+ *
+ * @post values points at a new array of every value at post
+ *
+ * @exception badValue
+ *            If an item is not a number, is out of range or a range has a
+ *            step below one, return -1.
+ *
+ * @param[in] valueStr a pointer to a string such as "1:100:5,200"
+ *
+ * @param[in] min an integer for the minimum allowed value
+ *
+ * @param[in] max an integer for the maximum allowed value
+ *
+ * @param[out] values a pointer to the new array of values
+ *
+ * @return the number of values, or -1 on failure (int)
+ */
+int parseSweepValues( char *valueStr, int min, int max, int **values )
+{
+    int bounds[ 3 ], boundCount = 0, valueCount = 0, capacity = 8;
+    int iterator = 0, value;
+    Boolean hasDigit = False;
+
+    *values = malloc( sizeof( int ) * capacity );
+    bounds[ 0 ] = 0;
+
+    do
+    {
+        if( '0' <= valueStr[ iterator ] && valueStr[ iterator ] <= '9' )
+        {
+            bounds[ boundCount ] = bounds[ boundCount ] * 10
+                                 + ( valueStr[ iterator ] - '0' );
+            hasDigit = True;
+
+            if( bounds[ boundCount ] > max )
+            {
+                break;
+            }
+        }
+        else if( valueStr[ iterator ] == ':' && hasDigit == True
+              && boundCount < 2 )
+        {
+            boundCount++;
+            bounds[ boundCount ] = 0;
+            hasDigit = False;
+        }
+        else if( ( valueStr[ iterator ] == ','
+                || valueStr[ iterator ] == NULL_TERMINAL )
+              && hasDigit == True )
+        {
+            if( boundCount == 0 )
+            {
+                bounds[ 1 ] = bounds[ 0 ];
+            }
+
+            if( boundCount < 2 )
+            {
+                bounds[ 2 ] = 1;
+            }
+
+            if( bounds[ 0 ] < min || bounds[ 1 ] > max
+             || bounds[ 0 ] > bounds[ 1 ] || bounds[ 2 ] < 1 )
+            {
+                break;
+            }
+
+            for( value = bounds[ 0 ]; value <= bounds[ 1 ]; value += bounds[ 2 ] )
+            {
+                if( valueCount == capacity )
+                {
+                    capacity *= 2;
+                    *values = realloc( *values, sizeof( int ) * capacity );
+                }
+
+                ( *values )[ valueCount ] = value;
+                valueCount++;
+            }
+
+            if( valueStr[ iterator ] == NULL_TERMINAL )
+            {
+                return valueCount;
+            }
+
+            boundCount = 0;
+            bounds[ 0 ] = 0;
+            hasDigit = False;
+        }
+        else
+        {
+            break;
+        }
+
+        iterator++;
+    }
+    while( True );
+
+    free( *values );
+    *values = NULL;
+    return -1;
+}
+//
+// parseSweepPolicies Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function parses a list of CPU scheduling codes
+ *
+ * @details This function splits a comma separated list of CPU scheduling
+ *          codes into new strings, checking each one.
+ *
+ * @pre policyStr a pointer to a string
+ *
+ * @post policies points at a new array of codes at post
+ *
+ * @exception badCode
+ *            If any code is not a known scheduling code, return -1.
+ *
+ * @param[in] policyStr a pointer to a string such as "FCFS-N,RR-P"
+ *
+ * @param[out] policies a pointer to the new array of codes
+ *
+ * @return the number of codes, or -1 on failure (int)
+ */
+int parseSweepPolicies( char *policyStr, char ***policies )
+{
+    int policyCount = 1, iterator, start = 0, length = 0;
+
+    for( iterator = 0; policyStr[ iterator ] != NULL_TERMINAL; iterator++ )
+    {
+        if( policyStr[ iterator ] == ',' )
+        {
+            policyCount++;
+        }
+    }
+
+    *policies = calloc( policyCount, sizeof( char * ) );
+    policyCount = 0;
+    iterator = 0;
+
+    do
+    {
+        if( policyStr[ iterator ] == ','
+         || policyStr[ iterator ] == NULL_TERMINAL )
+        {
+            length = iterator - start;
+            ( *policies )[ policyCount ] = calloc( length + 1, sizeof( char ) );
+            memcpy( ( *policies )[ policyCount ], &policyStr[ start ], length );
+            policyCount++;
+
+            if( checkSweepPolicy( ( *policies )[ policyCount - 1 ] ) == False )
+            {
+                freeSweepPolicies( *policies, policyCount );
+                *policies = NULL;
+                return -1;
+            }
+
+            start = iterator + 1;
+        }
+    }
+    while( policyStr[ iterator++ ] != NULL_TERMINAL );
+
+    return policyCount;
+}
+//
+// checkSweepPolicy Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function checks a CPU scheduling code for a sweep
+ *
+ * @details This function checks a code against every code in the CPU
+ *          scheduling code table.
+ *
+ * @pre policy a pointer to a string
+ *
+ * @post policy remains unchanged at post
+ *
+ * @param[in] policy a pointer to a string
+ *
+ * @return True if the code is known, False otherwise (Boolean)
+ */
+Boolean checkSweepPolicy( char *policy )
+{
+    int iterator;
+
+    for( iterator = 0; iterator < CPU_SCHED_CODE_COUNT; iterator++ )
+    {
+        if( stringCmp( policy, (char *) cpuSchedCodeLookUp[ iterator ] ) == True )
+        {
+            return True;
+        }
+    }
+
+    return False;
+}
+//
+// sweepWorker Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function runs sweep jobs on a thread of the pool
+ *
+ * @details This function takes the next job that has not been started and
+ *          runs it, until no jobs are left.
+ *
+ * @pre pool a void pointer to (theoretically) a SweepPool struct
+ *
+ * @post every job taken by this thread has its results at post
+ *
+ * @param[in] pool a pointer to a SweepPool struct
+ *
+ * @return null for running on a thread (void *)
+ */
+void *sweepWorker( void *pool )
+{
+    SweepPool *sweepPool = (SweepPool *) pool;
+    int jobIndex;
+
+    while( True )
+    {
+        pthread_mutex_lock( &sweepPool->jobMutex );
+        jobIndex = sweepPool->nextJob;
+        sweepPool->nextJob++;
+        pthread_mutex_unlock( &sweepPool->jobMutex );
+
+        if( jobIndex >= sweepPool->jobCount )
+        {
+            return NULL;
+        }
+
+        sweepPool->jobs[ jobIndex ].failed
+            = runSweepJob( sweepPool, &sweepPool->jobs[ jobIndex ] ) == False;
+    }
+}
+//
+// runSweepJob Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function runs the simulator for a single sweep job
+ *
+ * @details This function sets the job's settings on a copy of the config
+ *          and runs the workload in a new SimContext with the virtual clock
+ *          and no logging.
+ *
+ * @pre pool a pointer to a SweepPool struct
+ *
+ * @pre job a pointer to the SweepJob to run
+ *
+ * @post job holds the run results and wall time at post
+ *
+ * @exception runFailed
+ *            If the SimContext cannot be made or the run stopped before
+ *            the system stop, return False.
+ *
+ * @param[in] pool a pointer to a SweepPool struct
+ *
+ * @param[in,out] job a pointer to a SweepJob struct
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean runSweepJob( SweepPool *pool, SweepJob *job )
+{
+    ConfigData jobConfig = *pool->cfData;
+    SimContext *context;
+    StringNode *logNode;
+    MetricStats stats;
+    struct timeval startTime, endTime;
+
+    jobConfig.cpuSchedCode = job->policy;
+    jobConfig.quantumTime = job->quantumTime;
+    jobConfig.memAvailable = job->memAvailable;
+    jobConfig.logTo = "None";
+    jobConfig.logMetrics = False;
+    jobConfig.metricsFilePath = NULL;
+    jobConfig.histogramFilePrefix = NULL;
+    jobConfig.dumpCounters = False;
+    jobConfig.statsSocketPath = NULL;
+    jobConfig.virtualClock = True;
+
+    gettimeofday( &startTime, NULL );
+
+    context = createSimContext( &jobConfig );
+
+    if( context == NULL )
+    {
+        return False;
+    }
+
+    logNode = beginProcessing( context, pool->workloadNode, NULL );
+
+    job->summary = context->runSummary;
+
+    getMetricStats( &context->runMetrics, TURNAROUND_METRIC, &stats );
+    job->meanTurnaround = stats.mean;
+    getMetricStats( &context->runMetrics, RESPONSE_METRIC, &stats );
+    job->p99Response = stats.p99;
+    job->contextSwitches = context->runMetrics.contextSwitches;
+
+    freeStringList( logNode );
+    freeSimContext( context );
+
+    gettimeofday( &endTime, NULL );
+    job->wallTime = ( endTime.tv_sec - startTime.tv_sec ) * 1000.0
+                  + ( endTime.tv_usec - startTime.tv_usec ) / 1000.0;
+
+    // Only a run that reached the system stop counts its processes
+    return job->summary.processes > 0;
+}
+//
+// writeSweepResults Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes the results table of a sweep
+ *
+ * @details This function writes one line per job with its settings and the
+ *          totals of its run, in the order the jobs were built.
+ *
+ * @pre filePointer a pointer to an open file
+ *
+ * @pre jobs a pointer to an array of finished SweepJob structs
+ *
+ * @post jobs remain unchanged at post
+ *
+ * @param[in] filePointer a pointer to a file
+ *
+ * @param[in] jobs a pointer to an array of SweepJob structs
+ *
+ * @param[in] jobCount the number of jobs
+ *
+ * @return Nothing to return (void)
+ */
+void writeSweepResults( FILE *filePointer, SweepJob *jobs, int jobCount )
+{
+    int iterator;
+    SweepJob *job;
+
+    fprintf( filePointer, "Parameter Sweep Results\n" );
+    fprintf( filePointer, "=======================\n" );
+    fprintf( filePointer,
+             "%-8s %8s %12s %14s %10s %11s %11s %11s %10s\n",
+             "Policy", "Quantum", "Memory (KB)", "Sim Time (ms)",
+             "Processes", "Dispatches", "I/O Blocks", "Seg Faults",
+             "Wall (ms)" );
+
+    for( iterator = 0; iterator < jobCount; iterator++ )
+    {
+        job = &jobs[ iterator ];
+
+        if( job->failed == True )
+        {
+            fprintf( filePointer, "%-8s %8d %12d %14s\n",
+                     job->policy, job->quantumTime, job->memAvailable,
+                     "FAILED" );
+            continue;
+        }
+
+        fprintf( filePointer,
+                 "%-8s %8d %12d %14.3lf %10d %11d %11d %11d %10.2lf\n",
+                 job->policy, job->quantumTime, job->memAvailable,
+                 job->summary.totalTime, job->summary.processes,
+                 job->summary.dispatches, job->summary.ioBlocks,
+                 job->summary.segFaults, job->wallTime );
+    }
+}
+//
+// freeSweepPolicies Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees a list of CPU scheduling codes
+ *
+ * @details This function frees every code made by parseSweepPolicies and
+ *          the array holding them.
+ *
+ * @pre policies a pointer to an array of strings, or NULL
+ *
+ * @post policies is freed at post
+ *
+ * @param[in] policies a pointer to an array of strings
+ *
+ * @param[in] policyCount the number of strings in the array
+ *
+ * @return Nothing to return (void)
+ */
+void freeSweepPolicies( char **policies, int policyCount )
+{
+    int iterator;
+
+    if( policies == NULL )
+    {
+        return;
+    }
+
+    for( iterator = 0; iterator < policyCount; iterator++ )
+    {
+        free( policies[ iterator ] );
+    }
+
+    free( policies );
+}
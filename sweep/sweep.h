@@ -0,0 +1,160 @@
+// Sweep Header Information ////////////////////////////////////////
+/**
+* @file sweep.h
+*
+* @brief Header file for sweep
+*
+* @details Specifies constants, simple data structures, included libraries,
+* and function declarations used in running parameter sweeps
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of sweep
+*
+* @version 1.10
+* C.S student (18 October 2026)
+* Jobs run on the pool threads with their own SimContext instead of in
+* forked children
+*
+* @version 1.20
+* C.S student (18 October 2026)
+* Added the quantum search of --optimize quantum
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides the functionality to run one workload under many
+  scheduling codes, quantum times and memory sizes across all host cores,
+  and to write the results of every run as a single table.
+
+  With --optimize quantum it instead searches for the quantum time that
+  gives the best objective. Each round runs an evenly spaced grid of
+  quantum times across the pool, then narrows the range to the grid points
+  either side of the best one, until every quantum time left is run. Runs
+  already made are never repeated, and all of them are written as the
+  objective curve
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef SWEEP_H
+#define SWEEP_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "simIO.h"
+#include "processor.h"
+#include "stringUtils.h"
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+static const char SWEEP_POLICY_OPTION[] = "--policy";
+static const char SWEEP_QUANTUM_OPTION[] = "--quantum";
+static const char SWEEP_MEMORY_OPTION[] = "--memory";
+static const char SWEEP_JOBS_OPTION[] = "--jobs";
+static const char SWEEP_OUT_OPTION[] = "--out";
+static const char SWEEP_OPTIMIZE_OPTION[] = "--optimize";
+static const char SWEEP_OBJECTIVE_OPTION[] = "--objective";
+
+// Quantum times run in each round of a search, unless there are more
+// threads in the pool
+#define OPTIMIZE_GRID_POINTS 8
+
+// Objectives a quantum search can minimize
+typedef enum
+{
+  TURNAROUND_OBJECTIVE = 0,
+  RESPONSE_P99_OBJECTIVE,
+  SWITCHES_OBJECTIVE,
+  OBJECTIVE_COUNT
+} OPTIMIZE_OBJECTIVES;
+
+extern const char *objectiveNames[];
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+
+// One combination of settings and the results of running it
+typedef struct SweepJob
+{
+  char *policy;
+  int quantumTime;
+  int memAvailable;
+  RunSummary summary;
+  // Objectives a quantum search can minimize
+  double meanTurnaround;
+  double p99Response;
+  int contextSwitches;
+  double wallTime;
+  Boolean failed;
+} SweepJob;
+
+// Work shared by every thread of the pool
+typedef struct SweepPool
+{
+  SweepJob *jobs;
+  int jobCount;
+  int nextJob;
+  pthread_mutex_t jobMutex;
+  ConfigData *cfData;
+  MetaNode *workloadNode;
+} SweepPool;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+Boolean checkSweepArgs( int argc, char *argv[] );
+
+int runSweep( int argc, char *argv[], ConfigData *cfData, MetaNode *workloadNode );
+
+int parseSweepValues( char *valueStr, int min, int max, int **values );
+
+int parseSweepPolicies( char *policyStr, char ***policies );
+
+Boolean checkSweepPolicy( char *policy );
+
+void runSweepPool( SweepPool *pool, int threadCount );
+
+int runQuantumSearch( SweepPool *pool,
+                      char *policy,
+                      int memAvailable,
+                      int lowQuantum,
+                      int highQuantum,
+                      OPTIMIZE_OBJECTIVES objective,
+                      int threadCount,
+                      FILE *filePointer );
+
+int getSearchGrid( int lowQuantum, int highQuantum, int gridPoints,
+                   int *quantumTimes );
+
+SweepJob *findSweepQuantum( SweepJob *jobs, int jobCount, int quantumTime );
+
+double getSweepObjective( SweepJob *job, OPTIMIZE_OBJECTIVES objective );
+
+int compareSweepQuanta( const void *first, const void *second );
+
+void writeQuantumCurve( FILE *filePointer,
+                        SweepJob *jobs,
+                        int jobCount,
+                        OPTIMIZE_OBJECTIVES objective,
+                        SweepJob *bestJob );
+
+void *sweepWorker( void *pool );
+
+Boolean runSweepJob( SweepPool *pool, SweepJob *job );
+
+void writeSweepResults( FILE *filePointer, SweepJob *jobs, int jobCount );
+
+void freeSweepPolicies( char **policies, int policyCount );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // SWEEP_H
+//
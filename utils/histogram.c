@@ -0,0 +1,536 @@
+// Histogram Implementation File Information ///////////////////////////////
+/**
+* @file histogram.c
+*
+* @brief Implementation for histogram
+*
+* @details Implements all functions for recording values in a high dynamic
+*          range histogram and writing out its percentile distribution
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of histogram
+*
+* @note Requires histogram.h
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+#include "histogram.h"
+
+//
+// initHistogram Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function initializes a histogram
+ *
+ * @details This function sizes the buckets of a histogram so every value
+ *          from one to highestTrackableValue is kept to the given number of
+ *          significant digits, then allocates its counts.
+ *
+ * @par Algorithm
+ *      The first bucket needs one count per value up to 2 * 10^digits, so
+ *      the sub bucket count is the power of two at or above that. Buckets
+ *      double in width until one reaches past the highest value. Only the
+ *      top half of each bucket after the first is kept, as its bottom half
+ *      is covered by the bucket before it.
+ *
+ * @pre histogram a pointer to a Histogram struct
+ *
+ * @post histogram holds no values at post
+ *
+ * @exception noMemory
+ *            If the counts cannot be allocated, the histogram is left
+ *            cleared and False is returned.
+ *
+ * @param[out] histogram a pointer to a Histogram struct
+ *
+ * @param[in] highestTrackableValue the largest value to keep, larger
+ *            values are counted as this value
+ *
+ * @param[in] significantDigits the number of digits every value keeps,
+ *            from 1 to 5
+ *
+ * @return success of method operation (Boolean)
+ */
+Boolean initHistogram( Histogram *histogram,
+                       long long highestTrackableValue,
+                       int significantDigits )
+{
+    long long largestUnitValue = 2, smallestUntrackable;
+    int digit, subBucketCountMagnitude = 0;
+
+    clearHistogram( histogram );
+
+    for( digit = 0; digit < significantDigits; digit++ )
+    {
+        largestUnitValue *= 10;
+    }
+
+    while( ( 1LL << subBucketCountMagnitude ) < largestUnitValue )
+    {
+        subBucketCountMagnitude++;
+    }
+
+    histogram->highestTrackableValue = highestTrackableValue;
+    histogram->significantDigits = significantDigits;
+    histogram->subBucketHalfCountMagnitude = subBucketCountMagnitude - 1;
+    histogram->subBucketCount = 1 << subBucketCountMagnitude;
+    histogram->subBucketHalfCount = histogram->subBucketCount / 2;
+    histogram->subBucketMask = histogram->subBucketCount - 1;
+
+    histogram->bucketCount = 1;
+    smallestUntrackable = histogram->subBucketCount;
+
+    while( smallestUntrackable <= highestTrackableValue )
+    {
+        smallestUntrackable <<= 1;
+        histogram->bucketCount++;
+    }
+
+    histogram->countsLength = ( histogram->bucketCount + 1 )
+                            * histogram->subBucketHalfCount;
+    histogram->counts = calloc( histogram->countsLength, sizeof( long long ) );
+
+    if( histogram->counts == NULL )
+    {
+        clearHistogram( histogram );
+        return False;
+    }
+
+    return True;
+}
+//
+// clearHistogram Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function clears a histogram without freeing it
+ *
+ * @details This function sets a histogram to the unused state, where it
+ *          has no counts and drops any value recorded to it.
+ *
+ * @pre histogram a pointer to a Histogram struct
+ *
+ * @post histogram has no counts at post
+ *
+ * @param[out] histogram a pointer to a Histogram struct
+ *
+ * @return nothing to return (void)
+ */
+void clearHistogram( Histogram *histogram )
+{
+    histogram->highestTrackableValue = 0;
+    histogram->significantDigits = 0;
+    histogram->subBucketHalfCountMagnitude = 0;
+    histogram->subBucketCount = 0;
+    histogram->subBucketHalfCount = 0;
+    histogram->subBucketMask = 0;
+    histogram->bucketCount = 0;
+    histogram->counts = NULL;
+    histogram->countsLength = 0;
+    histogram->totalCount = 0;
+    histogram->maxValue = 0;
+}
+//
+// freeHistogram Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function frees the counts of a histogram
+ *
+ * @pre histogram a pointer to a Histogram struct
+ *
+ * @post histogram has no counts at post
+ *
+ * @param[in,out] histogram a pointer to a Histogram struct
+ *
+ * @return nothing to return (void)
+ */
+void freeHistogram( Histogram *histogram )
+{
+    free( histogram->counts );
+    clearHistogram( histogram );
+}
+//
+// recordHistogramValue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function counts one value in a histogram
+ *
+ * @details This function adds one to the count of the bucket holding the
+ *          value. Negative values are counted as zero and values past the
+ *          highest trackable value are counted as that value.
+ *
+ * @pre histogram a pointer to a Histogram struct
+ *
+ * @post histogram holds the value at post, unless it has no counts
+ *
+ * @param[in,out] histogram a pointer to a Histogram struct
+ *
+ * @param[in] value the value to count
+ *
+ * @return nothing to return (void)
+ */
+void recordHistogramValue( Histogram *histogram, long long value )
+{
+    if( histogram->counts == NULL )
+    {
+        return;
+    }
+
+    if( value < 0 )
+    {
+        value = 0;
+    }
+    else if( value > histogram->highestTrackableValue )
+    {
+        value = histogram->highestTrackableValue;
+    }
+
+    histogram->counts[ getHistogramIndex( histogram, value ) ]++;
+    histogram->totalCount++;
+
+    if( value > histogram->maxValue )
+    {
+        histogram->maxValue = value;
+    }
+}
+//
+// getHistogramIndex Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function finds the count that holds a value
+ *
+ * @pre histogram a pointer to an initialized Histogram struct
+ *
+ * @pre value from zero to the highest trackable value
+ *
+ * @post histogram remains unchanged at post
+ *
+ * @param[in] histogram a pointer to a Histogram struct
+ *
+ * @param[in] value the value to find
+ *
+ * @return the index of the count (int)
+ */
+int getHistogramIndex( Histogram *histogram, long long value )
+{
+    int bucketIndex = 0;
+    long long subBucketIndex;
+
+    while( ( value >> bucketIndex ) > histogram->subBucketMask )
+    {
+        bucketIndex++;
+    }
+
+    subBucketIndex = value >> bucketIndex;
+
+    return (int) ( ( (long long) ( bucketIndex + 1 )
+                     << histogram->subBucketHalfCountMagnitude )
+                 + ( subBucketIndex - histogram->subBucketHalfCount ) );
+}
+//
+// getHistogramIndexValue Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the lowest value held by a count
+ *
+ * @pre histogram a pointer to an initialized Histogram struct
+ *
+ * @pre index a valid index of the counts
+ *
+ * @post histogram remains unchanged at post
+ *
+ * @param[in] histogram a pointer to a Histogram struct
+ *
+ * @param[in] index the index of the count
+ *
+ * @return the lowest value of the count (long long)
+ */
+long long getHistogramIndexValue( Histogram *histogram, int index )
+{
+    int bucketIndex = ( index >> histogram->subBucketHalfCountMagnitude ) - 1;
+    long long subBucketIndex = ( index & ( histogram->subBucketHalfCount - 1 ) )
+                             + histogram->subBucketHalfCount;
+
+    if( bucketIndex < 0 )
+    {
+        subBucketIndex -= histogram->subBucketHalfCount;
+        bucketIndex = 0;
+    }
+
+    return subBucketIndex << bucketIndex;
+}
+//
+// getHistogramHighestEquivalent Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the highest value held by a count
+ *
+ * @pre histogram a pointer to an initialized Histogram struct
+ *
+ * @pre index a valid index of the counts
+ *
+ * @post histogram remains unchanged at post
+ *
+ * @param[in] histogram a pointer to a Histogram struct
+ *
+ * @param[in] index the index of the count
+ *
+ * @return the highest value of the count (long long)
+ */
+long long getHistogramHighestEquivalent( Histogram *histogram, int index )
+{
+    int bucketIndex = ( index >> histogram->subBucketHalfCountMagnitude ) - 1;
+
+    if( bucketIndex < 0 )
+    {
+        bucketIndex = 0;
+    }
+
+    return getHistogramIndexValue( histogram, index )
+         + ( 1LL << bucketIndex ) - 1;
+}
+//
+// getHistogramMean Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the mean of the values in a histogram
+ *
+ * @details This function takes every value to be the middle of its count.
+ *
+ * @pre histogram a pointer to a Histogram struct
+ *
+ * @post histogram remains unchanged at post
+ *
+ * @param[in] histogram a pointer to a Histogram struct
+ *
+ * @return the mean, or 0 with no values (double)
+ */
+double getHistogramMean( Histogram *histogram )
+{
+    int index;
+    double total = 0, lowValue, highValue;
+
+    if( histogram->totalCount == 0 )
+    {
+        return 0;
+    }
+
+    for( index = 0; index < histogram->countsLength; index++ )
+    {
+        if( histogram->counts[ index ] > 0 )
+        {
+            lowValue = getHistogramIndexValue( histogram, index );
+            highValue = getHistogramHighestEquivalent( histogram, index );
+            total += ( lowValue + highValue ) / 2 * histogram->counts[ index ];
+        }
+    }
+
+    return total / histogram->totalCount;
+}
+//
+// getHistogramStdDeviation Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the standard deviation of a histogram
+ *
+ * @details This function takes every value to be the middle of its count.
+ *
+ * @pre histogram a pointer to a Histogram struct
+ *
+ * @post histogram remains unchanged at post
+ *
+ * @param[in] histogram a pointer to a Histogram struct
+ *
+ * @return the standard deviation, or 0 with no values (double)
+ */
+double getHistogramStdDeviation( Histogram *histogram )
+{
+    int index;
+    double mean = getHistogramMean( histogram ), total = 0, deviation;
+
+    if( histogram->totalCount == 0 )
+    {
+        return 0;
+    }
+
+    for( index = 0; index < histogram->countsLength; index++ )
+    {
+        if( histogram->counts[ index ] > 0 )
+        {
+            deviation = ( getHistogramIndexValue( histogram, index )
+                        + getHistogramHighestEquivalent( histogram, index ) )
+                      / 2.0 - mean;
+            total += deviation * deviation * histogram->counts[ index ];
+        }
+    }
+
+    return sqrt( total / histogram->totalCount );
+}
+//
+// getHistogramPercentile Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function gets the value at a percentile of a histogram
+ *
+ * @pre histogram a pointer to a Histogram struct
+ *
+ * @post histogram remains unchanged at post
+ *
+ * @param[in] histogram a pointer to a Histogram struct
+ *
+ * @param[in] percentile the percentile to get, from 0 to 100
+ *
+ * @return the highest value of the count the percentile falls in, or 0
+ *         with no values (long long)
+ */
+long long getHistogramPercentile( Histogram *histogram, double percentile )
+{
+    int index;
+    long long countAtPercentile, totalToIndex = 0;
+
+    if( histogram->totalCount == 0 )
+    {
+        return 0;
+    }
+
+    countAtPercentile = (long long) ( percentile / 100
+                                      * histogram->totalCount + 0.5 );
+
+    if( countAtPercentile < 1 )
+    {
+        countAtPercentile = 1;
+    }
+
+    for( index = 0; index < histogram->countsLength; index++ )
+    {
+        totalToIndex += histogram->counts[ index ];
+
+        if( totalToIndex >= countAtPercentile )
+        {
+            return getHistogramHighestEquivalent( histogram, index );
+        }
+    }
+
+    return histogram->maxValue;
+}
+//
+// writePercentileDistribution Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function writes the percentile distribution of a histogram
+ *
+ * @details This function writes the histogram in the HdrHistogram
+ *          percentile distribution text format: one line of value,
+ *          percentile, count so far and 1/(1-percentile) for each step,
+ *          followed by the mean, deviation, max and size of the histogram.
+ *
+ * @par Algorithm
+ *      Steps get finer as the percentile nears 100, with
+ *      HISTOGRAM_TICKS_PER_HALF lines for every halving of the distance
+ *      left. The last line is always the 100th percentile.
+ *
+ * @pre histogram a pointer to a Histogram struct
+ *
+ * @pre filePointer a pointer to a file open for writing
+ *
+ * @post histogram remains unchanged at post
+ *
+ * @param[in] histogram a pointer to a Histogram struct
+ *
+ * @param[in] filePointer a pointer to the file written to
+ *
+ * @param[in] unitScale the recorded values are divided by this to give the
+ *            written values
+ *
+ * @return nothing to return (void)
+ */
+void writePercentileDistribution( Histogram *histogram,
+                                  FILE *filePointer,
+                                  double unitScale )
+{
+    int index;
+    long long totalToIndex = 0, reportingTicks;
+    double percentile = 0, value, distanceLimit;
+
+    fprintf( filePointer, "%12s %14s %10s %14s\n\n",
+             "Value", "Percentile", "TotalCount", "1/(1-Percentile)" );
+
+    for( index = 0; index < histogram->countsLength
+                 && totalToIndex < histogram->totalCount; index++ )
+    {
+        if( histogram->counts[ index ] == 0 )
+        {
+            continue;
+        }
+
+        totalToIndex += histogram->counts[ index ];
+        value = getHistogramHighestEquivalent( histogram, index ) / unitScale;
+
+        while( 100.0 * totalToIndex / histogram->totalCount >= percentile )
+        {
+            fprintf( filePointer, "%12.3lf %2.12lf %10lld %14.2lf\n",
+                     value, percentile / 100, totalToIndex,
+                     1 / ( 1 - percentile / 100 ) );
+
+            reportingTicks = HISTOGRAM_TICKS_PER_HALF * 2;
+            distanceLimit = 50;
+
+            while( 100 - percentile <= distanceLimit )
+            {
+                reportingTicks *= 2;
+                distanceLimit /= 2;
+            }
+
+            percentile += 100.0 / reportingTicks;
+
+            // Only one step is written at the last value, then 100%
+            if( totalToIndex == histogram->totalCount )
+            {
+                fprintf( filePointer, "%12.3lf %2.12lf %10lld\n",
+                         value, 1.0, totalToIndex );
+                break;
+            }
+        }
+    }
+
+    fprintf( filePointer, "#[Mean    = %12.3lf, StdDeviation   = %12.3lf]\n",
+             getHistogramMean( histogram ) / unitScale,
+             getHistogramStdDeviation( histogram ) / unitScale );
+    fprintf( filePointer, "#[Max     = %12.3lf, Total count    = %12lld]\n",
+             histogram->maxValue / unitScale, histogram->totalCount );
+    fprintf( filePointer, "#[Buckets = %12d, SubBuckets     = %12d]\n",
+             histogram->bucketCount, histogram->subBucketCount );
+}
+//
+// getHostNanoSec Function Implementation ///////////////////////////////////
+//
+
+/**
+ * @brief This function reads the host monotonic clock
+ *
+ * @details This function is used to time operations that take no
+ *          simulated time, so they can still be recorded in a histogram.
+ *
+ * @return the host monotonic time in nsec (long long)
+ */
+long long getHostNanoSec( void )
+{
+    struct timespec hostTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &hostTime );
+
+    return (long long) hostTime.tv_sec * 1000000000LL + hostTime.tv_nsec;
+}
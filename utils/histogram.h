@@ -0,0 +1,97 @@
+// Histogram Header Information ////////////////////////////////////////
+/**
+* @file histogram.h
+*
+* @brief Header file for histogram
+*
+* @details Specifies constants, simple data structures, included libraries,
+*          and function declarations used in recording latency histograms
+*
+* @version 1.00
+* C.S student (18 October 2026)
+* Initial creation of histogram
+*
+* @note None
+*/
+
+// Program Description/Support /////////////////////////////////////
+/*
+  This file provides a high dynamic range (HDR) histogram. Values from one
+  to a set highest value are counted in buckets whose width grows with the
+  value, so every value is kept to a set number of significant digits with
+  a fixed, small amount of memory and a constant time to record. The
+  histogram can be written in the percentile distribution text format used
+  by HdrHistogram, so the usual plotting tools can read it.
+*/
+// Precompiler Directives //////////////////////////////////////////
+//
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+//
+// Header Files ///////////////////////////////////////////////////
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "basicStructs.h"
+//
+// Global Constant Definitions ////////////////////////////////////
+//
+
+// Percentile lines written for each halving of the distance to 100%
+#define HISTOGRAM_TICKS_PER_HALF 5
+//
+// Data Structure Definitions (structs, enums, etc.)////////////////
+//
+typedef struct Histogram
+{
+  long long highestTrackableValue;
+  int significantDigits;
+  // Each bucket holds subBucketCount values, the first bucket has unit
+  // width and every bucket after it is twice as wide as the one before
+  int subBucketHalfCountMagnitude;
+  int subBucketCount;
+  int subBucketHalfCount;
+  long long subBucketMask;
+  int bucketCount;
+  // NULL until initHistogram, values recorded before then are dropped
+  long long *counts;
+  int countsLength;
+  long long totalCount;
+  long long maxValue;
+} Histogram;
+//
+// Function Prototypes ///////////////////////////////////////
+//
+Boolean initHistogram( Histogram *histogram,
+                       long long highestTrackableValue,
+                       int significantDigits );
+
+void clearHistogram( Histogram *histogram );
+
+void freeHistogram( Histogram *histogram );
+
+void recordHistogramValue( Histogram *histogram, long long value );
+
+int getHistogramIndex( Histogram *histogram, long long value );
+
+long long getHistogramIndexValue( Histogram *histogram, int index );
+
+long long getHistogramHighestEquivalent( Histogram *histogram, int index );
+
+double getHistogramMean( Histogram *histogram );
+
+double getHistogramStdDeviation( Histogram *histogram );
+
+long long getHistogramPercentile( Histogram *histogram, double percentile );
+
+void writePercentileDistribution( Histogram *histogram,
+                                  FILE *filePointer,
+                                  double unitScale );
+
+long long getHostNanoSec( void );
+//
+// Terminating Precompiler Directives ///////////////////////////////
+//
+#endif // HISTOGRAM_H
+//
@@ -8,7 +8,10 @@
  *
  * @details Implements member methods for timing
  *
- * @version 3.00 (02 February 2017) Update to simulator timer
+ * @version 3.30 (18 October 2026) Timer counts its accesses
+ *          3.20 (18 October 2026) Timer state moved into SimTimer
+ *          3.10 (18 October 2026) Added virtual clock mode
+ *          3.00 (02 February 2017) Update to simulator timer
             2.00 (13 January 2017) Update to C language
  *          1.00 (11 September 2015)
  *
@@ -71,61 +74,85 @@ void runTimer( int milliSeconds )
        }
    }
 
-double accessTimer( int controlCode, char *timeStr )
+void initTimer( SimTimer *timer )
    {
-    static Boolean running = False;
-    static int startSec = 0, endSec = 0, startUSec = 0, endUSec = 0;
-    static int lapSec = 0, lapUSec = 0;
+    timer->running = False;
+    timer->startSec = 0;
+    timer->startUSec = 0;
+    timer->virtualClock = False;
+    timer->virtualTime = 0.0;
+    timer->accessCount = 0;
+
+    pthread_mutex_init( &timer->timerMutex, NULL );
+   }
+
+void destroyTimer( SimTimer *timer )
+   {
+    pthread_mutex_destroy( &timer->timerMutex );
+   }
+
+double accessTimer( SimTimer *timer, int controlCode, char *timeStr )
+   {
+    int endSec = 0, endUSec = 0;
+    int lapSec = 0, lapUSec = 0;
     struct timeval startData, lapData, endData;
     double fpTime = 0.0;
 
-    pthread_mutex_lock(&timerMutex);
+    if( timer->virtualClock == True )
+       {
+        return accessVirtualTimer( timer, controlCode, timeStr );
+       }
+
+    pthread_mutex_lock(&timer->timerMutex);
+    timer->accessCount++;
     switch( controlCode )
        {
         case ZERO_TIMER:
            gettimeofday( &startData, NULL );
-           running = True;
+           timer->running = True;
+           // a run starts by zeroing the timer, so its count starts here
+           timer->accessCount = 1;
 
-           startSec = startData.tv_sec;
-           startUSec = startData.tv_usec;
+           timer->startSec = startData.tv_sec;
+           timer->startUSec = startData.tv_usec;
 
            fpTime = 0.000000000;
            lapSec = 0.000000000;
            lapUSec = 0.000000000;
 
            timeToString( lapSec, lapUSec, timeStr );
-           pthread_mutex_unlock(&timerMutex);
+           pthread_mutex_unlock(&timer->timerMutex);
            break;
 
         case LAP_TIMER:
-           if( running == True )
+           if( timer->running == True )
               {
                gettimeofday( &lapData, NULL );
 
                lapSec = lapData.tv_sec;
                lapUSec = lapData.tv_usec;
 
-               fpTime = processTime( startSec, lapSec,
-                                     startUSec, lapUSec, timeStr );
+               fpTime = processTime( timer->startSec, lapSec,
+                                     timer->startUSec, lapUSec, timeStr );
               }
            else
               {
                fpTime = 0.000000000;
               }
-           pthread_mutex_unlock(&timerMutex);
+           pthread_mutex_unlock(&timer->timerMutex);
            break;
 
         case STOP_TIMER:
-           if( running == True )
+           if( timer->running == True )
               {
                gettimeofday( &endData, NULL );
-               running = False;
+               timer->running = False;
 
                endSec = endData.tv_sec;
                endUSec = endData.tv_usec;
 
-               fpTime = processTime( startSec, endSec,
-                                                 startUSec, endUSec, timeStr );
+               fpTime = processTime( timer->startSec, endSec,
+                                                 timer->startUSec, endUSec, timeStr );
               }
 
            // assume timer not running
@@ -133,13 +160,92 @@ double accessTimer( int controlCode, char *timeStr )
               {
                fpTime = 0.000000000;
               }
-          pthread_mutex_unlock(&timerMutex);
+          pthread_mutex_unlock(&timer->timerMutex);
            break;
        }
 
     return fpTime;
    }
 
+void setVirtualClock( SimTimer *timer, Boolean enabled )
+   {
+    pthread_mutex_lock( &timer->timerMutex );
+
+    timer->virtualClock = enabled;
+    timer->virtualTime = 0.0;
+
+    pthread_mutex_unlock( &timer->timerMutex );
+   }
+
+Boolean checkVirtualClock( SimTimer *timer )
+   {
+    return timer->virtualClock;
+   }
+
+/* Moves the virtual clock forward, the time is in milliseconds
+   and only moves when this is called
+*/
+void advanceClock( SimTimer *timer, double milliSeconds )
+   {
+    pthread_mutex_lock( &timer->timerMutex );
+
+    if( milliSeconds > 0 )
+       {
+        timer->virtualTime += milliSeconds;
+       }
+
+    pthread_mutex_unlock( &timer->timerMutex );
+   }
+
+double accessVirtualTimer( SimTimer *timer, int controlCode, char *timeStr )
+   {
+    double fpTime;
+    int secTime, uSecTime;
+
+    pthread_mutex_lock( &timer->timerMutex );
+
+    timer->accessCount++;
+
+    if( controlCode == ZERO_TIMER )
+       {
+        timer->virtualTime = 0.0;
+        timer->accessCount = 1;
+       }
+
+    fpTime = timer->virtualTime / 1000;
+
+    pthread_mutex_unlock( &timer->timerMutex );
+
+    secTime = (int) fpTime;
+    uSecTime = (int) ( ( fpTime - secTime ) * 1000000 + 0.5 );
+
+    if( uSecTime >= 1000000 )
+       {
+        secTime++;
+        uSecTime -= 1000000;
+       }
+
+    timeToString( secTime, uSecTime, timeStr );
+
+    return fpTime;
+   }
+
+/* Returns how many times the timer has been read since it was
+   last zeroed, for the runtime counters
+*/
+long long getTimerAccessCount( SimTimer *timer )
+   {
+    long long accessCount;
+
+    pthread_mutex_lock( &timer->timerMutex );
+
+    accessCount = timer->accessCount;
+
+    pthread_mutex_unlock( &timer->timerMutex );
+
+    return accessCount;
+   }
+
 double processTime( double startSec, double endSec,
                            double startUSec, double endUSec, char *timeStr )
    {
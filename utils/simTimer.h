@@ -8,7 +8,10 @@
  *
  * @details Specifies all member methods of the SimpleTimer
  *
- * @version 2.00 (13 January 2017)
+ * @version 2.30 (18 October 2026) Timer counts its accesses
+ *          2.20 (18 October 2026) Timer state moved into SimTimer
+ *          2.10 (18 October 2026) Added virtual clock mode
+ *          2.00 (13 January 2017)
  *          1.00 (11 September 2015)
  *
  * @Note None
@@ -27,7 +30,6 @@
 #include <stdlib.h>
 #include <math.h>
 #include <pthread.h>
-#include "interupt.h"
 #include "basicStructs.h"
 
 // Global Constants  //////////////////////////////////////////////////////////
@@ -38,13 +40,42 @@ extern const char RADIX_POINT;
 extern const char SPACE;
 extern const char NULL_CHAR;
 
+// Data Structures ////////////////////////////////////////////////////////////
+
+/* State of one simulator clock, so that each simulation
+   running in a process can keep its own time
+*/
+typedef struct SimTimer
+   {
+    Boolean running;
+    int startSec, startUSec;
+    Boolean virtualClock;
+    double virtualTime;
+    long long accessCount;
+    pthread_mutex_t timerMutex;
+   } SimTimer;
+
 // Function Prototyp  /////////////////////////////////////////////////////////
 
 void *runTimerIO( void *milliSeconds );
 
 void runTimer( int milliSeconds );
 
-double accessTimer( int controlCode, char *timeStr );
+void initTimer( SimTimer *timer );
+
+void destroyTimer( SimTimer *timer );
+
+double accessTimer( SimTimer *timer, int controlCode, char *timeStr );
+
+void setVirtualClock( SimTimer *timer, Boolean enabled );
+
+Boolean checkVirtualClock( SimTimer *timer );
+
+void advanceClock( SimTimer *timer, double milliSeconds );
+
+double accessVirtualTimer( SimTimer *timer, int controlCode, char *timeStr );
+
+long long getTimerAccessCount( SimTimer *timer );
 
 double processTime( double startSec, double endSec,
                     double startUSec, double endUSec, char *timeStr );